@@ -0,0 +1,97 @@
+// benchmark.cpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <mjstr/ascii_case.hpp>
+#include <mjstr/string.hpp>
+
+namespace mjx {
+    template <class _Elem>
+    string<_Elem> make_text(const size_t _Size) {
+        // letters of both cases mixed with punctuation, like HTTP headers
+        string<_Elem> _Str;
+        _Str.reserve(_Size);
+        uint32_t _Seed = 0x1234'5678;
+        while (_Str.size() < _Size) {
+            _Seed                 = _Seed * 1'103'515'245 + 12'345;
+            const uint32_t _Value = (_Seed >> 16) % 60;
+            _Str.push_back(static_cast<_Elem>(_Value < 26 ? 'A' + _Value : (_Value < 52 ? 'a' + _Value - 26 : '-')));
+        }
+
+        return _Str;
+    }
+
+    template <class _Elem>
+    void bm_to_ascii_lower(::benchmark::State& _State) {
+        string<_Elem> _Str = make_text<_Elem>(static_cast<size_t>(_State.range(0)));
+        for (const auto& _Step : _State) {
+            to_ascii_lower(_Str);
+            to_ascii_upper(_Str);
+            ::benchmark::DoNotOptimize(_Str.data());
+        }
+
+        _State.SetBytesProcessed(
+            static_cast<int64_t>(_State.iterations()) * 2 * _State.range(0) * static_cast<int64_t>(sizeof(_Elem)));
+    }
+
+    void bm_to_ascii_lower_loop(::benchmark::State& _State) {
+        // the scalar loop replaced by to_ascii_lower()
+        utf8_string _Str = make_text<char>(static_cast<size_t>(_State.range(0)));
+        for (const auto& _Step : _State) {
+            char* const _Data  = _Str.data();
+            const size_t _Size = _Str.size();
+            for (size_t _Idx = 0; _Idx < _Size; ++_Idx) {
+                if (_Data[_Idx] >= 'A' && _Data[_Idx] <= 'Z') {
+                    _Data[_Idx] = static_cast<char>(_Data[_Idx] + 32);
+                }
+            }
+
+            for (size_t _Idx = 0; _Idx < _Size; ++_Idx) {
+                if (_Data[_Idx] >= 'a' && _Data[_Idx] <= 'z') {
+                    _Data[_Idx] = static_cast<char>(_Data[_Idx] - 32);
+                }
+            }
+
+            ::benchmark::DoNotOptimize(_Str.data());
+        }
+
+        _State.SetBytesProcessed(static_cast<int64_t>(_State.iterations()) * 2 * _State.range(0));
+    }
+
+    template <class _Elem>
+    void bm_iequals(::benchmark::State& _State) {
+        const string<_Elem> _Left  = make_text<_Elem>(static_cast<size_t>(_State.range(0)));
+        const string<_Elem> _Right = to_ascii_upper(_Left);
+        for (const auto& _Step : _State) {
+            ::benchmark::DoNotOptimize(iequals(_Left, _Right));
+        }
+
+        _State.SetBytesProcessed(
+            static_cast<int64_t>(_State.iterations()) * _State.range(0) * static_cast<int64_t>(sizeof(_Elem)));
+    }
+
+    template <class _Elem>
+    void bm_ifind(::benchmark::State& _State) {
+        // the needle occurs only at the end of the haystack
+        string<_Elem> _Haystack = make_text<_Elem>(static_cast<size_t>(_State.range(0)));
+        const string<_Elem> _Needle(8, static_cast<_Elem>('!'));
+        _Haystack.append(_Needle);
+        for (const auto& _Step : _State) {
+            ::benchmark::DoNotOptimize(ifind(_Haystack, _Needle));
+        }
+
+        _State.SetBytesProcessed(
+            static_cast<int64_t>(_State.iterations()) * _State.range(0) * static_cast<int64_t>(sizeof(_Elem)));
+    }
+} // namespace mjx
+
+BENCHMARK(::mjx::bm_to_ascii_lower<char>)->Arg(16)->Arg(64 << 10);
+BENCHMARK(::mjx::bm_to_ascii_lower<wchar_t>)->Arg(16)->Arg(64 << 10);
+BENCHMARK(::mjx::bm_to_ascii_lower_loop)->Arg(16)->Arg(64 << 10);
+BENCHMARK(::mjx::bm_iequals<char>)->Arg(14)->Arg(64)->Arg(64 << 10);
+BENCHMARK(::mjx::bm_iequals<wchar_t>)->Arg(14)->Arg(64)->Arg(64 << 10);
+BENCHMARK(::mjx::bm_ifind<char>)->Arg(64 << 10);
+BENCHMARK(::mjx::bm_ifind<wchar_t>)->Arg(64 << 10);
\ No newline at end of file
@@ -0,0 +1,177 @@
+// benchmark.cpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <mjstr/char_traits.hpp>
+#include <mjstr/searcher.hpp>
+#include <mjstr/string.hpp>
+
+namespace mjx {
+    template <class _Elem>
+    string<_Elem> make_haystack(const size_t _Size, const bool _Hit_heavy) {
+        // miss-heavy haystacks rarely contain the first character of the needle,
+        // hit-heavy ones contain both the first and the last character very often
+        string<_Elem> _Str;
+        _Str.reserve(_Size);
+        uint32_t _Seed = 0x1234'5678;
+        while (_Str.size() < _Size) {
+            _Seed = _Seed * 1'103'515'245 + 12'345;
+            if (_Hit_heavy) {
+                _Str.push_back(static_cast<_Elem>((_Seed >> 16) % 2 == 0 ? 'n' : 'e'));
+            } else {
+                _Str.push_back(static_cast<_Elem>('a' + (_Seed >> 16) % 12)); // only 'a'...'l'
+            }
+        }
+
+        return _Str;
+    }
+
+    template <class _Elem>
+    string<_Elem> make_needle(const size_t _Size) {
+        // needle that never occurs in any haystack, starts with 'n' and ends with 'e'
+        string<_Elem> _Str(_Size, static_cast<_Elem>('x'));
+        _Str.front() = static_cast<_Elem>('n');
+        _Str.back()  = static_cast<_Elem>('e');
+        return _Str;
+    }
+
+    template <class _Elem, bool _Reverse>
+    void bm_search(::benchmark::State& _State) {
+        const size_t _Haystack_size   = static_cast<size_t>(_State.range(0));
+        const string<_Elem> _Haystack = make_haystack<_Elem>(_Haystack_size, _State.range(2) != 0);
+        const string<_Elem> _Needle   = make_needle<_Elem>(static_cast<size_t>(_State.range(1)));
+        for (const auto& _Step : _State) {
+            if constexpr (_Reverse) {
+                ::benchmark::DoNotOptimize(char_traits<_Elem>::rfind(
+                    _Haystack.data(), _Haystack.size(), _Needle.data(), _Needle.size()));
+            } else {
+                ::benchmark::DoNotOptimize(char_traits<_Elem>::find(
+                    _Haystack.data(), _Haystack.size(), _Needle.data(), _Needle.size()));
+            }
+        }
+
+        _State.SetBytesProcessed(static_cast<int64_t>(_State.iterations())
+            * static_cast<int64_t>(_Haystack_size * sizeof(_Elem)));
+    }
+    template <class _Elem>
+    void bm_search_periodic(::benchmark::State& _State) {
+        // worst case for the SIMD search, every position passes the filter and fails in the middle
+        const size_t _Haystack_size   = static_cast<size_t>(_State.range(0));
+        const size_t _Half            = static_cast<size_t>(_State.range(1)) / 2;
+        const string<_Elem> _Haystack(_Haystack_size, static_cast<_Elem>('a'));
+        string<_Elem> _Needle(_Half * 2 + 1, static_cast<_Elem>('a'));
+        _Needle[_Half] = static_cast<_Elem>('b');
+        for (const auto& _Step : _State) {
+            ::benchmark::DoNotOptimize(
+                char_traits<_Elem>::find(_Haystack.data(), _Haystack.size(), _Needle.data(), _Needle.size()));
+        }
+
+        _State.SetBytesProcessed(static_cast<int64_t>(_State.iterations())
+            * static_cast<int64_t>(_Haystack_size * sizeof(_Elem)));
+    }
+
+    template <class _Elem>
+    void bm_searcher(::benchmark::State& _State) {
+        // the same needle is searched for in many short haystacks
+        const string<_Elem> _Haystack = make_haystack<_Elem>(static_cast<size_t>(_State.range(0)), true);
+        const string<_Elem> _Needle   = make_needle<_Elem>(static_cast<size_t>(_State.range(1)));
+        const searcher<_Elem> _Searcher(_Needle);
+        for (const auto& _Step : _State) {
+            ::benchmark::DoNotOptimize(_Searcher.find(_Haystack));
+        }
+
+        _State.SetBytesProcessed(static_cast<int64_t>(_State.iterations())
+            * static_cast<int64_t>(_Haystack.size() * sizeof(_Elem)));
+    }
+
+    template <class _Elem>
+    string<_Elem> make_char_set(const size_t _Size) {
+        // delimiters that never occur in the miss-heavy haystacks
+        const char* const _Delimiters = ",; \t\r\n:=()[]{}<>";
+        string<_Elem> _Str;
+        for (size_t _Idx = 0; _Idx < _Size; ++_Idx) {
+            _Str.push_back(static_cast<_Elem>(_Delimiters[_Idx]));
+        }
+
+        return _Str;
+    }
+
+    template <class _Elem, bool _Member>
+    void bm_find_of(::benchmark::State& _State) {
+        // find_first_of() scans a haystack without members, find_first_not_of() one with members only
+        const size_t _Haystack_size = static_cast<size_t>(_State.range(0));
+        const string<_Elem> _Set    = make_char_set<_Elem>(static_cast<size_t>(_State.range(1)));
+        string<_Elem> _Haystack     = make_haystack<_Elem>(_Haystack_size, false);
+        if constexpr (!_Member) {
+            for (size_t _Idx = 0; _Idx < _Haystack_size; ++_Idx) {
+                _Haystack[_Idx] = _Set[_Idx % _Set.size()];
+            }
+        }
+
+        for (const auto& _Step : _State) {
+            if constexpr (_Member) {
+                ::benchmark::DoNotOptimize(
+                    char_traits<_Elem>::find_first_of(_Haystack.data(), _Haystack.size(), _Set.data(), _Set.size()));
+            } else {
+                ::benchmark::DoNotOptimize(char_traits<_Elem>::find_first_not_of(
+                    _Haystack.data(), _Haystack.size(), _Set.data(), _Set.size()));
+            }
+        }
+
+        _State.SetBytesProcessed(static_cast<int64_t>(_State.iterations())
+            * static_cast<int64_t>(_Haystack_size * sizeof(_Elem)));
+    }
+
+    void bm_find_of_loop(::benchmark::State& _State) {
+        // the hand-written table lookup loop replaced by find_first_of(), the baseline
+        const size_t _Haystack_size = static_cast<size_t>(_State.range(0));
+        const utf8_string _Set      = make_char_set<char>(static_cast<size_t>(_State.range(1)));
+        const utf8_string _Haystack = make_haystack<char>(_Haystack_size, false);
+        bool _Table[256]            = {};
+        for (const char _Ch : _Set) {
+            _Table[static_cast<unsigned char>(_Ch)] = true;
+        }
+
+        const char* const _Ptr = _Haystack.data();
+        for (const auto& _Step : _State) {
+            size_t _Idx = 0;
+            while (_Idx < _Haystack_size && !_Table[static_cast<unsigned char>(_Ptr[_Idx])]) {
+                ++_Idx;
+            }
+
+            ::benchmark::DoNotOptimize(_Idx);
+        }
+
+        _State.SetBytesProcessed(static_cast<int64_t>(_State.iterations()) * static_cast<int64_t>(_Haystack_size));
+    }
+} // namespace mjx
+
+void set_benchmark_properties(auto* const _Benchmark) {
+    // 64 KB haystack, short (4) and long (32) needles, miss-heavy (0) and hit-heavy (1) haystacks
+    _Benchmark->ArgNames({"haystack", "needle", "hit_heavy"})
+        ->ArgsProduct({{64 << 10}, {4, 32}, {0, 1}})->Unit(::benchmark::TimeUnit::kMicrosecond);
+}
+
+BENCHMARK(::mjx::bm_search<char, false>)->Apply(set_benchmark_properties);
+BENCHMARK(::mjx::bm_search<char, true>)->Apply(set_benchmark_properties);
+BENCHMARK(::mjx::bm_search<wchar_t, false>)->Apply(set_benchmark_properties);
+BENCHMARK(::mjx::bm_search<wchar_t, true>)->Apply(set_benchmark_properties);
+
+BENCHMARK(::mjx::bm_search_periodic<char>)->ArgNames({"haystack", "needle"})
+    ->ArgsProduct({{64 << 10}, {64, 1024}})->Unit(::benchmark::TimeUnit::kMicrosecond);
+BENCHMARK(::mjx::bm_search_periodic<wchar_t>)->ArgNames({"haystack", "needle"})
+    ->ArgsProduct({{64 << 10}, {64, 1024}})->Unit(::benchmark::TimeUnit::kMicrosecond);
+BENCHMARK(::mjx::bm_searcher<char>)->ArgNames({"haystack", "needle"})->ArgsProduct({{256}, {4, 64}});
+
+// 64 KB haystack, sets of 1, 4 and 16 characters
+BENCHMARK(::mjx::bm_find_of<char, true>)->ArgNames({"haystack", "set"})
+    ->ArgsProduct({{64 << 10}, {1, 4, 16}})->Unit(::benchmark::TimeUnit::kMicrosecond);
+BENCHMARK(::mjx::bm_find_of<char, false>)->ArgNames({"haystack", "set"})
+    ->ArgsProduct({{64 << 10}, {1, 4, 16}})->Unit(::benchmark::TimeUnit::kMicrosecond);
+BENCHMARK(::mjx::bm_find_of<wchar_t, true>)->ArgNames({"haystack", "set"})
+    ->ArgsProduct({{64 << 10}, {1, 4, 16}})->Unit(::benchmark::TimeUnit::kMicrosecond);
+BENCHMARK(::mjx::bm_find_of_loop)->ArgNames({"haystack", "set"})
+    ->ArgsProduct({{64 << 10}, {1, 4, 16}})->Unit(::benchmark::TimeUnit::kMicrosecond);
\ No newline at end of file
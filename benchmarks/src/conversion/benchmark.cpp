@@ -4,7 +4,9 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <benchmark/benchmark.h>
+#include <cstdint>
 #include <mjstr/conversion.hpp>
+#include <mjstr/stream_conversion.hpp>
 
 namespace mjx {
     void bm_unicode_to_utf8_short(::benchmark::State& _State) {
@@ -357,6 +359,89 @@ namespace mjx {
             ));
         }
     }
+
+    unicode_string make_unicode_text(const size_t _Size, const bool _Mixed) {
+        // ASCII-heavy text looks like JSON keys and log lines, the mixed one has a non-ASCII
+        // character (from the Latin-1 Supplement or CJK block) in about every fifth word
+        static constexpr const wchar_t* _Ascii_words[] = {L"\"timestamp\": ", L"\"level\": ", L"INFO ",
+            L"request ", L"completed ", L"in ", L"12ms, ", L"user=42 "};
+        static constexpr const wchar_t* _Mixed_words[] = {L"żółw ", L"café ", L"東京 ", L"naïve "};
+        unicode_string _Str;
+        _Str.reserve(_Size);
+        uint32_t _Seed = 0x1234'5678;
+        while (_Str.size() < _Size) {
+            _Seed = _Seed * 1'103'515'245 + 12'345;
+            if (_Mixed && (_Seed >> 16) % 5 == 0) {
+                _Str.append(_Mixed_words[(_Seed >> 20) % 4]);
+            } else {
+                _Str.append(_Ascii_words[(_Seed >> 20) % 8]);
+            }
+        }
+
+        return _Str;
+    }
+
+    void bm_unicode_to_utf8_text(::benchmark::State& _State) {
+        const unicode_string _Text = make_unicode_text(static_cast<size_t>(_State.range(0)), _State.range(1) != 0);
+        for (const auto& _Step : _State) {
+            ::benchmark::DoNotOptimize(::mjx::to_utf8_string(_Text));
+        }
+
+        _State.SetItemsProcessed(static_cast<int64_t>(_State.iterations()) * static_cast<int64_t>(_Text.size()));
+    }
+
+    void bm_utf8_to_unicode_text(::benchmark::State& _State) {
+        const utf8_string _Text =
+            ::mjx::to_utf8_string(make_unicode_text(static_cast<size_t>(_State.range(0)), _State.range(1) != 0));
+        for (const auto& _Step : _State) {
+            ::benchmark::DoNotOptimize(::mjx::to_unicode_string(_Text));
+        }
+
+        _State.SetItemsProcessed(static_cast<int64_t>(_State.iterations()) * static_cast<int64_t>(_Text.size()));
+    }
+
+    void bm_utf8_to_unicode_into_text(::benchmark::State& _State) {
+        // converts into a buffer that is reused by every iteration
+        const utf8_string _Text =
+            ::mjx::to_utf8_string(make_unicode_text(static_cast<size_t>(_State.range(0)), _State.range(1) != 0));
+        unicode_string _Buf;
+        _Buf.reserve(_Text.size());
+        for (const auto& _Step : _State) {
+            _Buf.clear();
+            ::benchmark::DoNotOptimize(::mjx::convert_into(_Text, _Buf));
+        }
+
+        _State.SetItemsProcessed(static_cast<int64_t>(_State.iterations()) * static_cast<int64_t>(_Text.size()));
+    }
+
+    void bm_utf8_decoder_chunks(::benchmark::State& _State) {
+        // decodes the text in 4 KB chunks into a 4 KB buffer, as if it was read from a socket
+        const utf8_string _Text = ::mjx::to_utf8_string(make_unicode_text(256 << 10, _State.range(0) != 0));
+        unicode_string _Buf(4 << 10, L'\0');
+        for (const auto& _Step : _State) {
+            utf8_decoder _Decoder;
+            for (size_t _Off = 0; _Off < _Text.size(); _Off += 4 << 10) {
+                utf8_string_view _Chunk = utf8_string_view{_Text}.substr(_Off, 4 << 10);
+                while (!_Chunk.empty()) {
+                    const conversion_result _Result = _Decoder.feed(_Chunk, _Buf.data(), _Buf.size());
+                    ::benchmark::DoNotOptimize(_Buf.data());
+                    _Chunk.remove_prefix(_Result.read);
+                }
+            }
+        }
+
+        _State.SetItemsProcessed(static_cast<int64_t>(_State.iterations()) * static_cast<int64_t>(_Text.size()));
+    }
+
+    void bm_validate_utf8(::benchmark::State& _State) {
+        const utf8_string _Text =
+            ::mjx::to_utf8_string(make_unicode_text(static_cast<size_t>(_State.range(0)), _State.range(1) != 0));
+        for (const auto& _Step : _State) {
+            ::benchmark::DoNotOptimize(::mjx::validate_utf8(_Text));
+        }
+
+        _State.SetBytesProcessed(static_cast<int64_t>(_State.iterations()) * static_cast<int64_t>(_Text.size()));
+    }
 } // namespace mjx
 
 void set_benchmark_properties(auto* const _Benchmark) {
@@ -370,4 +455,12 @@ BENCHMARK(::mjx::bm_utf8_to_unicode_short)->Apply(set_benchmark_properties);
 BENCHMARK(::mjx::bm_utf8_to_unicode_middle)->Apply(set_benchmark_properties);
 BENCHMARK(::mjx::bm_utf8_to_unicode_long)->Apply(set_benchmark_properties);
 
+// 4 KB and 256 KB texts, ASCII-heavy (0) and mixed (1)
+BENCHMARK(::mjx::bm_unicode_to_utf8_text)->ArgNames({"size", "mixed"})->ArgsProduct({{4 << 10, 256 << 10}, {0, 1}});
+BENCHMARK(::mjx::bm_utf8_to_unicode_text)->ArgNames({"size", "mixed"})->ArgsProduct({{4 << 10, 256 << 10}, {0, 1}});
+BENCHMARK(::mjx::bm_utf8_to_unicode_into_text)
+    ->ArgNames({"size", "mixed"})->ArgsProduct({{4 << 10, 256 << 10}, {0, 1}});
+BENCHMARK(::mjx::bm_utf8_decoder_chunks)->ArgName("mixed")->Arg(0)->Arg(1);
+BENCHMARK(::mjx::bm_validate_utf8)->ArgNames({"size", "mixed"})->ArgsProduct({{4 << 10, 256 << 10}, {0, 1}});
+
 BENCHMARK_MAIN();
\ No newline at end of file
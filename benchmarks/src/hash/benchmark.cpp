@@ -0,0 +1,70 @@
+// benchmark.cpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <mjstr/hash.hpp>
+#include <mjstr/string.hpp>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace mjx {
+    void bm_hash(::benchmark::State& _State) {
+        const size_t _Size = static_cast<size_t>(_State.range(0));
+        const utf8_string _Str(_Size, 'h');
+        for (const auto& _Step : _State) {
+            ::benchmark::DoNotOptimize(::mjx::hash(_Str));
+        }
+
+        _State.SetBytesProcessed(static_cast<int64_t>(_State.iterations()) * static_cast<int64_t>(_Size));
+    }
+
+    void bm_std_hash(::benchmark::State& _State) {
+        // the standard library hash of the same characters, the baseline
+        const size_t _Size = static_cast<size_t>(_State.range(0));
+        const utf8_string _Str(_Size, 'h');
+        const ::std::string_view _View(_Str.data(), _Str.size());
+        for (const auto& _Step : _State) {
+            ::benchmark::DoNotOptimize(::std::hash<::std::string_view>{}(_View));
+        }
+
+        _State.SetBytesProcessed(static_cast<int64_t>(_State.iterations()) * static_cast<int64_t>(_Size));
+    }
+
+    template <bool _Transparent>
+    void bm_map_lookup_by_view(::benchmark::State& _State) {
+        // probes a map keyed by strings with views, a regular map needs a temporary string for every lookup
+        using _Map_t = ::std::conditional_t<_Transparent,
+            ::std::unordered_map<utf8_string, size_t, utf8_string_hash, utf8_string_equal>,
+            ::std::unordered_map<utf8_string, size_t>>;
+        _Map_t _Map;
+        ::std::vector<utf8_string> _Keys;
+        for (size_t _Idx = 0; _Idx < 1000; ++_Idx) {
+            _Keys.push_back("/api/v1/resources/" + utf8_string(_Idx % 20, 'x') + static_cast<char>('a' + _Idx % 26));
+            _Map.emplace(_Keys.back(), _Idx);
+        }
+
+        size_t _Index = 0;
+        for (const auto& _Step : _State) {
+            const utf8_string_view _Key = _Keys[_Index++ % _Keys.size()];
+            if constexpr (_Transparent) {
+                ::benchmark::DoNotOptimize(_Map.find(_Key));
+            } else {
+                ::benchmark::DoNotOptimize(_Map.find(utf8_string{_Key}));
+            }
+        }
+
+        _State.SetItemsProcessed(static_cast<int64_t>(_State.iterations()));
+    }
+} // namespace mjx
+
+// sizes from 8 bytes to 64 KB
+BENCHMARK(::mjx::bm_hash)->RangeMultiplier(8)->Range(8, 64 << 10);
+BENCHMARK(::mjx::bm_std_hash)->RangeMultiplier(8)->Range(8, 64 << 10);
+
+// transparent functors and the default std::hash
+BENCHMARK(::mjx::bm_map_lookup_by_view<true>);
+BENCHMARK(::mjx::bm_map_lookup_by_view<false>);
\ No newline at end of file
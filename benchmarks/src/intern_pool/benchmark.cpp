@@ -0,0 +1,59 @@
+// benchmark.cpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <mjstr/hash.hpp>
+#include <mjstr/intern_pool.hpp>
+#include <mjstr/string.hpp>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+namespace mjx {
+    const ::std::vector<utf8_string>& bm_values() {
+        // header-like values, interned over and over again
+        static const ::std::vector<utf8_string> _Values = [] {
+            ::std::vector<utf8_string> _Result;
+            for (size_t _Idx = 0; _Idx < 4096; ++_Idx) {
+                _Result.push_back("x-header-" + utf8_string(_Idx % 16, 'h') + static_cast<char>('a' + _Idx % 26)
+                                  + utf8_string(_Idx / 26 % 8, '-'));
+            }
+
+            return _Result;
+        }();
+        return _Values;
+    }
+
+    void bm_intern_pool(::benchmark::State& _State) {
+        static utf8_intern_pool _Pool;
+        const ::std::vector<utf8_string>& _Values = bm_values();
+        size_t _Index                             = static_cast<size_t>(_State.thread_index()) * 97;
+        for (const auto& _Step : _State) {
+            ::benchmark::DoNotOptimize(_Pool.intern(_Values[_Index++ % _Values.size()]));
+        }
+
+        _State.SetItemsProcessed(static_cast<int64_t>(_State.iterations()));
+    }
+
+    void bm_locked_set(::benchmark::State& _State) {
+        // a set of strings guarded by a single mutex, the baseline
+        static ::std::mutex _Mutex;
+        static ::std::unordered_set<utf8_string, utf8_string_hash, utf8_string_equal> _Set;
+        const ::std::vector<utf8_string>& _Values = bm_values();
+        size_t _Index                             = static_cast<size_t>(_State.thread_index()) * 97;
+        for (const auto& _Step : _State) {
+            const utf8_string& _Value = _Values[_Index++ % _Values.size()];
+            ::std::lock_guard<::std::mutex> _Guard(_Mutex);
+            ::benchmark::DoNotOptimize(_Set.insert(_Value).first->data());
+        }
+
+        _State.SetItemsProcessed(static_cast<int64_t>(_State.iterations()));
+    }
+} // namespace mjx
+
+// interning mostly existing values from many threads
+BENCHMARK(::mjx::bm_intern_pool)->ThreadRange(1, 8);
+BENCHMARK(::mjx::bm_locked_set)->ThreadRange(1, 8);
\ No newline at end of file
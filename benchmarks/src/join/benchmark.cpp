@@ -0,0 +1,54 @@
+// benchmark.cpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <mjstr/join.hpp>
+#include <mjstr/string.hpp>
+#include <vector>
+
+namespace mjx {
+    ::std::vector<utf8_string> bm_pieces(const size_t _Count) {
+        ::std::vector<utf8_string> _Pieces;
+        uint32_t _Seed = 0x1234'5678;
+        for (size_t _Idx = 0; _Idx < _Count; ++_Idx) {
+            _Seed = _Seed * 1'103'515'245 + 12'345;
+            _Pieces.push_back(utf8_string((_Seed >> 16) % 48 + 1, static_cast<char>('a' + _Idx % 26)));
+        }
+
+        return _Pieces;
+    }
+
+    void bm_join(::benchmark::State& _State) {
+        const ::std::vector<utf8_string> _Pieces = bm_pieces(static_cast<size_t>(_State.range(0)));
+        for (const auto& _Step : _State) {
+            ::benchmark::DoNotOptimize(join(_Pieces, ", "));
+        }
+
+        _State.SetItemsProcessed(static_cast<int64_t>(_State.iterations()) * _State.range(0));
+    }
+
+    void bm_append_loop(::benchmark::State& _State) {
+        // the repeated append() replaced by join(), reallocates as the string grows
+        const ::std::vector<utf8_string> _Pieces = bm_pieces(static_cast<size_t>(_State.range(0)));
+        for (const auto& _Step : _State) {
+            utf8_string _Result;
+            for (size_t _Idx = 0; _Idx < _Pieces.size(); ++_Idx) {
+                if (_Idx > 0) {
+                    _Result.append(", ");
+                }
+
+                _Result.append(_Pieces[_Idx]);
+            }
+
+            ::benchmark::DoNotOptimize(_Result);
+        }
+
+        _State.SetItemsProcessed(static_cast<int64_t>(_State.iterations()) * _State.range(0));
+    }
+} // namespace mjx
+
+BENCHMARK(::mjx::bm_join)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(::mjx::bm_append_loop)->RangeMultiplier(16)->Range(16, 1 << 16);
\ No newline at end of file
@@ -0,0 +1,61 @@
+// benchmark.cpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <mjstr/hash.hpp>
+#include <mjstr/shared_string.hpp>
+#include <mjstr/string.hpp>
+
+namespace mjx {
+    void bm_shared_string_copy(::benchmark::State& _State) {
+        const utf8_shared_string _Str(utf8_string(static_cast<size_t>(_State.range(0)), 'x'));
+        for (const auto& _Step : _State) {
+            utf8_shared_string _Copy = _Str;
+            ::benchmark::DoNotOptimize(_Copy);
+        }
+
+        _State.SetItemsProcessed(static_cast<int64_t>(_State.iterations()));
+    }
+
+    void bm_string_copy(::benchmark::State& _State) {
+        const utf8_string _Str(static_cast<size_t>(_State.range(0)), 'x');
+        for (const auto& _Step : _State) {
+            utf8_string _Copy = _Str;
+            ::benchmark::DoNotOptimize(_Copy);
+        }
+
+        _State.SetItemsProcessed(static_cast<int64_t>(_State.iterations()));
+    }
+
+    // a snapshot published once and read by all threads, every iteration takes a copy and reads the characters
+    void bm_shared_string_fan_out(::benchmark::State& _State) {
+        static const utf8_shared_string _Snapshot(utf8_string(1024, 's'));
+        for (const auto& _Step : _State) {
+            const utf8_shared_string _Copy = _Snapshot;
+            ::benchmark::DoNotOptimize(::mjx::hash(_Copy.view()));
+        }
+
+        _State.SetItemsProcessed(static_cast<int64_t>(_State.iterations()));
+    }
+
+    void bm_string_fan_out(::benchmark::State& _State) {
+        static const utf8_string _Snapshot(1024, 's');
+        for (const auto& _Step : _State) {
+            const utf8_string _Copy = _Snapshot;
+            ::benchmark::DoNotOptimize(::mjx::hash(_Copy));
+        }
+
+        _State.SetItemsProcessed(static_cast<int64_t>(_State.iterations()));
+    }
+} // namespace mjx
+
+// copying values of different sizes
+BENCHMARK(::mjx::bm_shared_string_copy)->Arg(16)->Arg(256)->Arg(4096);
+BENCHMARK(::mjx::bm_string_copy)->Arg(16)->Arg(256)->Arg(4096);
+
+// copying the same value from many threads, the shared reference count is the only written memory
+BENCHMARK(::mjx::bm_shared_string_fan_out)->ThreadRange(1, 8);
+BENCHMARK(::mjx::bm_string_fan_out)->ThreadRange(1, 8);
\ No newline at end of file
@@ -0,0 +1,93 @@
+// benchmark.cpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <mjstr/split.hpp>
+#include <mjstr/string.hpp>
+
+namespace mjx {
+    const utf8_string& bm_records() {
+        // 1 MB of comma-separated records, one per line
+        static const utf8_string _Records = [] {
+            utf8_string _Result;
+            uint32_t _Seed = 0x1234'5678;
+            while (_Result.size() < (1 << 20)) {
+                for (size_t _Field = 0; _Field < 8; ++_Field) {
+                    _Seed = _Seed * 1'103'515'245 + 12'345;
+                    _Result.append((_Seed >> 16) % 24 + 1, static_cast<char>('a' + _Field));
+                    _Result.push_back(_Field < 7 ? ',' : '\n');
+                }
+            }
+
+            return _Result;
+        }();
+        return _Records;
+    }
+
+    void bm_split(::benchmark::State& _State) {
+        const utf8_string& _Records = bm_records();
+        for (const auto& _Step : _State) {
+            size_t _Total = 0;
+            for (const utf8_string_view _Line : split(_Records, '\n', {.skip_empty = true})) {
+                for (const utf8_string_view _Field : split(_Line, ',')) {
+                    _Total += _Field.size();
+                }
+            }
+
+            ::benchmark::DoNotOptimize(_Total);
+        }
+
+        _State.SetBytesProcessed(static_cast<int64_t>(_State.iterations()) * static_cast<int64_t>(_Records.size()));
+    }
+
+    void bm_split_any(::benchmark::State& _State) {
+        const utf8_string& _Records = bm_records();
+        for (const auto& _Step : _State) {
+            size_t _Total = 0;
+            for (const utf8_string_view _Field : split_any(_Records, ",\n", {.skip_empty = true})) {
+                _Total += _Field.size();
+            }
+
+            ::benchmark::DoNotOptimize(_Total);
+        }
+
+        _State.SetBytesProcessed(static_cast<int64_t>(_State.iterations()) * static_cast<int64_t>(_Records.size()));
+    }
+
+    void bm_find_substr(::benchmark::State& _State) {
+        // the repeated find() and substr() replaced by split(), every field is a new string
+        const utf8_string& _Records = bm_records();
+        for (const auto& _Step : _State) {
+            size_t _Total = 0;
+            size_t _First = 0;
+            while (_First < _Records.size()) {
+                const size_t _Last      = _Records.find('\n', _First);
+                const utf8_string _Line = _Records.substr(_First, _Last - _First);
+                size_t _Off             = 0;
+                for (;;) {
+                    const size_t _Comma = _Line.find(',', _Off);
+                    const size_t _Count = _Comma == utf8_string::npos ? utf8_string::npos : _Comma - _Off;
+                    _Total += _Line.substr(_Off, _Count).size();
+                    if (_Comma == utf8_string::npos) {
+                        break;
+                    }
+
+                    _Off = _Comma + 1;
+                }
+
+                _First = _Last + 1;
+            }
+
+            ::benchmark::DoNotOptimize(_Total);
+        }
+
+        _State.SetBytesProcessed(static_cast<int64_t>(_State.iterations()) * static_cast<int64_t>(_Records.size()));
+    }
+} // namespace mjx
+
+BENCHMARK(::mjx::bm_split)->Unit(::benchmark::TimeUnit::kMicrosecond);
+BENCHMARK(::mjx::bm_split_any)->Unit(::benchmark::TimeUnit::kMicrosecond);
+BENCHMARK(::mjx::bm_find_substr)->Unit(::benchmark::TimeUnit::kMicrosecond);
\ No newline at end of file
@@ -0,0 +1,261 @@
+// benchmark.cpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <mjstr/memory_resource.hpp>
+#include <mjstr/static_string.hpp>
+#include <mjstr/string.hpp>
+#include <mjstr/string_builder.hpp>
+#include <vector>
+
+namespace mjx {
+    void bm_utf8_string_push_back(::benchmark::State& _State) {
+        const size_t _Target = static_cast<size_t>(_State.range(0));
+        for (const auto& _Step : _State) {
+            utf8_string _Str;
+            for (size_t _Count = 0; _Count < _Target; ++_Count) {
+                _Str.push_back('x');
+            }
+
+            ::benchmark::DoNotOptimize(_Str.data());
+        }
+
+        _State.SetBytesProcessed(static_cast<int64_t>(_State.iterations()) * static_cast<int64_t>(_Target));
+    }
+
+    void bm_utf8_string_append(::benchmark::State& _State) {
+        // appends 64-byte chunks, simulates assembling a log message line by line
+        const size_t _Target         = static_cast<size_t>(_State.range(0));
+        const utf8_string_view _Line = "2024-01-01 00:00:00.000 [info] request processed successfully\r\n";
+        for (const auto& _Step : _State) {
+            utf8_string _Str;
+            while (_Str.size() < _Target) {
+                _Str.append(_Line);
+            }
+
+            ::benchmark::DoNotOptimize(_Str.data());
+        }
+
+        _State.SetBytesProcessed(static_cast<int64_t>(_State.iterations()) * static_cast<int64_t>(_Target));
+    }
+
+    void bm_utf8_string_append_reserved(::benchmark::State& _State) {
+        // same as bm_utf8_string_append, but with the exact capacity reserved up front (lower bound)
+        const size_t _Target         = static_cast<size_t>(_State.range(0));
+        const utf8_string_view _Line = "2024-01-01 00:00:00.000 [info] request processed successfully\r\n";
+        for (const auto& _Step : _State) {
+            utf8_string _Str;
+            _Str.reserve(_Target + _Line.size());
+            while (_Str.size() < _Target) {
+                _Str.append(_Line);
+            }
+
+            ::benchmark::DoNotOptimize(_Str.data());
+        }
+
+        _State.SetBytesProcessed(static_cast<int64_t>(_State.iterations()) * static_cast<int64_t>(_Target));
+    }
+
+    void bm_utf8_string_builder_append(::benchmark::State& _State) {
+        // same as bm_utf8_string_append, but appends to a string_builder and finalizes it
+        const size_t _Target         = static_cast<size_t>(_State.range(0));
+        const utf8_string_view _Line = "2024-01-01 00:00:00.000 [info] request processed successfully\r\n";
+        for (const auto& _Step : _State) {
+            utf8_string_builder _Builder;
+            while (_Builder.size() < _Target) {
+                _Builder.append(_Line);
+            }
+
+            const utf8_string _Str = _Builder.finalize();
+            ::benchmark::DoNotOptimize(_Str.data());
+        }
+
+        _State.SetBytesProcessed(static_cast<int64_t>(_State.iterations()) * static_cast<int64_t>(_Target));
+    }
+
+    void bm_utf8_string_index_loop(::benchmark::State& _State) {
+        // counts line feeds through size() and operator[], both are cross-DSO calls unless inlined
+        const utf8_string _Str(static_cast<size_t>(_State.range(0)), '\n');
+        for (const auto& _Step : _State) {
+            size_t _Count = 0;
+            for (size_t _Idx = 0; _Idx < _Str.size(); ++_Idx) {
+                if (_Str[_Idx] == '\n') {
+                    ++_Count;
+                }
+            }
+
+            ::benchmark::DoNotOptimize(_Count);
+        }
+
+        _State.SetBytesProcessed(static_cast<int64_t>(_State.iterations()) * _State.range(0));
+    }
+
+    void bm_utf8_string_iterator_loop(::benchmark::State& _State) {
+        // counts line feeds through begin(), end() and the iterator operations
+        const utf8_string _Str(static_cast<size_t>(_State.range(0)), '\n');
+        for (const auto& _Step : _State) {
+            size_t _Count = 0;
+            for (const char _Ch : _Str) {
+                if (_Ch == '\n') {
+                    ++_Count;
+                }
+            }
+
+            ::benchmark::DoNotOptimize(_Count);
+        }
+
+        _State.SetBytesProcessed(static_cast<int64_t>(_State.iterations()) * _State.range(0));
+    }
+
+    void bm_utf8_string_view_index_loop(::benchmark::State& _State) {
+        // same as bm_utf8_string_index_loop, but goes through a string_view
+        const utf8_string _Str(static_cast<size_t>(_State.range(0)), '\n');
+        const utf8_string_view _View = _Str.view();
+        for (const auto& _Step : _State) {
+            size_t _Count = 0;
+            for (size_t _Idx = 0; _Idx < _View.size(); ++_Idx) {
+                if (_View[_Idx] == '\n') {
+                    ++_Count;
+                }
+            }
+
+            ::benchmark::DoNotOptimize(_Count);
+        }
+
+        _State.SetBytesProcessed(static_cast<int64_t>(_State.iterations()) * _State.range(0));
+    }
+
+    void bm_utf8_string_short_lived(::benchmark::State& _State) {
+        // simulates a request that builds many strings (16 to 79 characters) and drops them all at the end,
+        // the strings come from the global allocator (0) or from an arena released after every request
+        const size_t _Count   = static_cast<size_t>(_State.range(0));
+        const bool _Use_arena = _State.range(1) != 0;
+        arena_resource _Arena;
+        ::std::vector<utf8_string> _Strings;
+        _Strings.reserve(_Count);
+        for (const auto& _Step : _State) {
+            memory_resource* const _Resource = _Use_arena ? &_Arena : nullptr;
+            for (size_t _Idx = 0; _Idx < _Count; ++_Idx) {
+                utf8_string& _Str = _Strings.emplace_back(_Resource, 17 + _Idx % 64);
+                _Str.assign(16 + _Idx % 64, 'x');
+                _Str.push_back('!');
+            }
+
+            ::benchmark::DoNotOptimize(_Strings.data());
+            _Strings.clear();
+            _Arena.release();
+        }
+
+        _State.SetItemsProcessed(static_cast<int64_t>(_State.iterations()) * _State.range(0));
+    }
+
+    template <size_t _InlineBytes>
+    void bm_utf8_string_keys(::benchmark::State& _State) {
+        // builds 10000 keys with lengths typical for identifiers, JSON keys and paths, reports allocations
+        // and memory (object and heap) per key, range(0) is the longest key length
+        constexpr size_t _Count = 10'000;
+        const size_t _Max_size  = static_cast<size_t>(_State.range(0));
+        ::std::vector<size_t> _Sizes(_Count);
+        uint32_t _Seed = 12345;
+        for (size_t& _Size : _Sizes) { // most keys are short, few reach the maximum length
+            _Seed = _Seed * 1'103'515'245 + 12'345;
+            const size_t _Random = (_Seed >> 8) % _Max_size;
+            _Size                = 1 + _Random * _Random / _Max_size;
+        }
+
+        size_t _Allocations = 0;
+        size_t _Bytes       = 0;
+        ::std::vector<small_utf8_string<_InlineBytes>> _Keys;
+        _Keys.reserve(_Count);
+        for (const auto& _Step : _State) {
+            for (const size_t _Size : _Sizes) {
+                _Keys.emplace_back().assign(_Size, 'k');
+            }
+
+            ::benchmark::DoNotOptimize(_Keys.data());
+            _State.PauseTiming();
+            for (const auto& _Key : _Keys) { // keys that don't fit in the object are stored on the heap
+                const char* const _Obj = reinterpret_cast<const char*>(&_Key);
+                if (_Key.data() < _Obj || _Key.data() >= _Obj + sizeof(_Key)) {
+                    ++_Allocations;
+                    _Bytes += _Key.capacity() + 1;
+                }
+            }
+
+            _State.ResumeTiming();
+            _Keys.clear();
+        }
+
+        const double _Keys_built          = static_cast<double>(_State.iterations() * _Count);
+        _State.counters["allocs_per_key"] = static_cast<double>(_Allocations) / _Keys_built;
+        _State.counters["bytes_per_key"] =
+            sizeof(small_utf8_string<_InlineBytes>) + static_cast<double>(_Bytes) / _Keys_built;
+        _State.SetItemsProcessed(static_cast<int64_t>(_Keys_built));
+    }
+
+    template <class _Str>
+    void bm_build_header_names(::benchmark::State& _State) {
+        // formats "x-<prefix>-<index>" header names, the typical short string built on a hot path
+        const utf8_string_view _Prefixes[] = {"request-id", "forwarded-for", "trace", "span"};
+        size_t _Index                      = 0;
+        for (const auto& _Step : _State) {
+            _Str _Name = "x-";
+            _Name.append(_Prefixes[_Index % 4]);
+            _Name.push_back('-');
+            _Name.append(static_cast<size_t>(_Index % 10) + 1, static_cast<char>('0' + _Index % 10));
+            ::benchmark::DoNotOptimize(_Name.data());
+            ++_Index;
+        }
+
+        _State.SetItemsProcessed(static_cast<int64_t>(_State.iterations()));
+    }
+
+    void bm_utf8_string_concat(::benchmark::State& _State) {
+        // joins a path from three parts of the given size and two separators in one expression,
+        // with operator+ (0) or concat() (1)
+        const size_t _Size       = static_cast<size_t>(_State.range(0));
+        const bool _Use_function = _State.range(1) != 0;
+        const utf8_string _Root(_Size, 'r');
+        const utf8_string _Dir(_Size, 'd');
+        const utf8_string _File(_Size, 'f');
+        for (const auto& _Step : _State) {
+            const utf8_string _Path =
+                _Use_function ? concat(_Root, '/', _Dir, '/', _File) : _Root + '/' + _Dir + '/' + _File;
+            ::benchmark::DoNotOptimize(_Path.data());
+        }
+
+        _State.SetBytesProcessed(static_cast<int64_t>(_State.iterations() * (3 * _Size + 2)));
+    }
+} // namespace mjx
+
+void set_benchmark_properties(auto* const _Benchmark) {
+    // targets from 1 KB to 64 MB
+    _Benchmark->RangeMultiplier(8)->Range(1 << 10, 64 << 20)->Unit(::benchmark::TimeUnit::kMicrosecond);
+}
+
+BENCHMARK(::mjx::bm_utf8_string_push_back)->Apply(set_benchmark_properties);
+BENCHMARK(::mjx::bm_utf8_string_append)->Apply(set_benchmark_properties);
+BENCHMARK(::mjx::bm_utf8_string_append_reserved)->Apply(set_benchmark_properties);
+BENCHMARK(::mjx::bm_utf8_string_builder_append)->Apply(set_benchmark_properties);
+
+// loops from 1 KB to 1 MB
+BENCHMARK(::mjx::bm_utf8_string_index_loop)->RangeMultiplier(8)->Range(1 << 10, 1 << 20);
+BENCHMARK(::mjx::bm_utf8_string_iterator_loop)->RangeMultiplier(8)->Range(1 << 10, 1 << 20);
+BENCHMARK(::mjx::bm_utf8_string_view_index_loop)->RangeMultiplier(8)->Range(1 << 10, 1 << 20);
+
+// 100 and 10000 strings per request, global allocator (0) and arena (1)
+BENCHMARK(::mjx::bm_utf8_string_short_lived)->ArgNames({"strings", "arena"})->ArgsProduct({{100, 10'000}, {0, 1}});
+
+// keys up to 16, 32 and 64 characters, default small buffer and 64 inline bytes
+BENCHMARK(::mjx::bm_utf8_string_keys<3 * sizeof(void*)>)->ArgName("max_size")->Arg(16)->Arg(32)->Arg(64);
+BENCHMARK(::mjx::bm_utf8_string_keys<64>)->ArgName("max_size")->Arg(16)->Arg(32)->Arg(64);
+
+// header names built in string and static_string
+BENCHMARK(::mjx::bm_build_header_names<::mjx::utf8_string>);
+BENCHMARK(::mjx::bm_build_header_names<::mjx::static_utf8_string<32>>);
+
+// concatenation of parts with 8, 64 and 512 characters, operator+ (0) and concat() (1)
+BENCHMARK(::mjx::bm_utf8_string_concat)->ArgNames({"part_size", "concat"})->ArgsProduct({{8, 64, 512}, {0, 1}});
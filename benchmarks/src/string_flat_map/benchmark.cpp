@@ -0,0 +1,108 @@
+// benchmark.cpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <mjstr/hash.hpp>
+#include <mjstr/string.hpp>
+#include <mjstr/string_flat_map.hpp>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace mjx {
+    // the baseline, transparent so that both maps are probed with views
+    using bm_std_map  = ::std::unordered_map<utf8_string, uint32_t, utf8_string_hash, utf8_string_equal>;
+    using bm_flat_map = utf8_string_flat_map<uint32_t>;
+
+    const ::std::vector<utf8_string>& bm_keys(const size_t _Count) {
+        // session-like keys, the same ones for all benchmarks of the given size
+        static size_t _Cached_count = 0;
+        static ::std::vector<utf8_string> _Keys;
+        if (_Cached_count != _Count) {
+            _Keys.clear();
+            _Keys.reserve(_Count);
+            for (size_t _Idx = 0; _Idx < _Count; ++_Idx) {
+                const ::std::string _Num = ::std::to_string(_Idx * 2654435761u % 1000000007u);
+                _Keys.push_back(utf8_string{"session:"} + utf8_string_view{_Num.data(), _Num.size()});
+            }
+
+            _Cached_count = _Count;
+        }
+
+        return _Keys;
+    }
+
+    template <class _Map>
+    void bm_insert(_Map& _Target, const ::std::vector<utf8_string>& _Keys) {
+        for (size_t _Idx = 0; _Idx < _Keys.size(); ++_Idx) {
+            _Target.try_emplace(_Keys[_Idx], static_cast<uint32_t>(_Idx));
+        }
+    }
+
+    template <class _Map>
+    void bm_map_find(::benchmark::State& _State) {
+        // looks up existing keys in a random order
+        const size_t _Count                     = static_cast<size_t>(_State.range(0));
+        const ::std::vector<utf8_string>& _Keys = bm_keys(_Count);
+        _Map _Target;
+        bm_insert(_Target, _Keys);
+        ::std::vector<utf8_string_view> _Probes(_Keys.begin(), _Keys.end());
+        ::std::shuffle(_Probes.begin(), _Probes.end(), ::std::mt19937_64{42});
+        size_t _Index = 0;
+        for (const auto& _Step : _State) {
+            ::benchmark::DoNotOptimize(_Target.find(_Probes[_Index]));
+            if (++_Index == _Probes.size()) {
+                _Index = 0;
+            }
+        }
+
+        _State.SetItemsProcessed(static_cast<int64_t>(_State.iterations()));
+    }
+
+    template <class _Map>
+    void bm_map_find_missing(::benchmark::State& _State) {
+        // looks up keys that are not in the map
+        const size_t _Count                     = static_cast<size_t>(_State.range(0));
+        const ::std::vector<utf8_string>& _Keys = bm_keys(_Count);
+        _Map _Target;
+        bm_insert(_Target, _Keys);
+        ::std::vector<utf8_string> _Probes;
+        for (size_t _Idx = 0; _Idx < 4096; ++_Idx) {
+            _Probes.push_back(utf8_string{"missing:"} + _Keys[_Idx % _Keys.size()]);
+        }
+
+        size_t _Index = 0;
+        for (const auto& _Step : _State) {
+            ::benchmark::DoNotOptimize(_Target.find(_Probes[_Index++ % _Probes.size()]));
+        }
+
+        _State.SetItemsProcessed(static_cast<int64_t>(_State.iterations()));
+    }
+
+    template <class _Map>
+    void bm_map_build(::benchmark::State& _State) {
+        // inserts all keys into an empty map
+        const size_t _Count                     = static_cast<size_t>(_State.range(0));
+        const ::std::vector<utf8_string>& _Keys = bm_keys(_Count);
+        for (const auto& _Step : _State) {
+            _Map _Target;
+            bm_insert(_Target, _Keys);
+            ::benchmark::DoNotOptimize(_Target.size());
+        }
+
+        _State.SetItemsProcessed(static_cast<int64_t>(_State.iterations()) * static_cast<int64_t>(_Count));
+    }
+} // namespace mjx
+
+// Note: 100M entries take more than 10 GB with std::unordered_map, add the size manually if needed.
+BENCHMARK(::mjx::bm_map_find<::mjx::bm_flat_map>)->RangeMultiplier(10)->Range(10'000, 10'000'000);
+BENCHMARK(::mjx::bm_map_find<::mjx::bm_std_map>)->RangeMultiplier(10)->Range(10'000, 10'000'000);
+BENCHMARK(::mjx::bm_map_find_missing<::mjx::bm_flat_map>)->RangeMultiplier(10)->Range(10'000, 10'000'000);
+BENCHMARK(::mjx::bm_map_find_missing<::mjx::bm_std_map>)->RangeMultiplier(10)->Range(10'000, 10'000'000);
+BENCHMARK(::mjx::bm_map_build<::mjx::bm_flat_map>)->RangeMultiplier(10)->Range(10'000, 1'000'000);
+BENCHMARK(::mjx::bm_map_build<::mjx::bm_std_map>)->RangeMultiplier(10)->Range(10'000, 1'000'000);
\ No newline at end of file
@@ -0,0 +1,72 @@
+// benchmark.cpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <mjstr/string.hpp>
+#include <mjstr/trim.hpp>
+#include <vector>
+
+namespace mjx {
+    const ::std::vector<utf8_string>& bm_fields() {
+        // fixed-width fields, the values are padded with spaces on both sides
+        static const ::std::vector<utf8_string> _Fields = [] {
+            ::std::vector<utf8_string> _Result;
+            uint32_t _Seed = 0x1234'5678;
+            for (size_t _Idx = 0; _Idx < 4096; ++_Idx) {
+                _Seed              = _Seed * 1'103'515'245 + 12'345;
+                const size_t _Size = (_Seed >> 16) % 24 + 1;
+                const size_t _Left = (_Seed >> 8) % 40;
+                _Result.push_back(utf8_string(_Left, ' ') + utf8_string(_Size, 'x') + utf8_string(64 - _Left, ' '));
+            }
+
+            return _Result;
+        }();
+        return _Fields;
+    }
+
+    void bm_trim(::benchmark::State& _State) {
+        const ::std::vector<utf8_string>& _Fields = bm_fields();
+        for (const auto& _Step : _State) {
+            size_t _Total = 0;
+            for (const utf8_string& _Field : _Fields) {
+                _Total += trim(_Field).size();
+            }
+
+            ::benchmark::DoNotOptimize(_Total);
+        }
+
+        _State.SetItemsProcessed(static_cast<int64_t>(_State.iterations()) * static_cast<int64_t>(_Fields.size()));
+    }
+
+    void bm_trim_scalar(::benchmark::State& _State) {
+        // the common hand-written loop that checks one character at a time
+        const ::std::vector<utf8_string>& _Fields = bm_fields();
+        for (const auto& _Step : _State) {
+            size_t _Total = 0;
+            for (const utf8_string& _Field : _Fields) {
+                const utf8_string_view _View = _Field;
+                size_t _First                = 0;
+                size_t _Last                 = _View.size();
+                while (_First < _Last && is_ascii_whitespace(_View[_First])) {
+                    ++_First;
+                }
+
+                while (_Last > _First && is_ascii_whitespace(_View[_Last - 1])) {
+                    --_Last;
+                }
+
+                _Total += _Last - _First;
+            }
+
+            ::benchmark::DoNotOptimize(_Total);
+        }
+
+        _State.SetItemsProcessed(static_cast<int64_t>(_State.iterations()) * static_cast<int64_t>(_Fields.size()));
+    }
+} // namespace mjx
+
+BENCHMARK(::mjx::bm_trim)->Unit(::benchmark::TimeUnit::kMicrosecond);
+BENCHMARK(::mjx::bm_trim_scalar)->Unit(::benchmark::TimeUnit::kMicrosecond);
\ No newline at end of file
@@ -17,4 +17,14 @@
 #else // ^^^ _MJX_WINDOWS ^^^ / vvv _MJX_LINUX vvv
 #define _MJSTR_API
 #endif // _MJX_WINDOWS
+
+// trivial members (accessors, iterator operations) are defined in headers if _MJSTR_INLINE_ACCESSORS
+// is defined, otherwise they are exported from the library like any other member
+#ifdef _MJSTR_INLINE_ACCESSORS
+#define _MJSTR_INLINE    inline
+#define _MJSTR_CONSTEXPR constexpr
+#else // ^^^ _MJSTR_INLINE_ACCESSORS ^^^ / vvv !_MJSTR_INLINE_ACCESSORS vvv
+#define _MJSTR_INLINE
+#define _MJSTR_CONSTEXPR
+#endif // _MJSTR_INLINE_ACCESSORS
 #endif // _MJSTR_API_HPP_
\ No newline at end of file
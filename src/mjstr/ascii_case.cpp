@@ -0,0 +1,147 @@
+// ascii_case.cpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <mjstr/ascii_case.hpp>
+#include <mjstr/impl/ascii_case.hpp>
+
+namespace mjx {
+    namespace mjstr_impl {
+        template <class _Elem>
+        string<_Elem> _Convert_ascii_case_copy(const string_view<_Elem> _Str, const bool _Upper) {
+            const size_t _Size = _Str.size();
+            string<_Elem> _Result;
+            _Result.reserve(_Size); // the only allocation, may throw
+            _Result.resize_uninitialized(_Size);
+            _Convert_ascii_case(_Str.data(), _Size, _Result.data(), _Upper);
+            return _Result;
+        }
+
+        template <class _Elem>
+        bool _Equal_ascii_icase(const string_view<_Elem> _Left, const string_view<_Elem> _Right) noexcept {
+            const size_t _Size = _Left.size();
+            return _Size == _Right.size() && _Mismatch_ascii_icase(_Left.data(), _Right.data(), _Size) == _Size;
+        }
+
+        template <class _Elem>
+        size_t _Find_ascii_icase_from(
+            const string_view<_Elem> _Haystack, const string_view<_Elem> _Needle, const size_t _Off) noexcept {
+            const size_t _Haystack_size = _Haystack.size();
+            const size_t _Needle_size   = _Needle.size();
+            if (_Off > _Haystack_size) { // the search starts past the end
+                return static_cast<size_t>(-1);
+            }
+
+            if (_Needle_size == 0) { // an empty needle is found at the starting offset
+                return _Off;
+            }
+
+            const size_t _Pos =
+                _Find_ascii_icase(_Haystack.data() + _Off, _Haystack_size - _Off, _Needle.data(), _Needle_size);
+            return _Pos != static_cast<size_t>(-1) ? _Off + _Pos : _Pos;
+        }
+
+        template <class _Elem>
+        bool _Starts_with_ascii_icase(const string_view<_Elem> _Str, const string_view<_Elem> _Prefix) noexcept {
+            const size_t _Size = _Prefix.size();
+            return _Str.size() >= _Size && _Mismatch_ascii_icase(_Str.data(), _Prefix.data(), _Size) == _Size;
+        }
+    } // namespace mjstr_impl
+
+    void to_ascii_lower(byte_t* const _Ptr, const size_t _Count) noexcept {
+        mjstr_impl::_Convert_ascii_case(_Ptr, _Count, _Ptr, false);
+    }
+
+    void to_ascii_lower(char* const _Ptr, const size_t _Count) noexcept {
+        mjstr_impl::_Convert_ascii_case(_Ptr, _Count, _Ptr, false);
+    }
+
+    void to_ascii_lower(wchar_t* const _Ptr, const size_t _Count) noexcept {
+        mjstr_impl::_Convert_ascii_case(_Ptr, _Count, _Ptr, false);
+    }
+
+    void to_ascii_upper(byte_t* const _Ptr, const size_t _Count) noexcept {
+        mjstr_impl::_Convert_ascii_case(_Ptr, _Count, _Ptr, true);
+    }
+
+    void to_ascii_upper(char* const _Ptr, const size_t _Count) noexcept {
+        mjstr_impl::_Convert_ascii_case(_Ptr, _Count, _Ptr, true);
+    }
+
+    void to_ascii_upper(wchar_t* const _Ptr, const size_t _Count) noexcept {
+        mjstr_impl::_Convert_ascii_case(_Ptr, _Count, _Ptr, true);
+    }
+
+    byte_string to_ascii_lower(const byte_string_view _Str) {
+        return mjstr_impl::_Convert_ascii_case_copy(_Str, false);
+    }
+
+    utf8_string to_ascii_lower(const utf8_string_view _Str) {
+        return mjstr_impl::_Convert_ascii_case_copy(_Str, false);
+    }
+
+    unicode_string to_ascii_lower(const unicode_string_view _Str) {
+        return mjstr_impl::_Convert_ascii_case_copy(_Str, false);
+    }
+
+    byte_string to_ascii_upper(const byte_string_view _Str) {
+        return mjstr_impl::_Convert_ascii_case_copy(_Str, true);
+    }
+
+    utf8_string to_ascii_upper(const utf8_string_view _Str) {
+        return mjstr_impl::_Convert_ascii_case_copy(_Str, true);
+    }
+
+    unicode_string to_ascii_upper(const unicode_string_view _Str) {
+        return mjstr_impl::_Convert_ascii_case_copy(_Str, true);
+    }
+
+    bool iequals(const byte_string_view _Left, const byte_string_view _Right) noexcept {
+        return mjstr_impl::_Equal_ascii_icase(_Left, _Right);
+    }
+
+    bool iequals(const utf8_string_view _Left, const utf8_string_view _Right) noexcept {
+        return mjstr_impl::_Equal_ascii_icase(_Left, _Right);
+    }
+
+    bool iequals(const unicode_string_view _Left, const unicode_string_view _Right) noexcept {
+        return mjstr_impl::_Equal_ascii_icase(_Left, _Right);
+    }
+
+    int icompare(const byte_string_view _Left, const byte_string_view _Right) noexcept {
+        return mjstr_impl::_Compare_ascii_icase(_Left.data(), _Left.size(), _Right.data(), _Right.size());
+    }
+
+    int icompare(const utf8_string_view _Left, const utf8_string_view _Right) noexcept {
+        return mjstr_impl::_Compare_ascii_icase(_Left.data(), _Left.size(), _Right.data(), _Right.size());
+    }
+
+    int icompare(const unicode_string_view _Left, const unicode_string_view _Right) noexcept {
+        return mjstr_impl::_Compare_ascii_icase(_Left.data(), _Left.size(), _Right.data(), _Right.size());
+    }
+
+    size_t ifind(const byte_string_view _Haystack, const byte_string_view _Needle, const size_t _Off) noexcept {
+        return mjstr_impl::_Find_ascii_icase_from(_Haystack, _Needle, _Off);
+    }
+
+    size_t ifind(const utf8_string_view _Haystack, const utf8_string_view _Needle, const size_t _Off) noexcept {
+        return mjstr_impl::_Find_ascii_icase_from(_Haystack, _Needle, _Off);
+    }
+
+    size_t ifind(const unicode_string_view _Haystack, const unicode_string_view _Needle, const size_t _Off) noexcept {
+        return mjstr_impl::_Find_ascii_icase_from(_Haystack, _Needle, _Off);
+    }
+
+    bool istarts_with(const byte_string_view _Str, const byte_string_view _Prefix) noexcept {
+        return mjstr_impl::_Starts_with_ascii_icase(_Str, _Prefix);
+    }
+
+    bool istarts_with(const utf8_string_view _Str, const utf8_string_view _Prefix) noexcept {
+        return mjstr_impl::_Starts_with_ascii_icase(_Str, _Prefix);
+    }
+
+    bool istarts_with(const unicode_string_view _Str, const unicode_string_view _Prefix) noexcept {
+        return mjstr_impl::_Starts_with_ascii_icase(_Str, _Prefix);
+    }
+} // namespace mjx
\ No newline at end of file
@@ -0,0 +1,74 @@
+// ascii_case.hpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#ifndef _MJSTR_ASCII_CASE_HPP_
+#define _MJSTR_ASCII_CASE_HPP_
+#include <cstddef>
+#include <mjstr/api.hpp>
+#include <mjstr/string.hpp>
+#include <mjstr/string_view.hpp>
+
+namespace mjx {
+    // Note: Only the ASCII letters 'A'...'Z' and 'a'...'z' are converted or folded, every other character
+    //       (including non-ASCII letters) is left unchanged and compared exactly. The functions are locale
+    //       independent, which makes them suitable for protocol elements like HTTP header names.
+
+    // converts the ASCII letters to lowercase in place
+    _MJSTR_API void to_ascii_lower(byte_t* const _Ptr, const size_t _Count) noexcept;
+    _MJSTR_API void to_ascii_lower(char* const _Ptr, const size_t _Count) noexcept;
+    _MJSTR_API void to_ascii_lower(wchar_t* const _Ptr, const size_t _Count) noexcept;
+
+    template <class _Elem, size_t _InlineBytes>
+    inline void to_ascii_lower(string<_Elem, _InlineBytes>& _Str) noexcept {
+        to_ascii_lower(_Str.data(), _Str.size());
+    }
+
+    // converts the ASCII letters to uppercase in place
+    _MJSTR_API void to_ascii_upper(byte_t* const _Ptr, const size_t _Count) noexcept;
+    _MJSTR_API void to_ascii_upper(char* const _Ptr, const size_t _Count) noexcept;
+    _MJSTR_API void to_ascii_upper(wchar_t* const _Ptr, const size_t _Count) noexcept;
+
+    template <class _Elem, size_t _InlineBytes>
+    inline void to_ascii_upper(string<_Elem, _InlineBytes>& _Str) noexcept {
+        to_ascii_upper(_Str.data(), _Str.size());
+    }
+
+    // returns a copy with the ASCII letters converted to lowercase
+    _MJSTR_API byte_string to_ascii_lower(const byte_string_view _Str);
+    _MJSTR_API utf8_string to_ascii_lower(const utf8_string_view _Str);
+    _MJSTR_API unicode_string to_ascii_lower(const unicode_string_view _Str);
+
+    // returns a copy with the ASCII letters converted to uppercase
+    _MJSTR_API byte_string to_ascii_upper(const byte_string_view _Str);
+    _MJSTR_API utf8_string to_ascii_upper(const utf8_string_view _Str);
+    _MJSTR_API unicode_string to_ascii_upper(const unicode_string_view _Str);
+
+    // checks whether two views are equal, ignoring the case of ASCII letters
+    _MJSTR_API bool iequals(const byte_string_view _Left, const byte_string_view _Right) noexcept;
+    _MJSTR_API bool iequals(const utf8_string_view _Left, const utf8_string_view _Right) noexcept;
+    _MJSTR_API bool iequals(const unicode_string_view _Left, const unicode_string_view _Right) noexcept;
+
+    // compares two views lexicographically after converting the ASCII letters to lowercase,
+    // returns a negative value, zero or a positive value
+    _MJSTR_API int icompare(const byte_string_view _Left, const byte_string_view _Right) noexcept;
+    _MJSTR_API int icompare(const utf8_string_view _Left, const utf8_string_view _Right) noexcept;
+    _MJSTR_API int icompare(const unicode_string_view _Left, const unicode_string_view _Right) noexcept;
+
+    // finds the first occurrence of _Needle at or after _Off, ignoring the case of ASCII letters
+    _MJSTR_API size_t ifind(
+        const byte_string_view _Haystack, const byte_string_view _Needle, const size_t _Off = 0) noexcept;
+    _MJSTR_API size_t ifind(
+        const utf8_string_view _Haystack, const utf8_string_view _Needle, const size_t _Off = 0) noexcept;
+    _MJSTR_API size_t ifind(
+        const unicode_string_view _Haystack, const unicode_string_view _Needle, const size_t _Off = 0) noexcept;
+
+    // checks whether _Str starts with _Prefix, ignoring the case of ASCII letters
+    _MJSTR_API bool istarts_with(const byte_string_view _Str, const byte_string_view _Prefix) noexcept;
+    _MJSTR_API bool istarts_with(const utf8_string_view _Str, const utf8_string_view _Prefix) noexcept;
+    _MJSTR_API bool istarts_with(const unicode_string_view _Str, const unicode_string_view _Prefix) noexcept;
+} // namespace mjx
+
+#endif // _MJSTR_ASCII_CASE_HPP_
\ No newline at end of file
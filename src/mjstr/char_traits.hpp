@@ -56,7 +56,22 @@ namespace mjx {
             const char_type* const _Haystack,const size_t _Haystack_size, const char_type _Needle) noexcept;
         static size_t rfind(const char_type* const _Haystack, const size_t _Haystack_size,
             const char_type* const _Needle, const size_t _Needle_size) noexcept;
+
+        // finds the first character that is (or isn't) one of the _Set_size characters
+        static size_t find_first_of(const char_type* const _Haystack, const size_t _Haystack_size,
+            const char_type* const _Set, const size_t _Set_size) noexcept;
+        static size_t find_first_not_of(const char_type* const _Haystack, const size_t _Haystack_size,
+            const char_type* const _Set, const size_t _Set_size) noexcept;
+
+        // finds the last character that is (or isn't) one of the _Set_size characters
+        static size_t find_last_of(const char_type* const _Haystack, const size_t _Haystack_size,
+            const char_type* const _Set, const size_t _Set_size) noexcept;
+        static size_t find_last_not_of(const char_type* const _Haystack, const size_t _Haystack_size,
+            const char_type* const _Set, const size_t _Set_size) noexcept;
     };
 } // namespace mjx
 
+#ifdef _MJSTR_INLINE_ACCESSORS
+#include <mjstr/impl/char_traits_inline.hpp>
+#endif // _MJSTR_INLINE_ACCESSORS
 #endif // _MJSTR_CHAR_TRAITS_HPP_
\ No newline at end of file
@@ -7,6 +7,14 @@
 #include <mjstr/impl/conversion.hpp>
 
 namespace mjx {
+    utf8_validation_result validate_utf8(const byte_string_view _Str) noexcept {
+        return mjstr_impl::_Validate_utf8(_Str.data(), _Str.size());
+    }
+
+    utf8_validation_result validate_utf8(const utf8_string_view _Str) noexcept {
+        return mjstr_impl::_Validate_utf8(_Str.data(), _Str.size());
+    }
+
     size_t to_byte_string_length(const utf8_string_view _Str) noexcept {
         return _Str.size();
     }
@@ -54,4 +62,58 @@ namespace mjx {
     unicode_string to_unicode_string(const utf8_string_view _Str) {
         return mjstr_impl::_Convert_string<wchar_t>(_Str.data(), _Str.size());
     }
+
+    conversion_result convert_into(
+        const utf8_string_view _Str, byte_t* const _Dest, const size_t _Capacity) noexcept {
+        return mjstr_impl::_Convert_into(_Str, _Dest, _Capacity);
+    }
+
+    conversion_result convert_into(
+        const unicode_string_view _Str, byte_t* const _Dest, const size_t _Capacity) noexcept {
+        return mjstr_impl::_Convert_into(_Str, _Dest, _Capacity);
+    }
+
+    conversion_result convert_into(
+        const byte_string_view _Str, char* const _Dest, const size_t _Capacity) noexcept {
+        return mjstr_impl::_Convert_into(_Str, _Dest, _Capacity);
+    }
+
+    conversion_result convert_into(
+        const unicode_string_view _Str, char* const _Dest, const size_t _Capacity) noexcept {
+        return mjstr_impl::_Convert_into(_Str, _Dest, _Capacity);
+    }
+
+    conversion_result convert_into(
+        const byte_string_view _Str, wchar_t* const _Dest, const size_t _Capacity) noexcept {
+        return mjstr_impl::_Convert_into(_Str, _Dest, _Capacity);
+    }
+
+    conversion_result convert_into(
+        const utf8_string_view _Str, wchar_t* const _Dest, const size_t _Capacity) noexcept {
+        return mjstr_impl::_Convert_into(_Str, _Dest, _Capacity);
+    }
+
+    conversion_result convert_into(const utf8_string_view _Str, byte_string& _Dest) noexcept {
+        return mjstr_impl::_Convert_into_string(_Str, _Dest);
+    }
+
+    conversion_result convert_into(const unicode_string_view _Str, byte_string& _Dest) noexcept {
+        return mjstr_impl::_Convert_into_string(_Str, _Dest);
+    }
+
+    conversion_result convert_into(const byte_string_view _Str, utf8_string& _Dest) noexcept {
+        return mjstr_impl::_Convert_into_string(_Str, _Dest);
+    }
+
+    conversion_result convert_into(const unicode_string_view _Str, utf8_string& _Dest) noexcept {
+        return mjstr_impl::_Convert_into_string(_Str, _Dest);
+    }
+
+    conversion_result convert_into(const byte_string_view _Str, unicode_string& _Dest) noexcept {
+        return mjstr_impl::_Convert_into_string(_Str, _Dest);
+    }
+
+    conversion_result convert_into(const utf8_string_view _Str, unicode_string& _Dest) noexcept {
+        return mjstr_impl::_Convert_into_string(_Str, _Dest);
+    }
 } // namespace mjx
\ No newline at end of file
@@ -11,6 +11,37 @@
 #include <mjstr/string_view.hpp>
 
 namespace mjx {
+    enum class utf8_error : unsigned char {
+        none,
+        unexpected_continuation, // continuation byte without a leading byte
+        invalid_leading_byte, // byte that never appears in UTF-8 (F8...FF)
+        missing_continuation, // leading byte followed by a non-continuation byte
+        incomplete_sequence, // input ends in the middle of a sequence
+        overlong_encoding, // code point encoded with more bytes than required
+        surrogate, // encoded U+D800...U+DFFF
+        code_point_too_big // encoded code point above U+10FFFF
+    };
+
+    struct utf8_validation_result {
+        size_t offset; // offset of the first invalid sequence, or the input size if valid
+        utf8_error error;
+    };
+
+    enum class conversion_status : unsigned char {
+        ok, // the whole input has been converted
+        destination_full, // the next character doesn't fit in the destination
+        invalid_input // the input contains an invalid sequence or character at offset 'read'
+    };
+
+    struct conversion_result {
+        size_t read; // number of consumed input characters
+        size_t written; // number of written output characters
+        conversion_status status;
+    };
+
+    _MJSTR_API utf8_validation_result validate_utf8(const byte_string_view _Str) noexcept;
+    _MJSTR_API utf8_validation_result validate_utf8(const utf8_string_view _Str) noexcept;
+
     _MJSTR_API size_t to_byte_string_length(const utf8_string_view _Str) noexcept;
     _MJSTR_API size_t to_byte_string_length(const unicode_string_view _Str) noexcept;
     
@@ -28,6 +59,32 @@ namespace mjx {
 
     _MJSTR_API unicode_string to_unicode_string(const byte_string_view _Str);
     _MJSTR_API unicode_string to_unicode_string(const utf8_string_view _Str);
+
+    // converts into a caller-supplied buffer, never splits a character and never allocates
+    _MJSTR_API conversion_result convert_into(
+        const utf8_string_view _Str, byte_t* const _Dest, const size_t _Capacity) noexcept;
+    _MJSTR_API conversion_result convert_into(
+        const unicode_string_view _Str, byte_t* const _Dest, const size_t _Capacity) noexcept;
+
+    _MJSTR_API conversion_result convert_into(
+        const byte_string_view _Str, char* const _Dest, const size_t _Capacity) noexcept;
+    _MJSTR_API conversion_result convert_into(
+        const unicode_string_view _Str, char* const _Dest, const size_t _Capacity) noexcept;
+
+    _MJSTR_API conversion_result convert_into(
+        const byte_string_view _Str, wchar_t* const _Dest, const size_t _Capacity) noexcept;
+    _MJSTR_API conversion_result convert_into(
+        const utf8_string_view _Str, wchar_t* const _Dest, const size_t _Capacity) noexcept;
+
+    // converts into the spare capacity of _Dest and appends the converted characters
+    _MJSTR_API conversion_result convert_into(const utf8_string_view _Str, byte_string& _Dest) noexcept;
+    _MJSTR_API conversion_result convert_into(const unicode_string_view _Str, byte_string& _Dest) noexcept;
+
+    _MJSTR_API conversion_result convert_into(const byte_string_view _Str, utf8_string& _Dest) noexcept;
+    _MJSTR_API conversion_result convert_into(const unicode_string_view _Str, utf8_string& _Dest) noexcept;
+
+    _MJSTR_API conversion_result convert_into(const byte_string_view _Str, unicode_string& _Dest) noexcept;
+    _MJSTR_API conversion_result convert_into(const utf8_string_view _Str, unicode_string& _Dest) noexcept;
 } // namespace mjx
 
 #endif // _MJSTR_CONVERSION_HPP_
\ No newline at end of file
@@ -0,0 +1,21 @@
+// hash.cpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <mjstr/hash.hpp>
+#include <mjstr/impl/hash_long.hpp>
+
+namespace mjx {
+    namespace mjstr_impl {
+        uint64_t _Hash_bytes(const void* const _Data, const size_t _Size, const uint64_t _Seed) noexcept {
+            const unsigned char* const _Ptr = static_cast<const unsigned char*>(_Data);
+            if (_Size <= _Hash_long_threshold) {
+                return _Hash_short(_Ptr, _Size, _Seed);
+            }
+
+            static const _Accumulate_fn _Accumulate = _Select_accumulate();
+            return _Hash_long(_Ptr, _Size, _Seed, _Accumulate);
+        }
+    } // namespace mjstr_impl
+} // namespace mjx
\ No newline at end of file
@@ -0,0 +1,79 @@
+// hash.hpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#ifndef _MJSTR_HASH_HPP_
+#define _MJSTR_HASH_HPP_
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mjstr/api.hpp>
+#include <mjstr/char_traits.hpp>
+#include <mjstr/impl/hash.hpp>
+#include <mjstr/string.hpp>
+#include <mjstr/string_view.hpp>
+
+namespace mjx {
+    // Note: The hash depends only on the characters (and the seed), so a string, its view and a small string
+    //       with the same contents have the same hash. It isn't stable across library versions or platforms
+    //       and isn't suitable for cryptographic purposes.
+    inline uint64_t hash(const byte_string_view _Str, const uint64_t _Seed = 0) noexcept {
+        return mjstr_impl::_Hash_bytes_inline(_Str.data(), _Str.size(), _Seed);
+    }
+
+    inline uint64_t hash(const utf8_string_view _Str, const uint64_t _Seed = 0) noexcept {
+        return mjstr_impl::_Hash_bytes_inline(_Str.data(), _Str.size(), _Seed);
+    }
+
+    inline uint64_t hash(const unicode_string_view _Str, const uint64_t _Seed = 0) noexcept {
+        return mjstr_impl::_Hash_bytes_inline(_Str.data(), _Str.size() * sizeof(wchar_t), _Seed);
+    }
+
+    template <class _Elem>
+    struct string_hash { // transparent hasher, strings can be looked up by views without allocating
+        static_assert(compatible_element<_Elem>, "invalid element type for string_hash<CharT>");
+
+        using is_transparent = void;
+
+        size_t operator()(const string_view<_Elem> _Str) const noexcept {
+            return static_cast<size_t>(::mjx::hash(_Str));
+        }
+    };
+
+    template <class _Elem>
+    struct string_equal { // transparent equality, used together with string_hash<CharT>
+        static_assert(compatible_element<_Elem>, "invalid element type for string_equal<CharT>");
+
+        using is_transparent = void;
+
+        bool operator()(const string_view<_Elem> _Left, const string_view<_Elem> _Right) const noexcept {
+            return _Left == _Right;
+        }
+    };
+
+    using byte_string_hash    = string_hash<byte_t>;
+    using utf8_string_hash    = string_hash<char>;
+    using unicode_string_hash = string_hash<wchar_t>;
+
+    using byte_string_equal    = string_equal<byte_t>;
+    using utf8_string_equal    = string_equal<char>;
+    using unicode_string_equal = string_equal<wchar_t>;
+} // namespace mjx
+
+template <class _Elem, size_t _InlineBytes>
+struct std::hash<::mjx::string<_Elem, _InlineBytes>> {
+    size_t operator()(const ::mjx::string<_Elem, _InlineBytes>& _Str) const noexcept {
+        return static_cast<size_t>(::mjx::mjstr_impl::_Hash_bytes_inline(_Str.data(), _Str.size() * sizeof(_Elem), 0));
+    }
+};
+
+template <class _Elem>
+struct std::hash<::mjx::string_view<_Elem>> {
+    size_t operator()(const ::mjx::string_view<_Elem> _Str) const noexcept {
+        return static_cast<size_t>(::mjx::hash(_Str));
+    }
+};
+
+#endif // _MJSTR_HASH_HPP_
\ No newline at end of file
@@ -0,0 +1,200 @@
+// ascii.hpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#ifndef _MJSTR_IMPL_ASCII_HPP_
+#define _MJSTR_IMPL_ASCII_HPP_
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <immintrin.h>
+#include <mjstr/impl/cpu.hpp>
+
+namespace mjx {
+    namespace mjstr_impl {
+        // Note: The ASCII kernels convert whole blocks of 16 (SSE2) or 32 (AVX2) characters at once.
+        //       A block that contains a non-ASCII character is still converted entirely, but only
+        //       the characters before the first non-ASCII one are reported as converted, so the buffer
+        //       must be able to store at least _Size characters. Incomplete blocks are left to the caller.
+
+        inline constexpr size_t _Ascii_block_sse2 = 16;
+        inline constexpr size_t _Ascii_block_avx2 = 32;
+
+        _MJSTR_TARGET_SSE2 inline void _Store_widened_sse2(wchar_t* const _Buf, const __m128i _Bytes) noexcept {
+            // zero-extends 16 bytes to 16 wide characters
+            const __m128i _Zero = _mm_setzero_si128();
+            const __m128i _Low  = _mm_unpacklo_epi8(_Bytes, _Zero);
+            const __m128i _High = _mm_unpackhi_epi8(_Bytes, _Zero);
+            if constexpr (sizeof(wchar_t) == 2) {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(_Buf), _Low);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(_Buf + 8), _High);
+            } else {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(_Buf), _mm_unpacklo_epi16(_Low, _Zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(_Buf + 4), _mm_unpackhi_epi16(_Low, _Zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(_Buf + 8), _mm_unpacklo_epi16(_High, _Zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(_Buf + 12), _mm_unpackhi_epi16(_High, _Zero));
+            }
+        }
+
+        template <class _Elem>
+        _MJSTR_TARGET_SSE2 size_t _Widen_ascii_sse2(
+            const _Elem* const _Bytes, const size_t _Size, wchar_t* const _Buf) noexcept {
+            size_t _Pos = 0;
+            for (; _Pos + _Ascii_block_sse2 <= _Size; _Pos += _Ascii_block_sse2) {
+                const __m128i _Block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Bytes + _Pos));
+                _Store_widened_sse2(_Buf + _Pos, _Block);
+                const uint32_t _Mask = static_cast<uint32_t>(_mm_movemask_epi8(_Block)); // non-ASCII bytes
+                if (_Mask != 0) {
+                    return _Pos + static_cast<size_t>(::std::countr_zero(_Mask));
+                }
+            }
+
+            return _Pos;
+        }
+
+        template <class _Elem>
+        _MJSTR_TARGET_AVX2 size_t _Widen_ascii_avx2(
+            const _Elem* const _Bytes, const size_t _Size, wchar_t* const _Buf) noexcept {
+            size_t _Pos = 0;
+            for (; _Pos + _Ascii_block_avx2 <= _Size; _Pos += _Ascii_block_avx2) {
+                const __m256i _Block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Bytes + _Pos));
+                const __m128i _Low   = _mm256_castsi256_si128(_Block);
+                const __m128i _High  = _mm256_extracti128_si256(_Block, 1);
+                wchar_t* const _Dest = _Buf + _Pos;
+                if constexpr (sizeof(wchar_t) == 2) {
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Dest), _mm256_cvtepu8_epi16(_Low));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Dest + 16), _mm256_cvtepu8_epi16(_High));
+                } else {
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Dest), _mm256_cvtepu8_epi32(_Low));
+                    _mm256_storeu_si256(
+                        reinterpret_cast<__m256i*>(_Dest + 8), _mm256_cvtepu8_epi32(_mm_srli_si128(_Low, 8)));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Dest + 16), _mm256_cvtepu8_epi32(_High));
+                    _mm256_storeu_si256(
+                        reinterpret_cast<__m256i*>(_Dest + 24), _mm256_cvtepu8_epi32(_mm_srli_si128(_High, 8)));
+                }
+
+                const uint32_t _Mask = static_cast<uint32_t>(_mm256_movemask_epi8(_Block)); // non-ASCII bytes
+                if (_Mask != 0) {
+                    return _Pos + static_cast<size_t>(::std::countr_zero(_Mask));
+                }
+            }
+
+            return _Pos;
+        }
+
+        template <class _Elem>
+        _MJSTR_TARGET_SSE2 size_t _Narrow_ascii_sse2(
+            const wchar_t* const _Chars, const size_t _Size, _Elem* const _Buf) noexcept {
+            const __m128i _Zero = _mm_setzero_si128();
+            size_t _Pos         = 0;
+            for (; _Pos + _Ascii_block_sse2 <= _Size; _Pos += _Ascii_block_sse2) {
+                const __m128i* const _Src = reinterpret_cast<const __m128i*>(_Chars + _Pos);
+                __m128i _Packed;
+                __m128i _Ascii; // 0xFF for every ASCII character
+                if constexpr (sizeof(wchar_t) == 2) {
+                    const __m128i _Not_ascii = _mm_set1_epi16(static_cast<short>(0xFF80));
+                    const __m128i _First     = _mm_loadu_si128(_Src);
+                    const __m128i _Second    = _mm_loadu_si128(_Src + 1);
+                    _Packed = _mm_packus_epi16(_First, _Second);
+                    _Ascii  = _mm_packs_epi16(_mm_cmpeq_epi16(_mm_and_si128(_First, _Not_ascii), _Zero),
+                        _mm_cmpeq_epi16(_mm_and_si128(_Second, _Not_ascii), _Zero));
+                } else {
+                    // the signed saturation keeps ASCII characters intact, other characters are detected below
+                    const __m128i _Not_ascii = _mm_set1_epi32(static_cast<int>(0xFFFF'FF80));
+                    const __m128i _First     = _mm_loadu_si128(_Src);
+                    const __m128i _Second    = _mm_loadu_si128(_Src + 1);
+                    const __m128i _Third     = _mm_loadu_si128(_Src + 2);
+                    const __m128i _Fourth    = _mm_loadu_si128(_Src + 3);
+                    _Packed = _mm_packus_epi16(_mm_packs_epi32(_First, _Second), _mm_packs_epi32(_Third, _Fourth));
+                    _Ascii  = _mm_packs_epi16(
+                        _mm_packs_epi32(_mm_cmpeq_epi32(_mm_and_si128(_First, _Not_ascii), _Zero),
+                            _mm_cmpeq_epi32(_mm_and_si128(_Second, _Not_ascii), _Zero)),
+                        _mm_packs_epi32(_mm_cmpeq_epi32(_mm_and_si128(_Third, _Not_ascii), _Zero),
+                            _mm_cmpeq_epi32(_mm_and_si128(_Fourth, _Not_ascii), _Zero)));
+                }
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(_Buf + _Pos), _Packed);
+                const uint32_t _Mask = static_cast<uint32_t>(_mm_movemask_epi8(_Ascii)) ^ 0xFFFF; // non-ASCII
+                if (_Mask != 0) {
+                    return _Pos + static_cast<size_t>(::std::countr_zero(_Mask));
+                }
+            }
+
+            return _Pos;
+        }
+
+        template <class _Elem>
+        _MJSTR_TARGET_AVX2 size_t _Narrow_ascii_avx2(
+            const wchar_t* const _Chars, const size_t _Size, _Elem* const _Buf) noexcept {
+            // Note: The AVX2 pack instructions work within 128-bit lanes, the results are reordered afterwards.
+            const __m256i _Zero = _mm256_setzero_si256();
+            size_t _Pos         = 0;
+            for (; _Pos + _Ascii_block_avx2 <= _Size; _Pos += _Ascii_block_avx2) {
+                const __m256i* const _Src = reinterpret_cast<const __m256i*>(_Chars + _Pos);
+                __m256i _Packed;
+                __m256i _Ascii; // 0xFF for every ASCII character
+                if constexpr (sizeof(wchar_t) == 2) {
+                    const __m256i _Not_ascii = _mm256_set1_epi16(static_cast<short>(0xFF80));
+                    const __m256i _First     = _mm256_loadu_si256(_Src);
+                    const __m256i _Second    = _mm256_loadu_si256(_Src + 1);
+                    _Packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(_First, _Second), 0b11'01'10'00);
+                    _Ascii  = _mm256_permute4x64_epi64(
+                        _mm256_packs_epi16(_mm256_cmpeq_epi16(_mm256_and_si256(_First, _Not_ascii), _Zero),
+                            _mm256_cmpeq_epi16(_mm256_and_si256(_Second, _Not_ascii), _Zero)), 0b11'01'10'00);
+                } else {
+                    const __m256i _Not_ascii = _mm256_set1_epi32(static_cast<int>(0xFFFF'FF80));
+                    const __m256i _Order     = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+                    const __m256i _First     = _mm256_loadu_si256(_Src);
+                    const __m256i _Second    = _mm256_loadu_si256(_Src + 1);
+                    const __m256i _Third     = _mm256_loadu_si256(_Src + 2);
+                    const __m256i _Fourth    = _mm256_loadu_si256(_Src + 3);
+                    _Packed = _mm256_permutevar8x32_epi32(_mm256_packus_epi16(
+                        _mm256_packs_epi32(_First, _Second), _mm256_packs_epi32(_Third, _Fourth)), _Order);
+                    _Ascii  = _mm256_permutevar8x32_epi32(_mm256_packs_epi16(
+                        _mm256_packs_epi32(_mm256_cmpeq_epi32(_mm256_and_si256(_First, _Not_ascii), _Zero),
+                            _mm256_cmpeq_epi32(_mm256_and_si256(_Second, _Not_ascii), _Zero)),
+                        _mm256_packs_epi32(_mm256_cmpeq_epi32(_mm256_and_si256(_Third, _Not_ascii), _Zero),
+                            _mm256_cmpeq_epi32(_mm256_and_si256(_Fourth, _Not_ascii), _Zero))), _Order);
+                }
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Buf + _Pos), _Packed);
+                const uint32_t _Mask = ~static_cast<uint32_t>(_mm256_movemask_epi8(_Ascii)); // non-ASCII
+                if (_Mask != 0) {
+                    return _Pos + static_cast<size_t>(::std::countr_zero(_Mask));
+                }
+            }
+
+            return _Pos;
+        }
+
+        template <class _Elem>
+        inline size_t _Widen_ascii(const _Elem* const _Bytes, const size_t _Size, wchar_t* const _Buf) noexcept {
+            // converts the leading ASCII bytes to wide characters, returns the number of converted bytes
+            switch (_Get_isa_level()) {
+            case _Isa_level::_Avx2:
+                return _Widen_ascii_avx2(_Bytes, _Size, _Buf);
+            case _Isa_level::_Sse2:
+                return _Widen_ascii_sse2(_Bytes, _Size, _Buf);
+            default:
+                return 0;
+            }
+        }
+
+        template <class _Elem>
+        inline size_t _Narrow_ascii(const wchar_t* const _Chars, const size_t _Size, _Elem* const _Buf) noexcept {
+            // converts the leading ASCII wide characters to bytes, returns the number of converted characters
+            switch (_Get_isa_level()) {
+            case _Isa_level::_Avx2:
+                return _Narrow_ascii_avx2(_Chars, _Size, _Buf);
+            case _Isa_level::_Sse2:
+                return _Narrow_ascii_sse2(_Chars, _Size, _Buf);
+            default:
+                return 0;
+            }
+        }
+    } // namespace mjstr_impl
+} // namespace mjx
+
+#endif // _MJSTR_IMPL_ASCII_HPP_
\ No newline at end of file
@@ -0,0 +1,560 @@
+// ascii_case.hpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#ifndef _MJSTR_IMPL_ASCII_CASE_HPP_
+#define _MJSTR_IMPL_ASCII_CASE_HPP_
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <immintrin.h>
+#include <mjstr/impl/cpu.hpp>
+#include <type_traits>
+
+namespace mjx {
+    namespace mjstr_impl {
+        // Note: The case kernels work on blocks of 16 (SSE2) or 32 (AVX2) bytes, so a block holds 16/32 narrow
+        //       characters or 8/16 (4/8 on Linux) wide characters. A character is changed only if it's in
+        //       the range 'A'...'Z' (or 'a'...'z'), the range is checked with a single signed comparison after
+        //       adding a bias. Wide characters outside of the ASCII range never fall into it, so the kernels
+        //       handle them as well. The last incomplete block overlaps with the previous one, which is safe
+        //       since the conversions are idempotent and the comparisons have no side effects.
+
+        inline constexpr size_t _Case_block_sse2 = 16;
+        inline constexpr size_t _Case_block_avx2 = 32;
+
+        inline constexpr uint32_t _Ascii_letter_count = 26;
+        inline constexpr uint32_t _Ascii_case_delta   = 'a' - 'A';
+
+        template <class _Elem>
+        constexpr _Elem _Shift_ascii_case(const _Elem _Ch, const _Elem _First, const uint32_t _Delta) noexcept {
+            // adds _Delta to _Ch if it's one of the 26 letters that start with _First
+            using _Unsigned      = ::std::make_unsigned_t<_Elem>;
+            const uint32_t _Code = static_cast<_Unsigned>(_Ch);
+            return _Code - static_cast<_Unsigned>(_First) < _Ascii_letter_count
+                     ? static_cast<_Elem>(_Code + _Delta) : _Ch;
+        }
+
+        template <class _Elem>
+        constexpr uint32_t _Fold_ascii_case(const _Elem _Ch) noexcept {
+            // returns the lowercase equivalent of _Ch, compared as an unsigned value
+            using _Unsigned      = ::std::make_unsigned_t<_Elem>;
+            const uint32_t _Code = static_cast<_Unsigned>(_Ch);
+            return _Code - 'A' < _Ascii_letter_count ? _Code + _Ascii_case_delta : _Code;
+        }
+
+        // Note: Narrow inputs shorter than one block are processed 8 bytes at a time (SWAR), the last word
+        //       overlaps with the previous one. Short inputs like HTTP header names mostly take this path.
+        inline constexpr size_t _Case_word_size = sizeof(uint64_t);
+
+        inline uint64_t _Load_case_word(const void* const _Ptr) noexcept {
+            uint64_t _Word;
+            ::memcpy(&_Word, _Ptr, sizeof(uint64_t));
+            return _Word;
+        }
+
+        inline uint64_t _Shift_ascii_case_word(
+            const uint64_t _Word, const unsigned char _First, const bool _Upper) noexcept {
+            // converts the 26 letters that start with _First in every byte, the bytes never carry into each other
+            constexpr uint64_t _Ones  = 0x0101'0101'0101'0101;
+            const uint64_t _Low       = _Word & (0x7F * _Ones);
+            const uint64_t _Not_below = _Low + (0x80 - _First) * _Ones; // the top bit is set if _Low >= _First
+            const uint64_t _Above     = _Low + (0x80 - _First - _Ascii_letter_count) * _Ones; // set if > the last
+            const uint64_t _Letters   = _Not_below & ~_Above & ~_Word & (0x80 * _Ones);
+            return _Upper ? _Word - (_Letters >> 2) : _Word + (_Letters >> 2); // 0x80 >> 2 is the case delta
+        }
+
+        inline void _Convert_ascii_case_swar(const unsigned char* const _Src, const size_t _Size,
+            unsigned char* const _Dest, const bool _Upper) noexcept {
+            // converts all _Size bytes, _Size must be at least one word
+            const unsigned char _First = _Upper ? 'a' : 'A';
+            size_t _Pos                = 0;
+            for (;;) {
+                if (_Pos + _Case_word_size > _Size) {
+                    if (_Pos == _Size) {
+                        return;
+                    }
+
+                    _Pos = _Size - _Case_word_size; // the last word overlaps with the converted bytes
+                }
+
+                const uint64_t _Word = _Shift_ascii_case_word(_Load_case_word(_Src + _Pos), _First, _Upper);
+                ::memcpy(_Dest + _Pos, &_Word, sizeof(uint64_t));
+                _Pos += _Case_word_size;
+            }
+        }
+
+        inline size_t _Mismatch_ascii_icase_swar(
+            const unsigned char* const _Left, const unsigned char* const _Right, const size_t _Size) noexcept {
+            // returns the offset of the first byte that differs after folding, or _Size if there is none,
+            // _Size must be at least one word
+            size_t _Pos = 0;
+            for (;;) {
+                if (_Pos + _Case_word_size > _Size) {
+                    if (_Pos == _Size) {
+                        return _Size;
+                    }
+
+                    _Pos = _Size - _Case_word_size; // the last word overlaps with the compared bytes
+                }
+
+                const uint64_t _Diff = _Shift_ascii_case_word(_Load_case_word(_Left + _Pos), 'A', false)
+                                     ^ _Shift_ascii_case_word(_Load_case_word(_Right + _Pos), 'A', false);
+                if (_Diff != 0) { // the words are loaded in little-endian order
+                    return _Pos + static_cast<size_t>(::std::countr_zero(_Diff)) / 8;
+                }
+
+                _Pos += _Case_word_size;
+            }
+        }
+
+        template <class _Elem>
+        constexpr uint32_t _Sign_bit_of() noexcept {
+            return uint32_t{1} << (sizeof(_Elem) * 8 - 1);
+        }
+
+        template <class _Elem>
+        _MJSTR_TARGET_SSE2 inline __m128i _Broadcast_sse2(const uint32_t _Val) noexcept {
+            if constexpr (sizeof(_Elem) == 1) {
+                return _mm_set1_epi8(static_cast<char>(_Val));
+            } else if constexpr (sizeof(_Elem) == 2) {
+                return _mm_set1_epi16(static_cast<short>(_Val));
+            } else {
+                return _mm_set1_epi32(static_cast<int>(_Val));
+            }
+        }
+
+        template <class _Elem>
+        _MJSTR_TARGET_SSE2 inline __m128i _Add_sse2(const __m128i _Left, const __m128i _Right) noexcept {
+            if constexpr (sizeof(_Elem) == 1) {
+                return _mm_add_epi8(_Left, _Right);
+            } else if constexpr (sizeof(_Elem) == 2) {
+                return _mm_add_epi16(_Left, _Right);
+            } else {
+                return _mm_add_epi32(_Left, _Right);
+            }
+        }
+
+        template <class _Elem>
+        _MJSTR_TARGET_SSE2 inline __m128i _Greater_sse2(const __m128i _Left, const __m128i _Right) noexcept {
+            if constexpr (sizeof(_Elem) == 1) {
+                return _mm_cmpgt_epi8(_Left, _Right);
+            } else if constexpr (sizeof(_Elem) == 2) {
+                return _mm_cmpgt_epi16(_Left, _Right);
+            } else {
+                return _mm_cmpgt_epi32(_Left, _Right);
+            }
+        }
+
+        template <class _Elem>
+        _MJSTR_TARGET_SSE2 inline __m128i _Equal_sse2(const __m128i _Left, const __m128i _Right) noexcept {
+            if constexpr (sizeof(_Elem) == 1) {
+                return _mm_cmpeq_epi8(_Left, _Right);
+            } else if constexpr (sizeof(_Elem) == 2) {
+                return _mm_cmpeq_epi16(_Left, _Right);
+            } else {
+                return _mm_cmpeq_epi32(_Left, _Right);
+            }
+        }
+
+        template <class _Elem>
+        struct _Case_shift_sse2 { // adds _Delta to the characters in [_First, _First + 26)
+            _MJSTR_TARGET_SSE2 _Case_shift_sse2(const _Elem _First, const uint32_t _Delta) noexcept
+                : _Bias(_Broadcast_sse2<_Elem>(_Sign_bit_of<_Elem>() - static_cast<uint32_t>(_First))),
+                  _Limit(_Broadcast_sse2<_Elem>(_Sign_bit_of<_Elem>() + _Ascii_letter_count)),
+                  _Delta(_Broadcast_sse2<_Elem>(_Delta)) {}
+
+            _MJSTR_TARGET_SSE2 __m128i operator()(const __m128i _Chars) const noexcept {
+                const __m128i _In_range = _Greater_sse2<_Elem>(_Limit, _Add_sse2<_Elem>(_Chars, _Bias));
+                return _Add_sse2<_Elem>(_Chars, _mm_and_si128(_In_range, _Delta));
+            }
+
+            __m128i _Bias; // moves _First to the smallest signed value
+            __m128i _Limit; // the smallest signed value plus 26
+            __m128i _Delta;
+        };
+
+        template <class _Elem>
+        _MJSTR_TARGET_AVX2 inline __m256i _Broadcast_avx2(const uint32_t _Val) noexcept {
+            if constexpr (sizeof(_Elem) == 1) {
+                return _mm256_set1_epi8(static_cast<char>(_Val));
+            } else if constexpr (sizeof(_Elem) == 2) {
+                return _mm256_set1_epi16(static_cast<short>(_Val));
+            } else {
+                return _mm256_set1_epi32(static_cast<int>(_Val));
+            }
+        }
+
+        template <class _Elem>
+        _MJSTR_TARGET_AVX2 inline __m256i _Add_avx2(const __m256i _Left, const __m256i _Right) noexcept {
+            if constexpr (sizeof(_Elem) == 1) {
+                return _mm256_add_epi8(_Left, _Right);
+            } else if constexpr (sizeof(_Elem) == 2) {
+                return _mm256_add_epi16(_Left, _Right);
+            } else {
+                return _mm256_add_epi32(_Left, _Right);
+            }
+        }
+
+        template <class _Elem>
+        _MJSTR_TARGET_AVX2 inline __m256i _Greater_avx2(const __m256i _Left, const __m256i _Right) noexcept {
+            if constexpr (sizeof(_Elem) == 1) {
+                return _mm256_cmpgt_epi8(_Left, _Right);
+            } else if constexpr (sizeof(_Elem) == 2) {
+                return _mm256_cmpgt_epi16(_Left, _Right);
+            } else {
+                return _mm256_cmpgt_epi32(_Left, _Right);
+            }
+        }
+
+        template <class _Elem>
+        _MJSTR_TARGET_AVX2 inline __m256i _Equal_avx2(const __m256i _Left, const __m256i _Right) noexcept {
+            if constexpr (sizeof(_Elem) == 1) {
+                return _mm256_cmpeq_epi8(_Left, _Right);
+            } else if constexpr (sizeof(_Elem) == 2) {
+                return _mm256_cmpeq_epi16(_Left, _Right);
+            } else {
+                return _mm256_cmpeq_epi32(_Left, _Right);
+            }
+        }
+
+        template <class _Elem>
+        struct _Case_shift_avx2 { // adds _Delta to the characters in [_First, _First + 26)
+            _MJSTR_TARGET_AVX2 _Case_shift_avx2(const _Elem _First, const uint32_t _Delta) noexcept
+                : _Bias(_Broadcast_avx2<_Elem>(_Sign_bit_of<_Elem>() - static_cast<uint32_t>(_First))),
+                  _Limit(_Broadcast_avx2<_Elem>(_Sign_bit_of<_Elem>() + _Ascii_letter_count)),
+                  _Delta(_Broadcast_avx2<_Elem>(_Delta)) {}
+
+            _MJSTR_TARGET_AVX2 __m256i operator()(const __m256i _Chars) const noexcept {
+                const __m256i _In_range = _Greater_avx2<_Elem>(_Limit, _Add_avx2<_Elem>(_Chars, _Bias));
+                return _Add_avx2<_Elem>(_Chars, _mm256_and_si256(_In_range, _Delta));
+            }
+
+            __m256i _Bias; // moves _First to the smallest signed value
+            __m256i _Limit; // the smallest signed value plus 26
+            __m256i _Delta;
+        };
+
+        template <class _Elem>
+        _MJSTR_TARGET_SSE2 void _Convert_ascii_case_sse2(const _Elem* const _Src, const size_t _Size,
+            _Elem* const _Dest, const _Elem _First, const uint32_t _Delta) noexcept {
+            // converts all _Size characters, _Size must be at least one block
+            constexpr size_t _Block = _Case_block_sse2 / sizeof(_Elem);
+            const _Case_shift_sse2<_Elem> _Shift(_First, _Delta);
+            size_t _Pos = 0;
+            for (; _Pos + _Block <= _Size; _Pos += _Block) {
+                const __m128i _Chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Src + _Pos));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(_Dest + _Pos), _Shift(_Chars));
+            }
+
+            if (_Pos < _Size) { // the last block overlaps with the converted characters
+                _Pos                 = _Size - _Block;
+                const __m128i _Chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Src + _Pos));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(_Dest + _Pos), _Shift(_Chars));
+            }
+        }
+
+        template <class _Elem>
+        _MJSTR_TARGET_AVX2 void _Convert_ascii_case_avx2(const _Elem* const _Src, const size_t _Size,
+            _Elem* const _Dest, const _Elem _First, const uint32_t _Delta) noexcept {
+            // converts all _Size characters, _Size must be at least one block
+            constexpr size_t _Block = _Case_block_avx2 / sizeof(_Elem);
+            const _Case_shift_avx2<_Elem> _Shift(_First, _Delta);
+            size_t _Pos = 0;
+            for (; _Pos + _Block <= _Size; _Pos += _Block) {
+                const __m256i _Chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Src + _Pos));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Dest + _Pos), _Shift(_Chars));
+            }
+
+            if (_Pos < _Size) { // the last block overlaps with the converted characters
+                _Pos                 = _Size - _Block;
+                const __m256i _Chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Src + _Pos));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Dest + _Pos), _Shift(_Chars));
+            }
+        }
+
+        template <class _Elem>
+        _MJSTR_TARGET_SSE2 size_t _Mismatch_ascii_icase_sse2(
+            const _Elem* const _Left, const _Elem* const _Right, const size_t _Size) noexcept {
+            // returns the offset of the first character that differs after folding, or _Size if there is none,
+            // _Size must be at least one block
+            constexpr size_t _Block = _Case_block_sse2 / sizeof(_Elem);
+            const _Case_shift_sse2<_Elem> _Fold(static_cast<_Elem>('A'), _Ascii_case_delta);
+            size_t _Pos = 0;
+            for (;;) {
+                if (_Pos + _Block > _Size) {
+                    if (_Pos == _Size) {
+                        return _Size;
+                    }
+
+                    _Pos = _Size - _Block; // the last block overlaps with the compared characters
+                }
+
+                const __m128i _Left_chars  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Left + _Pos));
+                const __m128i _Right_chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Right + _Pos));
+                const uint32_t _Mask       = static_cast<uint32_t>(
+                    _mm_movemask_epi8(_Equal_sse2<_Elem>(_Fold(_Left_chars), _Fold(_Right_chars)))) ^ 0xFFFF;
+                if (_Mask != 0) {
+                    return _Pos + static_cast<size_t>(::std::countr_zero(_Mask)) / sizeof(_Elem);
+                }
+
+                _Pos += _Block;
+            }
+        }
+
+        template <class _Elem>
+        _MJSTR_TARGET_AVX2 size_t _Mismatch_ascii_icase_avx2(
+            const _Elem* const _Left, const _Elem* const _Right, const size_t _Size) noexcept {
+            // returns the offset of the first character that differs after folding, or _Size if there is none,
+            // _Size must be at least one block
+            constexpr size_t _Block = _Case_block_avx2 / sizeof(_Elem);
+            const _Case_shift_avx2<_Elem> _Fold(static_cast<_Elem>('A'), _Ascii_case_delta);
+            size_t _Pos = 0;
+            for (;;) {
+                if (_Pos + _Block > _Size) {
+                    if (_Pos == _Size) {
+                        return _Size;
+                    }
+
+                    _Pos = _Size - _Block; // the last block overlaps with the compared characters
+                }
+
+                const __m256i _Left_chars  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Left + _Pos));
+                const __m256i _Right_chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Right + _Pos));
+                const uint32_t _Mask       = ~static_cast<uint32_t>(
+                    _mm256_movemask_epi8(_Equal_avx2<_Elem>(_Fold(_Left_chars), _Fold(_Right_chars))));
+                if (_Mask != 0) {
+                    return _Pos + static_cast<size_t>(::std::countr_zero(_Mask)) / sizeof(_Elem);
+                }
+
+                _Pos += _Block;
+            }
+        }
+
+        template <class _Elem>
+        inline size_t _Mismatch_ascii_icase(
+            const _Elem* const _Left, const _Elem* const _Right, const size_t _Size) noexcept {
+            // returns the offset of the first character that differs after folding, or _Size if there is none
+            switch (_Get_isa_level()) {
+            case _Isa_level::_Avx2:
+                if (_Size >= _Case_block_avx2 / sizeof(_Elem)) {
+                    return _Mismatch_ascii_icase_avx2(_Left, _Right, _Size);
+                }
+
+                [[fallthrough]];
+            case _Isa_level::_Sse2:
+                if (_Size >= _Case_block_sse2 / sizeof(_Elem)) {
+                    return _Mismatch_ascii_icase_sse2(_Left, _Right, _Size);
+                }
+
+                break;
+            default:
+                break;
+            }
+
+            if constexpr (sizeof(_Elem) == 1) {
+                if (_Size >= _Case_word_size) {
+                    return _Mismatch_ascii_icase_swar(reinterpret_cast<const unsigned char*>(_Left),
+                        reinterpret_cast<const unsigned char*>(_Right), _Size);
+                }
+            }
+
+            for (size_t _Pos = 0; _Pos < _Size; ++_Pos) {
+                if (_Fold_ascii_case(_Left[_Pos]) != _Fold_ascii_case(_Right[_Pos])) {
+                    return _Pos;
+                }
+            }
+
+            return _Size;
+        }
+
+        template <class _Elem>
+        _MJSTR_TARGET_SSE2 size_t _Find_ascii_icase_sse2(const _Elem* const _Haystack, const size_t _Haystack_size,
+            const _Elem* const _Needle, const size_t _Needle_size) noexcept {
+            // Note: Compares the first and the last character of the needle with a block of candidate positions
+            //       at once, the rest of the needle is compared only if both match. There must be at least
+            //       one block of candidates.
+            constexpr size_t _Block  = _Case_block_sse2 / sizeof(_Elem);
+            constexpr uint32_t _Lane = (uint32_t{1} << sizeof(_Elem)) - 1; // the mask bits of one character
+            const size_t _Candidates = _Haystack_size - _Needle_size + 1;
+            const size_t _Last_off   = _Needle_size - 1;
+            const _Case_shift_sse2<_Elem> _Fold(static_cast<_Elem>('A'), _Ascii_case_delta);
+            const __m128i _First_char = _Broadcast_sse2<_Elem>(_Fold_ascii_case(_Needle[0]));
+            const __m128i _Last_char  = _Broadcast_sse2<_Elem>(_Fold_ascii_case(_Needle[_Last_off]));
+            size_t _Pos      = 0;
+            uint32_t _Unseen = 0xFFFFu; // the candidates that haven't been checked yet
+            for (;;) {
+                if (_Pos + _Block > _Candidates) {
+                    if (_Pos == _Candidates) {
+                        return static_cast<size_t>(-1);
+                    }
+
+                    // the last block overlaps with the checked candidates, skip them
+                    _Unseen = 0xFFFFu << ((_Pos - (_Candidates - _Block)) * sizeof(_Elem));
+                    _Pos    = _Candidates - _Block;
+                }
+
+                const __m128i _Heads = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Haystack + _Pos));
+                const __m128i _Tails =
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Haystack + _Pos + _Last_off));
+                const __m128i _Match = _mm_and_si128(
+                    _Equal_sse2<_Elem>(_Fold(_Heads), _First_char), _Equal_sse2<_Elem>(_Fold(_Tails), _Last_char));
+                uint32_t _Mask = static_cast<uint32_t>(_mm_movemask_epi8(_Match)) & _Unseen;
+                while (_Mask != 0) {
+                    const int _Bit    = ::std::countr_zero(_Mask);
+                    const size_t _Off = _Pos + static_cast<size_t>(_Bit) / sizeof(_Elem);
+                    if (_Needle_size <= 2
+                        || _Mismatch_ascii_icase(_Haystack + _Off + 1, _Needle + 1, _Needle_size - 2)
+                               == _Needle_size - 2) {
+                        return _Off;
+                    }
+
+                    _Mask &= ~(_Lane << _Bit);
+                }
+
+                _Pos += _Block;
+            }
+        }
+
+        template <class _Elem>
+        _MJSTR_TARGET_AVX2 size_t _Find_ascii_icase_avx2(const _Elem* const _Haystack, const size_t _Haystack_size,
+            const _Elem* const _Needle, const size_t _Needle_size) noexcept {
+            // Note: Compares the first and the last character of the needle with a block of candidate positions
+            //       at once, the rest of the needle is compared only if both match. There must be at least
+            //       one block of candidates.
+            constexpr size_t _Block  = _Case_block_avx2 / sizeof(_Elem);
+            constexpr uint32_t _Lane = (uint32_t{1} << sizeof(_Elem)) - 1; // the mask bits of one character
+            const size_t _Candidates = _Haystack_size - _Needle_size + 1;
+            const size_t _Last_off   = _Needle_size - 1;
+            const _Case_shift_avx2<_Elem> _Fold(static_cast<_Elem>('A'), _Ascii_case_delta);
+            const __m256i _First_char = _Broadcast_avx2<_Elem>(_Fold_ascii_case(_Needle[0]));
+            const __m256i _Last_char  = _Broadcast_avx2<_Elem>(_Fold_ascii_case(_Needle[_Last_off]));
+            size_t _Pos      = 0;
+            uint32_t _Unseen = 0xFFFF'FFFFu; // the candidates that haven't been checked yet
+            for (;;) {
+                if (_Pos + _Block > _Candidates) {
+                    if (_Pos == _Candidates) {
+                        return static_cast<size_t>(-1);
+                    }
+
+                    // the last block overlaps with the checked candidates, skip them
+                    _Unseen = 0xFFFF'FFFFu << ((_Pos - (_Candidates - _Block)) * sizeof(_Elem));
+                    _Pos    = _Candidates - _Block;
+                }
+
+                const __m256i _Heads = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Haystack + _Pos));
+                const __m256i _Tails =
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Haystack + _Pos + _Last_off));
+                const __m256i _Match = _mm256_and_si256(
+                    _Equal_avx2<_Elem>(_Fold(_Heads), _First_char), _Equal_avx2<_Elem>(_Fold(_Tails), _Last_char));
+                uint32_t _Mask = static_cast<uint32_t>(_mm256_movemask_epi8(_Match)) & _Unseen;
+                while (_Mask != 0) {
+                    const int _Bit    = ::std::countr_zero(_Mask);
+                    const size_t _Off = _Pos + static_cast<size_t>(_Bit) / sizeof(_Elem);
+                    if (_Needle_size <= 2
+                        || _Mismatch_ascii_icase(_Haystack + _Off + 1, _Needle + 1, _Needle_size - 2)
+                               == _Needle_size - 2) {
+                        return _Off;
+                    }
+
+                    _Mask &= ~(_Lane << _Bit);
+                }
+
+                _Pos += _Block;
+            }
+        }
+
+        template <class _Elem>
+        inline size_t _Find_ascii_icase(const _Elem* const _Haystack, const size_t _Haystack_size,
+            const _Elem* const _Needle, const size_t _Needle_size) noexcept {
+            // returns the offset of the first occurrence of a non-empty needle, ignoring the case of ASCII letters
+            if (_Needle_size > _Haystack_size) { // the needle doesn't fit
+                return static_cast<size_t>(-1);
+            }
+
+            const size_t _Candidates = _Haystack_size - _Needle_size + 1;
+            switch (_Get_isa_level()) {
+            case _Isa_level::_Avx2:
+                if (_Candidates >= _Case_block_avx2 / sizeof(_Elem)) {
+                    return _Find_ascii_icase_avx2(_Haystack, _Haystack_size, _Needle, _Needle_size);
+                }
+
+                [[fallthrough]];
+            case _Isa_level::_Sse2:
+                if (_Candidates >= _Case_block_sse2 / sizeof(_Elem)) {
+                    return _Find_ascii_icase_sse2(_Haystack, _Haystack_size, _Needle, _Needle_size);
+                }
+
+                break;
+            default:
+                break;
+            }
+
+            const uint32_t _First_char = _Fold_ascii_case(_Needle[0]);
+            for (size_t _Pos = 0; _Pos < _Candidates; ++_Pos) {
+                if (_Fold_ascii_case(_Haystack[_Pos]) == _First_char
+                    && _Mismatch_ascii_icase(_Haystack + _Pos + 1, _Needle + 1, _Needle_size - 1) == _Needle_size - 1) {
+                    return _Pos;
+                }
+            }
+
+            return static_cast<size_t>(-1);
+        }
+
+        template <class _Elem>
+        inline void _Convert_ascii_case(
+            const _Elem* const _Src, const size_t _Size, _Elem* const _Dest, const bool _Upper) noexcept {
+            // converts the ASCII letters to lowercase or uppercase, _Src and _Dest may be the same buffer
+            const _Elem _First     = static_cast<_Elem>(_Upper ? 'a' : 'A');
+            const uint32_t _Delta  = _Upper ? 0 - _Ascii_case_delta : _Ascii_case_delta;
+            switch (_Get_isa_level()) {
+            case _Isa_level::_Avx2:
+                if (_Size >= _Case_block_avx2 / sizeof(_Elem)) {
+                    _Convert_ascii_case_avx2(_Src, _Size, _Dest, _First, _Delta);
+                    return;
+                }
+
+                [[fallthrough]];
+            case _Isa_level::_Sse2:
+                if (_Size >= _Case_block_sse2 / sizeof(_Elem)) {
+                    _Convert_ascii_case_sse2(_Src, _Size, _Dest, _First, _Delta);
+                    return;
+                }
+
+                break;
+            default:
+                break;
+            }
+
+            if constexpr (sizeof(_Elem) == 1) {
+                if (_Size >= _Case_word_size) {
+                    _Convert_ascii_case_swar(reinterpret_cast<const unsigned char*>(_Src), _Size,
+                        reinterpret_cast<unsigned char*>(_Dest), _Upper);
+                    return;
+                }
+            }
+
+            for (size_t _Pos = 0; _Pos < _Size; ++_Pos) {
+                _Dest[_Pos] = _Shift_ascii_case(_Src[_Pos], _First, _Delta);
+            }
+        }
+
+        template <class _Elem>
+        inline int _Compare_ascii_icase(const _Elem* const _Left, const size_t _Left_size, const _Elem* const _Right,
+            const size_t _Right_size) noexcept {
+            // compares the folded characters as unsigned values, then the sizes
+            const size_t _Count = _Left_size < _Right_size ? _Left_size : _Right_size;
+            const size_t _Pos   = _Mismatch_ascii_icase(_Left, _Right, _Count);
+            if (_Pos < _Count) {
+                return _Fold_ascii_case(_Left[_Pos]) < _Fold_ascii_case(_Right[_Pos]) ? -1 : 1;
+            }
+
+            return _Left_size == _Right_size ? 0 : (_Left_size < _Right_size ? -1 : 1);
+        }
+    } // namespace mjstr_impl
+} // namespace mjx
+
+#endif // _MJSTR_IMPL_ASCII_CASE_HPP_
\ No newline at end of file
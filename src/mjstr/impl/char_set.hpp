@@ -0,0 +1,322 @@
+// char_set.hpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#ifndef _MJSTR_IMPL_CHAR_SET_HPP_
+#define _MJSTR_IMPL_CHAR_SET_HPP_
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <cwchar>
+#include <immintrin.h>
+#include <mjstr/impl/cpu.hpp>
+#include <type_traits>
+
+namespace mjx {
+    namespace mjstr_impl {
+        // Note: A set of bytes is stored as a 256-bit bitmap split into two 16-byte tables indexed by the low
+        //       nibble of a byte, bit (_Hi & 7) of _Rows[_Hi >> 3][_Lo] tells whether the byte is a member.
+        //       The AVX2 kernel looks up both tables with a byte shuffle, so every step classifies 32 bytes
+        //       regardless of the size of the set. SSE2 lacks the shuffle, its kernel compares the bytes
+        //       with every member instead and is used only for small sets.
+        inline constexpr size_t _Char_set_block_sse2 = 16;
+        inline constexpr size_t _Char_set_block_avx2 = 32;
+        inline constexpr size_t _Char_set_max_sse2   = 8; // larger sets are scanned by the scalar loop
+
+        // the ASCII whitespace characters, the default set used by split_whitespace() and trim()
+        template <class _Elem>
+        inline constexpr _Elem _Whitespace_chars[] = {static_cast<_Elem>(' '), static_cast<_Elem>('\t'),
+            static_cast<_Elem>('\n'), static_cast<_Elem>('\v'), static_cast<_Elem>('\f'), static_cast<_Elem>('\r')};
+        inline constexpr size_t _Whitespace_count = 6;
+
+        struct _Char_set {
+            alignas(16) unsigned char _Rows[2][16];
+            unsigned char _Members[_Char_set_max_sse2]; // valid only if _Count <= _Char_set_max_sse2
+            size_t _Count;
+            bool _Has_wide; // some members don't fit in a byte, they aren't stored in the bitmap
+
+            bool _Contains(const unsigned char _Ch) const noexcept {
+                return ((_Rows[_Ch >> 7][_Ch & 0x0F] >> ((_Ch >> 4) & 7)) & 1) != 0;
+            }
+        };
+
+        template <class _Elem>
+        inline void _Build_char_set(_Char_set& _Set, const _Elem* const _Chars, const size_t _Count) noexcept {
+            // only characters that fit in a byte are stored, the other ones are searched for in _Chars
+            using _Unsigned = ::std::make_unsigned_t<_Elem>;
+            ::memset(_Set._Rows, 0, sizeof(_Set._Rows));
+            _Set._Count    = _Count;
+            _Set._Has_wide = false;
+            for (size_t _Idx = 0; _Idx < _Count; ++_Idx) {
+                const _Unsigned _Ch = static_cast<_Unsigned>(_Chars[_Idx]);
+                if (_Ch > 0xFF) {
+                    _Set._Has_wide = true;
+                } else {
+                    _Set._Rows[_Ch >> 7][_Ch & 0x0F] |= static_cast<unsigned char>(1 << ((_Ch >> 4) & 7));
+                    if (_Idx < _Char_set_max_sse2) {
+                        _Set._Members[_Idx] = static_cast<unsigned char>(_Ch);
+                    }
+                }
+            }
+        }
+
+        _MJSTR_TARGET_SSE2 inline uint32_t _Match_char_set_sse2(const __m128i _Block, const _Char_set& _Set) noexcept {
+            // returns a bit for every member of the set
+            __m128i _Matches = _mm_setzero_si128();
+            for (size_t _Idx = 0; _Idx < _Set._Count; ++_Idx) {
+                _Matches = _mm_or_si128(
+                    _Matches, _mm_cmpeq_epi8(_Block, _mm_set1_epi8(static_cast<char>(_Set._Members[_Idx]))));
+            }
+
+            return static_cast<uint32_t>(_mm_movemask_epi8(_Matches));
+        }
+
+        _MJSTR_TARGET_AVX2 inline uint32_t _Match_char_set_avx2(
+            const __m256i _Block, const __m256i _Row0, const __m256i _Row1, const __m256i _Bits) noexcept {
+            // returns a bit for every member of the set
+            const __m256i _Nibble = _mm256_set1_epi8(0x0F);
+            const __m256i _Lo     = _mm256_and_si256(_Block, _Nibble);
+            const __m256i _Hi     = _mm256_and_si256(_mm256_srli_epi16(_Block, 4), _Nibble);
+            const __m256i _Row    = _mm256_blendv_epi8( // the top bit of the byte selects the table
+                _mm256_shuffle_epi8(_Row0, _Lo), _mm256_shuffle_epi8(_Row1, _Lo), _Block);
+            const __m256i _Bit    = _mm256_shuffle_epi8(_Bits, _Hi);
+            return static_cast<uint32_t>(
+                _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(_Row, _Bit), _Bit)));
+        }
+
+        _MJSTR_TARGET_AVX2 inline void _Load_char_set_avx2(
+            const _Char_set& _Set, __m256i& _Row0, __m256i& _Row1, __m256i& _Bits) noexcept {
+            _Row0 = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(_Set._Rows[0])));
+            _Row1 = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(_Set._Rows[1])));
+            _Bits = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16,
+                32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+        }
+
+        // Note: The kernels scan whole blocks only. The forward kernels return the position where the scalar
+        //       loop should continue, that is the block with the first found character or the incomplete block.
+        //       The backward kernels return the end of the range that is left to the scalar loop.
+        //       _Member selects whether the members (find_first_of) or other characters (find_first_not_of)
+        //       are searched for.
+        template <bool _Member>
+        _MJSTR_TARGET_SSE2 size_t _Scan_char_set_sse2(
+            const unsigned char* const _Ptr, const size_t _Size, const _Char_set& _Set) noexcept {
+            constexpr uint32_t _Flip = _Member ? 0 : 0xFFFF;
+            size_t _Pos              = 0;
+            for (; _Pos + _Char_set_block_sse2 <= _Size; _Pos += _Char_set_block_sse2) {
+                const __m128i _Block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Ptr + _Pos));
+                const uint32_t _Mask = _Match_char_set_sse2(_Block, _Set) ^ _Flip;
+                if (_Mask != 0) {
+                    return _Pos + static_cast<size_t>(::std::countr_zero(_Mask));
+                }
+            }
+
+            return _Pos;
+        }
+
+        template <bool _Member>
+        _MJSTR_TARGET_AVX2 size_t _Scan_char_set_avx2(
+            const unsigned char* const _Ptr, const size_t _Size, const _Char_set& _Set) noexcept {
+            constexpr uint32_t _Flip = _Member ? 0 : 0xFFFF'FFFF;
+            __m256i _Row0;
+            __m256i _Row1;
+            __m256i _Bits;
+            _Load_char_set_avx2(_Set, _Row0, _Row1, _Bits);
+            size_t _Pos = 0;
+            for (; _Pos + 2 * _Char_set_block_avx2 <= _Size; _Pos += 2 * _Char_set_block_avx2) {
+                // two blocks per step, the lookups are independent
+                const __m256i* const _Src = reinterpret_cast<const __m256i*>(_Ptr + _Pos);
+                const uint32_t _Mask0 =
+                    _Match_char_set_avx2(_mm256_loadu_si256(_Src), _Row0, _Row1, _Bits) ^ _Flip;
+                const uint32_t _Mask1 =
+                    _Match_char_set_avx2(_mm256_loadu_si256(_Src + 1), _Row0, _Row1, _Bits) ^ _Flip;
+                const uint64_t _Mask = (static_cast<uint64_t>(_Mask1) << 32) | _Mask0;
+                if (_Mask != 0) {
+                    return _Pos + static_cast<size_t>(::std::countr_zero(_Mask));
+                }
+            }
+
+            for (; _Pos + _Char_set_block_avx2 <= _Size; _Pos += _Char_set_block_avx2) {
+                const __m256i _Block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Ptr + _Pos));
+                const uint32_t _Mask = _Match_char_set_avx2(_Block, _Row0, _Row1, _Bits) ^ _Flip;
+                if (_Mask != 0) {
+                    return _Pos + static_cast<size_t>(::std::countr_zero(_Mask));
+                }
+            }
+
+            return _Pos;
+        }
+
+        template <bool _Member>
+        _MJSTR_TARGET_SSE2 size_t _Reverse_scan_char_set_sse2(
+            const unsigned char* const _Ptr, size_t _Size, const _Char_set& _Set) noexcept {
+            constexpr uint32_t _Flip = _Member ? 0 : 0xFFFF;
+            for (; _Size >= _Char_set_block_sse2; _Size -= _Char_set_block_sse2) {
+                const __m128i _Block =
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Ptr + _Size - _Char_set_block_sse2));
+                const uint32_t _Mask = _Match_char_set_sse2(_Block, _Set) ^ _Flip;
+                if (_Mask != 0) {
+                    return _Size - static_cast<size_t>(::std::countl_zero(_Mask << 16));
+                }
+            }
+
+            return _Size;
+        }
+
+        template <bool _Member>
+        _MJSTR_TARGET_AVX2 size_t _Reverse_scan_char_set_avx2(
+            const unsigned char* const _Ptr, size_t _Size, const _Char_set& _Set) noexcept {
+            constexpr uint32_t _Flip = _Member ? 0 : 0xFFFF'FFFF;
+            __m256i _Row0;
+            __m256i _Row1;
+            __m256i _Bits;
+            _Load_char_set_avx2(_Set, _Row0, _Row1, _Bits);
+            for (; _Size >= 2 * _Char_set_block_avx2; _Size -= 2 * _Char_set_block_avx2) {
+                const __m256i* const _Src = reinterpret_cast<const __m256i*>(_Ptr + _Size - 2 * _Char_set_block_avx2);
+                const uint32_t _Mask0 =
+                    _Match_char_set_avx2(_mm256_loadu_si256(_Src), _Row0, _Row1, _Bits) ^ _Flip;
+                const uint32_t _Mask1 =
+                    _Match_char_set_avx2(_mm256_loadu_si256(_Src + 1), _Row0, _Row1, _Bits) ^ _Flip;
+                const uint64_t _Mask = (static_cast<uint64_t>(_Mask1) << 32) | _Mask0;
+                if (_Mask != 0) {
+                    return _Size - static_cast<size_t>(::std::countl_zero(_Mask));
+                }
+            }
+
+            for (; _Size >= _Char_set_block_avx2; _Size -= _Char_set_block_avx2) {
+                const __m256i _Block =
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Ptr + _Size - _Char_set_block_avx2));
+                const uint32_t _Mask = _Match_char_set_avx2(_Block, _Row0, _Row1, _Bits) ^ _Flip;
+                if (_Mask != 0) {
+                    return _Size - static_cast<size_t>(::std::countl_zero(_Mask));
+                }
+            }
+
+            return _Size;
+        }
+
+        template <bool _Member>
+        inline size_t _Find_char_set_bytes(
+            const unsigned char* const _Ptr, const size_t _Size, const _Char_set& _Set) noexcept {
+            size_t _Pos;
+            switch (_Get_isa_level()) {
+            case _Isa_level::_Avx2:
+                _Pos = _Scan_char_set_avx2<_Member>(_Ptr, _Size, _Set);
+                break;
+            case _Isa_level::_Sse2:
+                _Pos = _Set._Count <= _Char_set_max_sse2 ? _Scan_char_set_sse2<_Member>(_Ptr, _Size, _Set) : 0;
+                break;
+            default:
+                _Pos = 0;
+                break;
+            }
+
+            for (; _Pos < _Size; ++_Pos) {
+                if (_Set._Contains(_Ptr[_Pos]) == _Member) {
+                    return _Pos;
+                }
+            }
+
+            return static_cast<size_t>(-1);
+        }
+
+        template <bool _Member>
+        inline size_t _Reverse_find_char_set_bytes(
+            const unsigned char* const _Ptr, const size_t _Size, const _Char_set& _Set) noexcept {
+            size_t _End;
+            switch (_Get_isa_level()) {
+            case _Isa_level::_Avx2:
+                _End = _Reverse_scan_char_set_avx2<_Member>(_Ptr, _Size, _Set);
+                break;
+            case _Isa_level::_Sse2:
+                _End = _Set._Count <= _Char_set_max_sse2
+                         ? _Reverse_scan_char_set_sse2<_Member>(_Ptr, _Size, _Set) : _Size;
+                break;
+            default:
+                _End = _Size;
+                break;
+            }
+
+            while (_End > 0) {
+                if (_Set._Contains(_Ptr[--_End]) == _Member) {
+                    return _End;
+                }
+            }
+
+            return static_cast<size_t>(-1);
+        }
+
+        template <class _Elem>
+        inline bool _Char_set_contains(const _Char_set& _Set, const _Elem* const _Chars, const _Elem _Ch) noexcept {
+            // _Chars must be the characters the set was built from
+            using _Unsigned = ::std::make_unsigned_t<_Elem>;
+            if (static_cast<_Unsigned>(_Ch) <= 0xFF) {
+                return _Set._Contains(static_cast<unsigned char>(_Ch));
+            }
+
+            if constexpr (sizeof(_Elem) == 1) {
+                return false;
+            } else {
+                return _Set._Has_wide && ::wmemchr(_Chars, _Ch, _Set._Count) != nullptr;
+            }
+        }
+
+        // Note: The following functions search with a set built from _Chars by _Build_char_set(), so the set
+        //       can be reused for many searches. Wide characters are scanned by the scalar loop.
+        template <bool _Member, class _Elem>
+        inline size_t _Find_in_char_set(const _Elem* const _Haystack, const size_t _Haystack_size,
+            const _Char_set& _Set, const _Elem* const _Chars) noexcept {
+            // returns the index of the first character that is (or isn't) a member of the set
+            if constexpr (sizeof(_Elem) == 1) {
+                return _Find_char_set_bytes<_Member>(
+                    reinterpret_cast<const unsigned char*>(_Haystack), _Haystack_size, _Set);
+            } else {
+                for (size_t _Pos = 0; _Pos < _Haystack_size; ++_Pos) {
+                    if (_Char_set_contains(_Set, _Chars, _Haystack[_Pos]) == _Member) {
+                        return _Pos;
+                    }
+                }
+
+                return static_cast<size_t>(-1);
+            }
+        }
+
+        template <bool _Member, class _Elem>
+        inline size_t _Reverse_find_in_char_set(const _Elem* const _Haystack, const size_t _Haystack_size,
+            const _Char_set& _Set, const _Elem* const _Chars) noexcept {
+            // returns the index of the last character that is (or isn't) a member of the set
+            if constexpr (sizeof(_Elem) == 1) {
+                return _Reverse_find_char_set_bytes<_Member>(
+                    reinterpret_cast<const unsigned char*>(_Haystack), _Haystack_size, _Set);
+            } else {
+                for (size_t _Pos = _Haystack_size; _Pos > 0; --_Pos) {
+                    if (_Char_set_contains(_Set, _Chars, _Haystack[_Pos - 1]) == _Member) {
+                        return _Pos - 1;
+                    }
+                }
+
+                return static_cast<size_t>(-1);
+            }
+        }
+
+        template <bool _Member, class _Elem>
+        inline size_t _Find_char_set(const _Elem* const _Haystack, const size_t _Haystack_size,
+            const _Elem* const _Chars, const size_t _Count) noexcept {
+            _Char_set _Set;
+            _Build_char_set(_Set, _Chars, _Count);
+            return _Find_in_char_set<_Member>(_Haystack, _Haystack_size, _Set, _Chars);
+        }
+
+        template <bool _Member, class _Elem>
+        inline size_t _Reverse_find_char_set(const _Elem* const _Haystack, const size_t _Haystack_size,
+            const _Elem* const _Chars, const size_t _Count) noexcept {
+            _Char_set _Set;
+            _Build_char_set(_Set, _Chars, _Count);
+            return _Reverse_find_in_char_set<_Member>(_Haystack, _Haystack_size, _Set, _Chars);
+        }
+    } // namespace mjstr_impl
+} // namespace mjx
+
+#endif // _MJSTR_IMPL_CHAR_SET_HPP_
\ No newline at end of file
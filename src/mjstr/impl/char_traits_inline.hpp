@@ -0,0 +1,55 @@
+// char_traits_inline.hpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#ifndef _MJSTR_IMPL_CHAR_TRAITS_INLINE_HPP_
+#define _MJSTR_IMPL_CHAR_TRAITS_INLINE_HPP_
+#include <mjstr/char_traits.hpp>
+#include <mjstr/impl/char_traits.hpp>
+
+namespace mjx {
+    template <class _Elem>
+    _MJSTR_INLINE void char_traits<_Elem>::assign(
+        char_type* const _Dest, const size_t _Count, const char_type _Ch) noexcept {
+        mjstr_impl::_Char_traits<_Elem>::_Assign(_Dest, _Count, _Ch);
+    }
+
+    template <class _Elem>
+    _MJSTR_INLINE bool char_traits<_Elem>::eq(
+        const char_type* const _Left, const char_type* const _Right, const size_t _Count) noexcept {
+        return mjstr_impl::_Char_traits<_Elem>::_Eq(_Left, _Right, _Count);
+    }
+
+    template <class _Elem>
+    _MJSTR_INLINE void char_traits<_Elem>::move(
+        char_type* const _Dest, const char_type* const _Src, const size_t _Count) noexcept {
+        mjstr_impl::_Char_traits<_Elem>::_Move(_Dest, _Src, _Count);
+    }
+
+    template <class _Elem>
+    _MJSTR_INLINE void char_traits<_Elem>::copy(
+        char_type* const _Dest, const char_type* const _Src, const size_t _Count) noexcept {
+        mjstr_impl::_Char_traits<_Elem>::_Copy(_Dest, _Src, _Count);
+    }
+
+    template <class _Elem>
+    _MJSTR_INLINE int char_traits<_Elem>::compare(
+        const char_type* const _Left, const char_type* const _Right, const size_t _Count) noexcept {
+        return mjstr_impl::_Char_traits<_Elem>::_Compare(_Left, _Right, _Count);
+    }
+
+    template <class _Elem>
+    _MJSTR_INLINE size_t char_traits<_Elem>::length(const char_type* const _Str) noexcept {
+        return mjstr_impl::_Char_traits<_Elem>::_Length(_Str);
+    }
+
+    template <class _Elem>
+    _MJSTR_INLINE size_t char_traits<_Elem>::find(
+        const char_type* const _Haystack, const size_t _Haystack_size, const char_type _Needle) noexcept {
+        return mjstr_impl::_Char_traits<_Elem>::_Find(_Haystack, _Haystack_size, _Needle);
+    }
+} // namespace mjx
+
+#endif // _MJSTR_IMPL_CHAR_TRAITS_INLINE_HPP_
\ No newline at end of file
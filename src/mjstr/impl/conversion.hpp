@@ -7,160 +7,348 @@
 #ifndef _MJSTR_IMPL_CONVERSION_HPP_
 #define _MJSTR_IMPL_CONVERSION_HPP_
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mjstr/conversion.hpp>
+#include <mjstr/impl/ascii.hpp>
+#include <mjstr/impl/utf8.hpp>
 #include <mjstr/string.hpp>
 #include <mjstr/string_view.hpp>
 #include <type_traits>
 #ifdef _MJX_WINDOWS
 #include <mjstr/impl/tinywin.hpp>
-#else // ^^^ _MJX_WINDOWS ^^^ / vvv _MJX_LINUX vvv
-#include <cstdint>
 #endif // _MJX_WINDOWS
 
 namespace mjx {
     namespace mjstr_impl {
-#ifdef _MJX_LINUX
-        // Note: On Linux, Unicode characters are typically stored in UTF-32 encoding,
-        //       which means wchar_t should be 4 bytes long. This implementation handles
-        //       UCS-4 code points, which also rely on a 4-byte wchar_t type.
-        static_assert(sizeof(wchar_t) == 4, "unexpected wchar_t size");
+        // Note: The bounded converters below write at most _Buf_size elements and never split a character.
+        //       They are used on every platform, so wide characters may be either UTF-16 (Windows)
+        //       or UTF-32 (Linux) code units.
+        inline constexpr bool _Is_utf16_wchar = sizeof(wchar_t) == 2;
 
-        constexpr size_t _Calculate_utf8_encoded_length(const wchar_t* _Chars, const size_t _Size) noexcept {
-            // calculate the length of the UTF-8 encoded string from _Chars
-            const wchar_t* const _Last = _Chars + _Size;
-            size_t _Count              = 0;
+        template <class _Src_elem, class _Dest_elem>
+        inline conversion_result _Copy_utf8_into(const _Src_elem* const _Bytes,
+            const size_t _Size, _Dest_elem* const _Buf, const size_t _Buf_size) noexcept {
+            // copy byte/UTF-8 sequence as is, the last copied sequence must be complete
+            const size_t _Count = _Size <= _Buf_size ? _Size : _Find_sequence_start(_Bytes, _Buf_size);
+            ::memcpy(_Buf, _Bytes, _Count);
+            return {_Count, _Count, _Count == _Size ? conversion_status::ok : conversion_status::destination_full};
+        }
+
+        template <class _Elem>
+        constexpr conversion_result _Decode_utf8_into(
+            const _Elem* const _Bytes, const size_t _Size, wchar_t* const _Buf, const size_t _Buf_size) noexcept {
+            // decode _Bytes to Unicode, stops at the first invalid sequence or when _Buf is full
+            // Note: Every character takes at most four bytes, so validating more than _Buf_size * 4 bytes
+            //       would be wasted work when the buffer is small. If the validated prefix ends
+            //       in the middle of a sequence, the buffer is filled up before that sequence is reached.
+            const size_t _Max_read = _Buf_size < (static_cast<size_t>(-1) - 4) / 4 ? _Buf_size * 4 + 4 : _Size;
+            const size_t _Checked  = _Size < _Max_read ? _Size : _Max_read;
+            utf8_validation_result _Validation = _Validate_utf8(_Bytes, _Checked);
+            if (_Checked < _Size && _Validation.error == utf8_error::incomplete_sequence) { // cut by _Checked
+                _Validation.error = utf8_error::none;
+            }
+
+            // the bytes before _Validation.offset are well-formed, so only the payload bits have to be extracted
+            const size_t _Valid_size = _Validation.offset;
+            size_t _Read             = 0;
+            size_t _Written          = 0;
+            size_t _Trailing;
+            uint8_t _Byte;
             uint32_t _Code_point;
-            for (; _Chars != _Last; ++_Chars) {
-                _Code_point = static_cast<uint32_t>(*_Chars);
-                if (_Code_point <= 0x7F) { // U+0000...U+007F, single byte
-                    ++_Count;
-                } else if (_Code_point <= 0x07FF) { // U+0080...U+07FF, two bytes
-                    _Count += 2;
-                } else if (_Code_point <= 0xFFFF) { // U+0800...U+FFFF, three bytes
-                    _Count += 3;
-                } else if (_Code_point <= 0x0010'FFFF) { // U+010000...U+01FFFF, four bytes
-                    _Count += 4;
-                } else { // invalid code point (too big), break
-                    return static_cast<size_t>(-1);
+            while (_Read < _Valid_size) {
+                _Byte = static_cast<uint8_t>(_Bytes[_Read]);
+                if (_Byte <= 0x7F) { // 0XXXXXXX pattern, single byte
+                    const size_t _Available = (::std::min)(_Valid_size - _Read, _Buf_size - _Written);
+                    if (_Available >= _Ascii_block_sse2 && !::std::is_constant_evaluated()) {
+                        // convert this and the following ASCII bytes in blocks
+                        const size_t _Ascii = _Widen_ascii(_Bytes + _Read, _Available, _Buf + _Written);
+                        if (_Ascii > 0) {
+                            _Read    += _Ascii;
+                            _Written += _Ascii;
+                            continue;
+                        }
+                    }
+
+                    _Code_point = static_cast<uint32_t>(_Byte);
+                    _Trailing   = 0;
+                } else if (_Byte <= 0xDF) { // 110XXXXX pattern, two bytes
+                    _Code_point = static_cast<uint32_t>(_Byte & 0x1F);
+                    _Trailing   = 1;
+                } else if (_Byte <= 0xEF) { // 1110XXXX pattern, three bytes
+                    _Code_point = static_cast<uint32_t>(_Byte & 0x0F);
+                    _Trailing   = 2;
+                } else { // 11110XXX pattern, four bytes
+                    _Code_point = static_cast<uint32_t>(_Byte & 0x07);
+                    _Trailing   = 3;
+                }
+
+                // four-byte sequences encode U+010000...U+10FFFF, which need a surrogate pair in UTF-16
+                const size_t _Units = _Is_utf16_wchar && _Trailing == 3 ? 2 : 1;
+                if (_Buf_size - _Written < _Units) { // no space left for this character, break
+                    return {_Read, _Written, conversion_status::destination_full};
+                }
+
+                for (size_t _Idx = 1; _Idx <= _Trailing; ++_Idx) {
+                    _Code_point = (_Code_point << 6) | (static_cast<uint8_t>(_Bytes[_Read + _Idx]) & 0x3F);
+                }
+
+                if (_Units == 2) { // U+010000...U+10FFFF, write a surrogate pair
+                    _Code_point        -= 0x0001'0000;
+                    _Buf[_Written]      = static_cast<wchar_t>(0xD800 | (_Code_point >> 10));
+                    _Buf[_Written + 1]  = static_cast<wchar_t>(0xDC00 | (_Code_point & 0x03FF));
+                } else {
+                    _Buf[_Written] = static_cast<wchar_t>(_Code_point);
                 }
+
+                _Read    += _Trailing + 1;
+                _Written += _Units;
             }
 
-            return _Count;
+            if (_Validation.error != utf8_error::none) {
+                return {_Read, _Written, conversion_status::invalid_input};
+            }
+
+            return {_Read, _Written,
+                _Read == _Size ? conversion_status::ok : conversion_status::destination_full};
         }
 
+        inline constexpr uint8_t _Utf8_leading_bits[4] = {0x00, 0xC0, 0xE0, 0xF0}; // indexed by trailing bytes
+
         template <class _Elem>
-        constexpr bool _Encode_utf8(const wchar_t* _Chars, const size_t _Size, _Elem* _Buf) noexcept {
-            // encode _Chars to UTF-8 and write to _Buf, assumes _Buf can fit all bytes
-            const wchar_t* const _Last = _Chars + _Size;
+        constexpr conversion_result _Encode_utf8_into(
+            const wchar_t* const _Chars, const size_t _Size, _Elem* const _Buf, const size_t _Buf_size) noexcept {
+            // encode _Chars to UTF-8, stops at the first invalid character or when _Buf is full
+            size_t _Read    = 0;
+            size_t _Written = 0;
+            size_t _Units;
             size_t _Trailing;
             uint32_t _Code_point;
-            for (; _Chars != _Last; ++_Chars) {
-                _Code_point = static_cast<uint32_t>(*_Chars);
+            while (_Read < _Size) {
+                _Code_point = static_cast<uint32_t>(_Chars[_Read]);
+                _Units      = 1;
                 if (_Code_point <= 0x7F) { // U+0000...U+007F, single byte
-                    *_Buf++   = static_cast<_Elem>(_Code_point);
+                    const size_t _Available = (::std::min)(_Size - _Read, _Buf_size - _Written);
+                    if (_Available >= _Ascii_block_sse2 && !::std::is_constant_evaluated()) {
+                        // convert this and the following ASCII characters in blocks
+                        const size_t _Ascii = _Narrow_ascii(_Chars + _Read, _Available, _Buf + _Written);
+                        if (_Ascii > 0) {
+                            _Read    += _Ascii;
+                            _Written += _Ascii;
+                            continue;
+                        }
+                    }
+
                     _Trailing = 0;
                 } else if (_Code_point <= 0x07FF) { // U+0080...U+07FF, two bytes
-                    *_Buf++   = static_cast<_Elem>(0xC0 | (_Code_point >> 6));
                     _Trailing = 1;
+                } else if (_Code_point >= 0xD800 && _Code_point <= 0xDFFF) { // surrogate
+                    if (!_Is_utf16_wchar || _Code_point >= 0xDC00 || _Read + 1 == _Size) { // lone surrogate, break
+                        return {_Read, _Written, conversion_status::invalid_input};
+                    }
+
+                    const uint32_t _Low = static_cast<uint32_t>(_Chars[_Read + 1]);
+                    if (_Low < 0xDC00 || _Low > 0xDFFF) { // the high surrogate isn't followed by a low one, break
+                        return {_Read, _Written, conversion_status::invalid_input};
+                    }
+
+                    _Code_point = 0x0001'0000 + (((_Code_point & 0x03FF) << 10) | (_Low & 0x03FF));
+                    _Units      = 2;
+                    _Trailing   = 3;
                 } else if (_Code_point <= 0xFFFF) { // U+0800...U+FFFF, three bytes
-                    *_Buf++   = static_cast<_Elem>(0xE0 | (_Code_point >> 12));
                     _Trailing = 2;
                 } else if (_Code_point <= 0x0010'FFFF) { // U+010000...U+10FFFF, four bytes
-                    *_Buf++   = static_cast<_Elem>(0xF0 | (_Code_point >> 18));
                     _Trailing = 3;
                 } else { // invalid code point (too big), break
-                    return false;
+                    return {_Read, _Written, conversion_status::invalid_input};
+                }
+
+                if (_Buf_size - _Written <= _Trailing) { // no space left for this character, break
+                    return {_Read, _Written, conversion_status::destination_full};
                 }
 
-                for (; _Trailing > 0; ++_Buf) { // append trailing bytes, if any
-                    *_Buf = static_cast<_Elem>(0x80 | ((_Code_point >> (6 * --_Trailing)) & 0x3F));
+                _Buf[_Written++] = static_cast<_Elem>(_Utf8_leading_bits[_Trailing] | (_Code_point >> (6 * _Trailing)));
+                for (; _Trailing > 0; ++_Written) { // append trailing bytes, if any
+                    _Buf[_Written] = static_cast<_Elem>(0x80 | ((_Code_point >> (6 * --_Trailing)) & 0x3F));
                 }
+
+                _Read += _Units;
             }
 
-            return true;
+            return {_Read, _Written, conversion_status::ok};
         }
 
         template <class _Elem>
-        constexpr size_t _Calculate_utf8_decoded_length(const _Elem* _Bytes, const size_t _Size) noexcept {
-            // calculate the length of the UTF-8 decoded string from _Bytes
-            const _Elem* const _Last = _Bytes + _Size;
-            size_t _Count            = 0;
-            size_t _Trailing;
-            uint8_t _Byte;
-            for (; _Bytes != _Last; ++_Count) {
-                _Byte = static_cast<uint8_t>(*_Bytes++);
-                if (_Byte <= 0x7F) { // 0XXXXXXX pattern, single byte
-                    _Trailing = 0;
-                } else if (_Byte >= 0xC0 && _Byte <= 0xDF) { // 110XXXXX pattern, two bytes
-                    _Trailing = 1;
-                } else if (_Byte <= 0xEF) { // 1110XXXX pattern, three bytes
-                    _Trailing = 2;
-                } else if (_Byte <= 0xF7) { // 11110XXX pattern, four bytes
-                    _Trailing = 3;
-                } else { // invalid leading byte, break
-                    return static_cast<size_t>(-1);
+        constexpr conversion_result _Decode_utf8_chunk(byte_t (&_Pending)[4], byte_t& _Pending_size,
+            const _Elem* const _Bytes, const size_t _Size, wchar_t* const _Buf, const size_t _Buf_size) noexcept {
+            // decode _Bytes to Unicode, an incomplete sequence at the end of _Bytes is stored in _Pending
+            size_t _Read    = 0;
+            size_t _Written = 0;
+            if (_Pending_size > 0) { // complete the sequence split by the previous chunk
+                const uint8_t _Lead   = _Pending[0];
+                const size_t _Length  = _Lead >= 0xF0 ? 4 : _Lead >= 0xE0 ? 3 : 2;
+                const size_t _Missing = _Length - _Pending_size;
+                const size_t _Taken   = _Missing < _Size ? _Missing : _Size;
+                uint8_t _Sequence[4]  = {};
+                for (size_t _Idx = 0; _Idx < _Pending_size; ++_Idx) {
+                    _Sequence[_Idx] = _Pending[_Idx];
                 }
 
-                if (_Last - _Bytes < _Trailing) { // incomplete sequence, break
-                    return static_cast<size_t>(-1);
+                for (size_t _Idx = 0; _Idx < _Taken; ++_Idx) {
+                    _Sequence[_Pending_size + _Idx] = static_cast<uint8_t>(_Bytes[_Idx]);
+                }
+
+                const size_t _Sequence_size = _Pending_size + _Taken;
+                const utf8_error _Error     = _Validate_utf8_scalar(_Sequence, _Sequence_size, 0, 1).error;
+                if (_Error == utf8_error::incomplete_sequence) { // still incomplete, wait for the next chunk
+                    for (size_t _Idx = _Pending_size; _Idx < _Sequence_size; ++_Idx) {
+                        _Pending[_Idx] = _Sequence[_Idx];
+                    }
+
+                    _Pending_size = static_cast<byte_t>(_Sequence_size);
+                    return {_Size, 0, conversion_status::ok};
+                } else if (_Error != utf8_error::none) { // the split sequence is invalid, break
+                    return {0, 0, conversion_status::invalid_input};
                 }
 
-                _Bytes += _Trailing;
+                const conversion_result _Result = _Decode_utf8_into(_Sequence, _Sequence_size, _Buf, _Buf_size);
+                if (_Result.status != conversion_status::ok) { // no space left for the split character, break
+                    return {0, 0, conversion_status::destination_full};
+                }
+
+                _Pending_size = 0;
+                _Read                = _Taken;
+                _Written             = _Result.written;
             }
 
-            return _Count;
+            conversion_result _Result =
+                _Decode_utf8_into(_Bytes + _Read, _Size - _Read, _Buf + _Written, _Buf_size - _Written);
+            _Result.read    += _Read;
+            _Result.written += _Written;
+            if (_Result.status == conversion_status::invalid_input && _Size - _Result.read < 4) {
+                // the chunk may end in the middle of a sequence, keep it for the next chunk
+                const size_t _Tail = _Size - _Result.read;
+                if (_Validate_utf8_scalar(_Bytes + _Result.read, _Tail, 0, _Tail).error
+                    == utf8_error::incomplete_sequence) {
+                    for (size_t _Idx = 0; _Idx < _Tail; ++_Idx) {
+                        _Pending[_Idx] = static_cast<byte_t>(_Bytes[_Result.read + _Idx]);
+                    }
+
+                    _Pending_size = static_cast<byte_t>(_Tail);
+                    _Result.read         = _Size;
+                    _Result.status       = conversion_status::ok;
+                }
+            }
+
+            return _Result;
         }
 
         template <class _Elem>
-        constexpr bool _Decode_utf8(const _Elem* _Bytes, const size_t _Size, wchar_t* _Buf) noexcept {
-            // decode _Bytes to Unicode and write to _Buf, assumes _Buf can fit all characters
-            const _Elem* const _Last = _Bytes + _Size;
-            size_t _Trailing;
-            uint8_t _Byte;
-            uint32_t _Least_code_point;
-            uint32_t _Code_point;
-            while (_Bytes != _Last) {
-                _Byte = static_cast<uint8_t>(*_Bytes++);
-                if (_Byte <= 0x7F) { // 0XXXXXXX pattern, single byte
-                    _Least_code_point = 0x00;
-                    _Code_point       = static_cast<uint32_t>(_Byte);
-                    _Trailing         = 0;
-                } else if (_Byte >= 0xC0 && _Byte <= 0xDF) { // 110XXXXX pattern, two bytes
-                    _Least_code_point = 0x80;
-                    _Code_point       = static_cast<uint32_t>(_Byte & 0x1F);
-                    _Trailing         = 1;
-                } else if (_Byte <= 0xEF) { // 1110XXXX pattern, three bytes
-                    _Least_code_point = 0x0800;
-                    _Code_point       = static_cast<uint32_t>(_Byte & 0x0F);
-                    _Trailing         = 2;
-                } else if (_Byte <= 0xF7) { // 11110XXX pattern, four bytes
-                    _Least_code_point = 0x0001'0000;
-                    _Code_point       = static_cast<uint32_t>(_Byte & 0x07);
-                    _Trailing         = 3;
-                } else { // invalid leading byte, break
-                    return false;
+        constexpr conversion_result _Encode_utf8_chunk(wchar_t& _High_surrogate,
+            const wchar_t* const _Chars, const size_t _Size, _Elem* const _Buf, const size_t _Buf_size) noexcept {
+            // encode _Chars to UTF-8, a high surrogate at the end of _Chars is stored in _High_surrogate
+            size_t _Read    = 0;
+            size_t _Written = 0;
+            if (_High_surrogate != 0) { // complete the surrogate pair split by the previous chunk
+                if (_Size == 0) { // nothing to complete the pair with
+                    return {0, 0, conversion_status::ok};
                 }
 
-                if (_Last - _Bytes < _Trailing) { // incomplete sequence, break
-                    return false;
+                const wchar_t _Pair[2]          = {_High_surrogate, _Chars[0]};
+                const conversion_result _Result = _Encode_utf8_into(_Pair, 2, _Buf, _Buf_size);
+                if (_Result.status != conversion_status::ok) { // invalid pair or no space left, break
+                    return {0, 0, _Result.status};
                 }
 
-                while (_Trailing-- > 0) {
-                    _Byte = static_cast<uint8_t>(*_Bytes++);
-                    if (_Byte < 0x80 || _Byte > 0xBF) { // invalid trailing byte, break
-                        return false;
-                    }
+                _High_surrogate = 0;
+                _Read                  = 1;
+                _Written               = _Result.written;
+            }
 
-                    _Code_point = (_Code_point << 6) | (_Byte & 0x3F);
+            conversion_result _Result =
+                _Encode_utf8_into(_Chars + _Read, _Size - _Read, _Buf + _Written, _Buf_size - _Written);
+            _Result.read    += _Read;
+            _Result.written += _Written;
+            if constexpr (_Is_utf16_wchar) {
+                if (_Result.status == conversion_status::invalid_input && _Result.read + 1 == _Size) {
+                    const wchar_t _Last = _Chars[_Result.read];
+                    if (_Last >= 0xD800 && _Last <= 0xDBFF) { // keep the high surrogate for the next chunk
+                        _High_surrogate = _Last;
+                        _Result.read           = _Size;
+                        _Result.status         = conversion_status::ok;
+                    }
                 }
+            }
+
+            return _Result;
+        }
+
+#ifdef _MJX_LINUX
+        // Note: On Linux, Unicode characters are typically stored in UTF-32 encoding,
+        //       which means wchar_t should be 4 bytes long. This implementation handles
+        //       UCS-4 code points, which also rely on a 4-byte wchar_t type.
+        static_assert(sizeof(wchar_t) == 4, "unexpected wchar_t size");
 
-                if (_Code_point < _Least_code_point) { // overlong encoding detected, break
-                    return false;
+        constexpr size_t _Calculate_utf8_encoded_length(const wchar_t* _Chars, const size_t _Size) noexcept {
+            // calculate the length of the UTF-8 encoded string from _Chars
+            const wchar_t* const _Last = _Chars + _Size;
+            size_t _Count              = 0;
+            uint32_t _Code_point;
+            for (; _Chars != _Last; ++_Chars) {
+                _Code_point = static_cast<uint32_t>(*_Chars);
+                if (_Code_point <= 0x7F) { // U+0000...U+007F, single byte
+                    ++_Count;
+                } else if (_Code_point <= 0x07FF) { // U+0080...U+07FF, two bytes
+                    _Count += 2;
+                } else if (_Code_point <= 0xFFFF) { // U+0800...U+FFFF, three bytes
+                    if (_Code_point >= 0xD800 && _Code_point <= 0xDFFF) { // lone surrogate, break
+                        return static_cast<size_t>(-1);
+                    }
+
+                    _Count += 3;
+                } else if (_Code_point <= 0x0010'FFFF) { // U+010000...U+01FFFF, four bytes
+                    _Count += 4;
+                } else { // invalid code point (too big), break
+                    return static_cast<size_t>(-1);
                 }
+            }
 
-                *_Buf++ = static_cast<wchar_t>(_Code_point);
+            return _Count;
+        }
+
+        template <class _Elem>
+        constexpr size_t _Encode_utf8(const wchar_t* _Chars, const size_t _Size, _Elem* _Buf) noexcept {
+            // encode _Chars to UTF-8 and write to _Buf, assumes _Buf can fit all bytes (at most 4 per character),
+            // returns the number of written bytes
+            const conversion_result _Result = _Encode_utf8_into(_Chars, _Size, _Buf, _Size * 4);
+            return _Result.status == conversion_status::ok ? _Result.written : static_cast<size_t>(-1);
+        }
+
+        template <class _Elem>
+        constexpr size_t _Calculate_utf8_decoded_length(const _Elem* _Bytes, const size_t _Size) noexcept {
+            // calculate the length of the UTF-8 decoded string from _Bytes
+            if (_Validate_utf8(_Bytes, _Size).error != utf8_error::none) { // invalid UTF-8, break
+                return static_cast<size_t>(-1);
+            }
+
+            // every character starts with exactly one non-continuation byte
+            const _Elem* const _Last = _Bytes + _Size;
+            size_t _Count            = 0;
+            for (; _Bytes != _Last; ++_Bytes) {
+                if (!_Is_continuation_byte(static_cast<uint8_t>(*_Bytes))) {
+                    ++_Count;
+                }
             }
 
-            return true;
+            return _Count;
+        }
+
+        template <class _Elem>
+        constexpr size_t _Decode_utf8(const _Elem* _Bytes, const size_t _Size, wchar_t* _Buf) noexcept {
+            // decode _Bytes to Unicode and write to _Buf, assumes _Buf can fit all characters (at most one
+            // per byte), returns the number of written characters
+            const conversion_result _Result = _Decode_utf8_into(_Bytes, _Size, _Buf, _Size);
+            return _Result.status == conversion_status::ok ? _Result.written : static_cast<size_t>(-1);
         }
 #endif // _MJX_LINUX
 
@@ -184,13 +372,24 @@ namespace mjx {
 #endif // _MJX_WINDOWS
             }
 
-            static bool _Convert(const _Multibyte* const _Str,
+            static constexpr size_t _Max_buffer_size(const size_t _Size) noexcept {
+                // every wide character is encoded with at least one byte
+                return _Size;
+            }
+
+            static size_t _Convert(const _Multibyte* const _Str,
                 const size_t _Str_size, wchar_t* const _Buf, const size_t _Buf_size) noexcept {
-                // convert multibyte character sequence to wide characters
+                // convert multibyte character sequence to wide characters, returns the number of characters
 #ifdef _MJX_WINDOWS
-                return static_cast<size_t>(::MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS,
-                    reinterpret_cast<const char*>(_Str), static_cast<int>(_Str_size),
-                        _Buf, static_cast<int>(_Buf_size))) == _Buf_size;
+                const size_t _Ascii = _Widen_ascii(_Str, _Str_size, _Buf); // convert leading ASCII bytes
+                if (_Ascii == _Str_size) { // nothing left to convert
+                    return _Ascii;
+                }
+
+                const int _Written = ::MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS,
+                    reinterpret_cast<const char*>(_Str + _Ascii), static_cast<int>(_Str_size - _Ascii),
+                        _Buf + _Ascii, static_cast<int>(_Buf_size - _Ascii));
+                return _Written > 0 ? _Ascii + static_cast<size_t>(_Written) : static_cast<size_t>(-1);
 #else // ^^^ _MJX_WINDOWS ^^^ / vvv _MJX_LINUX vvv
                 (void) _Buf_size;
                 return _Decode_utf8(_Str, _Str_size, _Buf);
@@ -218,13 +417,29 @@ namespace mjx {
 #endif // _MJX_WINDOWS
             }
 
-            static bool _Convert(const wchar_t* const _Str,
+            static constexpr size_t _Max_buffer_size(const size_t _Size) noexcept {
+#ifdef _MJX_WINDOWS
+                // UTF-16 code units are encoded with at most three bytes (surrogate pairs take four bytes)
+                return _Size * 3;
+#else // ^^^ _MJX_WINDOWS ^^^ / vvv _MJX_LINUX vvv
+                // UTF-32 code units are encoded with at most four bytes
+                return _Size * 4;
+#endif // _MJX_WINDOWS
+            }
+
+            static size_t _Convert(const wchar_t* const _Str,
                 const size_t _Str_size, _Multibyte* const _Buf, const size_t _Buf_size) noexcept {
-                // convert wide character sequence to multibyte
+                // convert wide character sequence to multibyte, returns the number of written bytes
 #ifdef _MJX_WINDOWS
-                return static_cast<size_t>(::WideCharToMultiByte(CP_UTF8, WC_NO_BEST_FIT_CHARS,
-                    _Str, static_cast<int>(_Str_size), reinterpret_cast<char*>(_Buf),
-                        static_cast<int>(_Buf_size), nullptr, nullptr)) == _Buf_size;
+                const size_t _Ascii = _Narrow_ascii(_Str, _Str_size, _Buf); // convert leading ASCII characters
+                if (_Ascii == _Str_size) { // nothing left to convert
+                    return _Ascii;
+                }
+
+                const int _Written = ::WideCharToMultiByte(CP_UTF8, WC_ERR_INVALID_CHARS,
+                    _Str + _Ascii, static_cast<int>(_Str_size - _Ascii), reinterpret_cast<char*>(_Buf + _Ascii),
+                        static_cast<int>(_Buf_size - _Ascii), nullptr, nullptr);
+                return _Written > 0 ? _Ascii + static_cast<size_t>(_Written) : static_cast<size_t>(-1);
 #else // ^^^ _MJX_WINDOWS ^^^ / vvv _MJX_LINUX vvv
                 (void) _Buf_size;
                 return _Encode_utf8(_Str, _Str_size, _Buf);
@@ -238,16 +453,27 @@ namespace mjx {
 
         template <class _Extern_char, class _Intern_char>
         inline string<_Extern_char> _Convert_string(const _Intern_char* const _Str, const size_t _Size) {
-            using _Traits          = _Choose_cvt_traits<_Extern_char, _Intern_char>;
-            using _Str_t           = string<_Extern_char>;
-            const size_t _Buf_size = _Traits::_Required_buffer_size(_Str, _Size);
-            if (_Buf_size == 0 || _Buf_size == static_cast<size_t>(-1)) {
-                // no conversion needed or an error occured, break
+            // Note: The conversion is done in a single pass. The buffer is allocated for the worst case
+            //       and isn't initialized, then its size is set to the number of written characters.
+            //       The worst case may take up to four times more memory than needed, so the buffer
+            //       is reallocated if less than half of it is used.
+            using _Traits = _Choose_cvt_traits<_Extern_char, _Intern_char>;
+            using _Str_t  = string<_Extern_char>;
+            if (_Size == 0) { // no conversion needed, break
                 return _Str_t{};
             }
 
-            _Str_t _Buf(_Buf_size, _Extern_char{0});
-            return _Traits::_Convert(_Str, _Size, _Buf.data(), _Buf_size) ? ::std::move(_Buf) : _Str_t{};
+            _Str_t _Buf;
+            _Buf.resize_and_overwrite(_Traits::_Max_buffer_size(_Size), // may throw
+                [_Str, _Size](_Extern_char* const _Dest, const size_t _Dest_size) noexcept {
+                    const size_t _Written = _Traits::_Convert(_Str, _Size, _Dest, _Dest_size);
+                    return _Written != static_cast<size_t>(-1) ? _Written : 0; // empty on error
+                });
+            if (_Buf.capacity() - _Buf.size() > _Buf.size()) { // too much unused memory, release it
+                _Buf.shrink_to_fit(); // may throw
+            }
+
+            return _Buf;
         }
 
         template <class _Extern_char, class _Intern_char>
@@ -255,6 +481,29 @@ namespace mjx {
             using _Traits = _Choose_cvt_traits<_Extern_char, _Intern_char>;
             return _Traits::_Required_buffer_size(_Str.data(), _Str.size());
         }
+
+        template <class _Extern_char, class _Intern_char>
+        inline conversion_result _Convert_into(const string_view<_Intern_char> _Str,
+            _Extern_char* const _Buf, const size_t _Buf_size) noexcept {
+            if constexpr (::std::is_same_v<_Intern_char, wchar_t>) { // Unicode to byte/UTF-8
+                return _Encode_utf8_into(_Str.data(), _Str.size(), _Buf, _Buf_size);
+            } else if constexpr (::std::is_same_v<_Extern_char, wchar_t>) { // byte/UTF-8 to Unicode
+                return _Decode_utf8_into(_Str.data(), _Str.size(), _Buf, _Buf_size);
+            } else { // byte to UTF-8 or vice versa, no conversion needed
+                return _Copy_utf8_into(_Str.data(), _Str.size(), _Buf, _Buf_size);
+            }
+        }
+
+        template <class _Extern_char, class _Intern_char>
+        inline conversion_result _Convert_into_string(
+            const string_view<_Intern_char> _Str, string<_Extern_char>& _Dest) noexcept {
+            // convert into the spare capacity of _Dest and append the converted characters
+            const size_t _Spare             = _Dest.capacity() - _Dest.size();
+            _Extern_char* const _Buf        = _Dest.append_uninitialized(_Spare); // never allocates
+            const conversion_result _Result = _Convert_into(_Str, _Buf, _Spare);
+            _Dest.commit(_Result.written);
+            return _Result;
+        }
     } // namespace mjstr_impl
 } // namespace mjx
 
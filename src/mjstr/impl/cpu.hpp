@@ -0,0 +1,73 @@
+// cpu.hpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#ifndef _MJSTR_IMPL_CPU_HPP_
+#define _MJSTR_IMPL_CPU_HPP_
+#ifdef _MJX_MSVC
+#include <intrin.h>
+#endif // _MJX_MSVC
+
+// Note: Functions that use SSE2/AVX2 intrinsics must be compiled for the specific instruction set.
+//       MSVC allows intrinsics in any function, while Clang and GCC require the target attribute,
+//       since the library itself is compiled for the baseline x86/x64 architecture.
+#if defined(_MJX_CLANG) || defined(_MJX_GCC)
+#define _MJSTR_TARGET_SSE2 __attribute__((target("sse2")))
+#define _MJSTR_TARGET_AVX2 __attribute__((target("avx2")))
+#else // ^^^ Clang or GCC ^^^ / vvv MSVC vvv
+#define _MJSTR_TARGET_SSE2
+#define _MJSTR_TARGET_AVX2
+#endif // defined(_MJX_CLANG) || defined(_MJX_GCC)
+
+namespace mjx {
+    namespace mjstr_impl {
+        enum class _Isa_level : unsigned char { // the best instruction set supported by the CPU
+            _Scalar,
+            _Sse2,
+            _Avx2
+        };
+
+        inline _Isa_level _Detect_isa_level() noexcept {
+#ifdef _MJX_MSVC
+            int _Regs[4];
+            ::__cpuid(_Regs, 0);
+            if (_Regs[0] < 7) { // extended features not available
+                ::__cpuid(_Regs, 1);
+                return (_Regs[3] & (1 << 26)) != 0 ? _Isa_level::_Sse2 : _Isa_level::_Scalar;
+            }
+
+            ::__cpuid(_Regs, 1);
+            const bool _Has_sse2    = (_Regs[3] & (1 << 26)) != 0;
+            const bool _Has_osxsave = (_Regs[2] & (1 << 27)) != 0;
+            const bool _Has_avx     = (_Regs[2] & (1 << 28)) != 0;
+            ::__cpuidex(_Regs, 7, 0);
+            const bool _Has_avx2 = (_Regs[1] & (1 << 5)) != 0;
+            if (_Has_osxsave && _Has_avx && _Has_avx2) {
+                // AVX2 is usable only if the OS saves YMM registers on context switch
+                if ((::_xgetbv(0) & 0x6) == 0x6) {
+                    return _Isa_level::_Avx2;
+                }
+            }
+
+            return _Has_sse2 ? _Isa_level::_Sse2 : _Isa_level::_Scalar;
+#else // ^^^ MSVC ^^^ / vvv Clang or GCC vvv
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2")) { // also checks whether the OS supports YMM registers
+                return _Isa_level::_Avx2;
+            }
+
+            return __builtin_cpu_supports("sse2") ? _Isa_level::_Sse2 : _Isa_level::_Scalar;
+#endif // _MJX_MSVC
+        }
+
+        inline _Isa_level _Get_isa_level() noexcept {
+            // detect the instruction set once, the result never changes
+            static const _Isa_level _Level = _Detect_isa_level();
+            return _Level;
+        }
+    } // namespace mjstr_impl
+} // namespace mjx
+
+#endif // _MJSTR_IMPL_CPU_HPP_
\ No newline at end of file
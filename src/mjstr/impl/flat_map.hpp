@@ -0,0 +1,93 @@
+// flat_map.hpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#ifndef _MJSTR_IMPL_FLAT_MAP_HPP_
+#define _MJSTR_IMPL_FLAT_MAP_HPP_
+#include <cstddef>
+#include <cstdint>
+#include <mjstr/impl/cpu.hpp>
+
+// Note: The groups are probed on every lookup, which is too often for the runtime ISA dispatch used by
+//       the other kernels. SSE2 is used only if the compiler may already assume it, that is always on x64
+//       and on x86 only with -msse2 (GCC and Clang) or /arch:SSE2 or higher (MSVC).
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define _MJSTR_FLAT_MAP_SSE2 1
+#include <immintrin.h>
+#else // ^^^ SSE2 ^^^ / vvv scalar vvv
+#define _MJSTR_FLAT_MAP_SSE2 0
+#endif // defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+
+namespace mjx {
+    namespace mjstr_impl {
+        // Note: Every slot of the map has a control byte, it's either empty, deleted, or holds the 7 low bits
+        //       of the key's hash (the fingerprint) if the slot is full. The control bytes are scanned in groups
+        //       of 16, so one probe compares 16 fingerprints at once and touches the entries only on a match.
+        inline constexpr int8_t _Ctrl_empty   = -128; // 0b10000000
+        inline constexpr int8_t _Ctrl_deleted = -2; // 0b11111110
+
+        inline constexpr size_t _Ctrl_group_size = 16;
+
+        struct _Ctrl_group { // the control bytes of 16 slots followed by the positions of their entries
+            int8_t _Ctrl[_Ctrl_group_size];
+            uint32_t _Offsets[_Ctrl_group_size]; // in units of the entry alignment
+        };
+
+#if _MJSTR_FLAT_MAP_SSE2
+        _MJSTR_TARGET_SSE2 inline void _Prefetch_offsets(const _Ctrl_group& _Group) noexcept {
+            // the group spans two cache lines, load the second one while the first one is being scanned
+            _mm_prefetch(reinterpret_cast<const char*>(_Group._Offsets + _Ctrl_group_size - 1), _MM_HINT_T0);
+        }
+
+        _MJSTR_TARGET_SSE2 inline uint32_t _Match_fingerprint(
+            const _Ctrl_group& _Group, const int8_t _Fingerprint) noexcept {
+            // returns a bit mask of the slots with the given fingerprint
+            const __m128i _Ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Group._Ctrl));
+            return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_Ctrl, _mm_set1_epi8(_Fingerprint))));
+        }
+
+        _MJSTR_TARGET_SSE2 inline uint32_t _Match_empty(const _Ctrl_group& _Group) noexcept {
+            // returns a bit mask of the empty slots
+            const __m128i _Ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Group._Ctrl));
+            return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_Ctrl, _mm_set1_epi8(_Ctrl_empty))));
+        }
+
+        _MJSTR_TARGET_SSE2 inline uint32_t _Match_free(const _Ctrl_group& _Group) noexcept {
+            // returns a bit mask of the empty and deleted slots (the only ones with the highest bit set)
+            return static_cast<uint32_t>(
+                _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(_Group._Ctrl))));
+        }
+#else // ^^^ _MJSTR_FLAT_MAP_SSE2 ^^^ / vvv !_MJSTR_FLAT_MAP_SSE2 vvv
+        inline void _Prefetch_offsets(const _Ctrl_group&) noexcept {}
+
+        inline uint32_t _Match_fingerprint(const _Ctrl_group& _Group, const int8_t _Fingerprint) noexcept {
+            // returns a bit mask of the slots with the given fingerprint
+            uint32_t _Mask = 0;
+            for (size_t _Idx = 0; _Idx < _Ctrl_group_size; ++_Idx) {
+                _Mask |= static_cast<uint32_t>(_Group._Ctrl[_Idx] == _Fingerprint) << _Idx;
+            }
+
+            return _Mask;
+        }
+
+        inline uint32_t _Match_empty(const _Ctrl_group& _Group) noexcept {
+            // returns a bit mask of the empty slots
+            return _Match_fingerprint(_Group, _Ctrl_empty);
+        }
+
+        inline uint32_t _Match_free(const _Ctrl_group& _Group) noexcept {
+            // returns a bit mask of the empty and deleted slots (the only ones with the highest bit set)
+            uint32_t _Mask = 0;
+            for (size_t _Idx = 0; _Idx < _Ctrl_group_size; ++_Idx) {
+                _Mask |= static_cast<uint32_t>(_Group._Ctrl[_Idx] < 0) << _Idx;
+            }
+
+            return _Mask;
+        }
+#endif // _MJSTR_FLAT_MAP_SSE2
+    } // namespace mjstr_impl
+} // namespace mjx
+
+#endif // _MJSTR_IMPL_FLAT_MAP_HPP_
\ No newline at end of file
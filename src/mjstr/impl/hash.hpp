@@ -0,0 +1,132 @@
+// hash.hpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#ifndef _MJSTR_IMPL_HASH_HPP_
+#define _MJSTR_IMPL_HASH_HPP_
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mjstr/api.hpp>
+#ifdef _MJX_MSVC
+#include <intrin.h>
+#endif // _MJX_MSVC
+
+namespace mjx {
+    namespace mjstr_impl {
+        // Note: Short and medium inputs are hashed inline with a multiply-mix design (wyhash), each 128-bit
+        //       product is folded by XOR-ing its halves. Long inputs are hashed by the library, see hash_long.hpp.
+        inline constexpr uint64_t _Hash_p0 = 0xA0761D6478BD642Full;
+        inline constexpr uint64_t _Hash_p1 = 0xE7037ED1A0B428DBull;
+        inline constexpr uint64_t _Hash_p2 = 0x8EBC6AF09C88C6DBull;
+        inline constexpr uint64_t _Hash_p3 = 0x589965CC75374CC3ull;
+
+        inline constexpr size_t _Hash_long_threshold = 1024; // longer inputs are hashed by the library
+
+        inline uint64_t _Read64(const unsigned char* const _Ptr) noexcept {
+            uint64_t _Val;
+            ::memcpy(&_Val, _Ptr, sizeof(uint64_t));
+            return _Val;
+        }
+
+        inline uint64_t _Read32(const unsigned char* const _Ptr) noexcept {
+            uint32_t _Val;
+            ::memcpy(&_Val, _Ptr, sizeof(uint32_t));
+            return _Val;
+        }
+
+        inline void _Multiply128_portable(uint64_t& _Left, uint64_t& _Right) noexcept {
+            // builds the 128-bit product from four 32-bit partial products, used if there is no 128-bit type
+            const uint64_t _Low_low   = (_Left & 0xFFFF'FFFF) * (_Right & 0xFFFF'FFFF);
+            const uint64_t _High_low  = (_Left >> 32) * (_Right & 0xFFFF'FFFF);
+            const uint64_t _Low_high  = (_Left & 0xFFFF'FFFF) * (_Right >> 32);
+            const uint64_t _High_high = (_Left >> 32) * (_Right >> 32);
+            const uint64_t _Cross     = (_Low_low >> 32) + (_High_low & 0xFFFF'FFFF) + _Low_high; // can't overflow
+            _Left                     = (_Cross << 32) | (_Low_low & 0xFFFF'FFFF);
+            _Right                    = _High_high + (_High_low >> 32) + (_Cross >> 32);
+        }
+
+        inline void _Multiply128(uint64_t& _Left, uint64_t& _Right) noexcept {
+            // stores the low half of the 128-bit product in _Left and the high half in _Right
+#if defined(_MJX_MSVC) && defined(_M_X64)
+            _Left = ::_umul128(_Left, _Right, &_Right);
+#elif defined(__SIZEOF_INT128__) // ^^^ x64 MSVC ^^^ / vvv 64-bit Clang or GCC vvv
+            const unsigned __int128 _Product = static_cast<unsigned __int128>(_Left) * _Right;
+            _Left                            = static_cast<uint64_t>(_Product);
+            _Right                           = static_cast<uint64_t>(_Product >> 64);
+#else // ^^^ 64-bit Clang or GCC ^^^ / vvv x86 vvv
+            _Multiply128_portable(_Left, _Right);
+#endif // defined(_MJX_MSVC) && defined(_M_X64)
+        }
+
+        inline uint64_t _Mix(uint64_t _Left, uint64_t _Right) noexcept {
+            _Multiply128(_Left, _Right);
+            return _Left ^ _Right;
+        }
+
+        inline uint64_t _Hash_short(const unsigned char* _Ptr, const size_t _Size, uint64_t _Seed) noexcept {
+            // hashes up to _Hash_long_threshold bytes
+            _Seed ^= _Mix(_Seed ^ _Hash_p0, _Hash_p1);
+            uint64_t _Left;
+            uint64_t _Right;
+            if (_Size <= 16) {
+                if (_Size >= 4) { // two overlapping pairs of 32-bit words
+                    const size_t _Shift = (_Size >> 3) << 2;
+                    _Left               = (_Read32(_Ptr) << 32) | _Read32(_Ptr + _Shift);
+                    _Right = (_Read32(_Ptr + _Size - 4) << 32) | _Read32(_Ptr + _Size - 4 - _Shift);
+                } else if (_Size > 0) { // first, middle and last byte
+                    _Left  = (uint64_t{_Ptr[0]} << 16) | (uint64_t{_Ptr[_Size >> 1]} << 8) | _Ptr[_Size - 1];
+                    _Right = 0;
+                } else {
+                    _Left  = 0;
+                    _Right = 0;
+                }
+            } else {
+                size_t _Count = _Size;
+                if (_Count > 48) { // three independent chains
+                    uint64_t _Seed1 = _Seed;
+                    uint64_t _Seed2 = _Seed;
+                    do {
+                        _Seed  = _Mix(_Read64(_Ptr) ^ _Hash_p1, _Read64(_Ptr + 8) ^ _Seed);
+                        _Seed1 = _Mix(_Read64(_Ptr + 16) ^ _Hash_p2, _Read64(_Ptr + 24) ^ _Seed1);
+                        _Seed2 = _Mix(_Read64(_Ptr + 32) ^ _Hash_p3, _Read64(_Ptr + 40) ^ _Seed2);
+                        _Ptr   += 48;
+                        _Count -= 48;
+                    } while (_Count > 48);
+                    _Seed ^= _Seed1 ^ _Seed2;
+                }
+
+                while (_Count > 16) {
+                    _Seed  = _Mix(_Read64(_Ptr) ^ _Hash_p1, _Read64(_Ptr + 8) ^ _Seed);
+                    _Ptr   += 16;
+                    _Count -= 16;
+                }
+
+                // the last 16 bytes, may overlap with the already hashed ones
+                _Left  = _Read64(_Ptr + _Count - 16);
+                _Right = _Read64(_Ptr + _Count - 8);
+            }
+
+            _Left  ^= _Hash_p1;
+            _Right ^= _Seed;
+            _Multiply128(_Left, _Right);
+            return _Mix(_Left ^ _Hash_p0 ^ _Size, _Right ^ _Hash_p1);
+        }
+
+        // hashes _Size bytes, defined in the library
+        _MJSTR_API uint64_t _Hash_bytes(const void* const _Data, const size_t _Size, const uint64_t _Seed) noexcept;
+
+        inline uint64_t _Hash_bytes_inline(const void* const _Data, const size_t _Size, const uint64_t _Seed) noexcept {
+            // short inputs don't need to cross the library boundary
+            if (_Size <= _Hash_long_threshold) {
+                return _Hash_short(static_cast<const unsigned char*>(_Data), _Size, _Seed);
+            }
+
+            return _Hash_bytes(_Data, _Size, _Seed);
+        }
+    } // namespace mjstr_impl
+} // namespace mjx
+
+#endif // _MJSTR_IMPL_HASH_HPP_
\ No newline at end of file
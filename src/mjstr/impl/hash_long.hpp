@@ -0,0 +1,169 @@
+// hash_long.hpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#ifndef _MJSTR_IMPL_HASH_LONG_HPP_
+#define _MJSTR_IMPL_HASH_LONG_HPP_
+#include <cstddef>
+#include <cstdint>
+#include <immintrin.h>
+#include <mjstr/impl/cpu.hpp>
+#include <mjstr/impl/hash.hpp>
+
+namespace mjx {
+    namespace mjstr_impl {
+        // Note: Long inputs are split into 64-byte stripes accumulated in eight independent 64-bit lanes (xxh3),
+        //       which maps directly onto SSE2/AVX2 registers. All instruction sets produce the same hash.
+        inline constexpr size_t _Hash_stripe_size   = 64; // bytes accumulated at once
+        inline constexpr size_t _Hash_stripe_lanes  = _Hash_stripe_size / sizeof(uint64_t);
+        inline constexpr size_t _Hash_block_stripes = 16; // stripes between scrambles
+        inline constexpr size_t _Hash_block_size    = _Hash_stripe_size * _Hash_block_stripes;
+        inline constexpr uint64_t _Hash_scramble    = 0x9E3779B1ull; // 32-bit, fits _mm_mul_epu32()
+
+        struct _Hash_secret { // pseudo-random keys, every stripe of a block uses a different window
+            uint64_t _Lanes[_Hash_block_stripes + _Hash_stripe_lanes];
+        };
+
+        inline constexpr _Hash_secret _Make_hash_secret() noexcept {
+            // splitmix64 sequence, generated at compile time
+            _Hash_secret _Secret{};
+            uint64_t _State = _Hash_p0;
+            for (uint64_t& _Lane : _Secret._Lanes) {
+                _State        += 0x9E3779B97F4A7C15ull;
+                uint64_t _Val  = _State;
+                _Val           = (_Val ^ (_Val >> 30)) * 0xBF58476D1CE4E5B9ull;
+                _Val           = (_Val ^ (_Val >> 27)) * 0x94D049BB133111EBull;
+                _Lane          = _Val ^ (_Val >> 31);
+            }
+
+            return _Secret;
+        }
+
+        inline constexpr _Hash_secret _Secret = _Make_hash_secret();
+
+        inline uint64_t _Avalanche(uint64_t _Hash) noexcept {
+            _Hash ^= _Hash >> 37;
+            _Hash *= 0x165667919E3779F9ull;
+            return _Hash ^ (_Hash >> 32);
+        }
+
+        inline void _Accumulate_scalar(uint64_t* const _Acc, const unsigned char* const _Ptr,
+            const size_t _Stripes, const uint64_t* const _Keys) noexcept {
+            // every stripe uses the key window shifted by one lane
+            for (size_t _Stripe = 0; _Stripe < _Stripes; ++_Stripe) {
+                const unsigned char* const _Data = _Ptr + _Stripe * _Hash_stripe_size;
+                for (size_t _Lane = 0; _Lane < _Hash_stripe_lanes; ++_Lane) {
+                    const uint64_t _Val   = _Read64(_Data + _Lane * 8);
+                    const uint64_t _Keyed = _Val ^ _Keys[_Stripe + _Lane];
+                    _Acc[_Lane ^ 1]      += _Val; // keeps the data if the keyed product is zero
+                    _Acc[_Lane]          += (_Keyed & 0xFFFF'FFFF) * (_Keyed >> 32);
+                }
+            }
+        }
+
+        inline void _Scramble_scalar(uint64_t* const _Acc, const uint64_t* const _Keys) noexcept {
+            for (size_t _Lane = 0; _Lane < _Hash_stripe_lanes; ++_Lane) {
+                uint64_t _Val  = _Acc[_Lane];
+                _Val          ^= _Val >> 47;
+                _Val          ^= _Keys[_Lane];
+                _Acc[_Lane]    = _Val * _Hash_scramble;
+            }
+        }
+
+        _MJSTR_TARGET_SSE2 inline void _Accumulate_sse2(uint64_t* const _Acc, const unsigned char* const _Ptr,
+            const size_t _Stripes, const uint64_t* const _Keys) noexcept {
+            __m128i _Vacc[4];
+            for (size_t _Idx = 0; _Idx < 4; ++_Idx) {
+                _Vacc[_Idx] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Acc) + _Idx);
+            }
+
+            for (size_t _Stripe = 0; _Stripe < _Stripes; ++_Stripe) {
+                const __m128i* const _Data = reinterpret_cast<const __m128i*>(_Ptr + _Stripe * _Hash_stripe_size);
+                const __m128i* const _Key  = reinterpret_cast<const __m128i*>(_Keys + _Stripe);
+                for (size_t _Idx = 0; _Idx < 4; ++_Idx) {
+                    const __m128i _Val     = _mm_loadu_si128(_Data + _Idx);
+                    const __m128i _Keyed   = _mm_xor_si128(_Val, _mm_loadu_si128(_Key + _Idx));
+                    const __m128i _High    = _mm_srli_epi64(_Keyed, 32);
+                    const __m128i _Product = _mm_mul_epu32(_Keyed, _High);
+                    const __m128i _Swapped = _mm_shuffle_epi32(_Val, _MM_SHUFFLE(1, 0, 3, 2));
+                    _Vacc[_Idx] = _mm_add_epi64(_Vacc[_Idx], _mm_add_epi64(_Product, _Swapped));
+                }
+            }
+
+            for (size_t _Idx = 0; _Idx < 4; ++_Idx) {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(_Acc) + _Idx, _Vacc[_Idx]);
+            }
+        }
+
+        _MJSTR_TARGET_AVX2 inline void _Accumulate_avx2(uint64_t* const _Acc, const unsigned char* const _Ptr,
+            const size_t _Stripes, const uint64_t* const _Keys) noexcept {
+            __m256i _Vacc[2];
+            for (size_t _Idx = 0; _Idx < 2; ++_Idx) {
+                _Vacc[_Idx] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Acc) + _Idx);
+            }
+
+            for (size_t _Stripe = 0; _Stripe < _Stripes; ++_Stripe) {
+                const __m256i* const _Data = reinterpret_cast<const __m256i*>(_Ptr + _Stripe * _Hash_stripe_size);
+                const __m256i* const _Key  = reinterpret_cast<const __m256i*>(_Keys + _Stripe);
+                for (size_t _Idx = 0; _Idx < 2; ++_Idx) {
+                    const __m256i _Val     = _mm256_loadu_si256(_Data + _Idx);
+                    const __m256i _Keyed   = _mm256_xor_si256(_Val, _mm256_loadu_si256(_Key + _Idx));
+                    const __m256i _High    = _mm256_srli_epi64(_Keyed, 32);
+                    const __m256i _Product = _mm256_mul_epu32(_Keyed, _High);
+                    const __m256i _Swapped = _mm256_shuffle_epi32(_Val, _MM_SHUFFLE(1, 0, 3, 2));
+                    _Vacc[_Idx] = _mm256_add_epi64(_Vacc[_Idx], _mm256_add_epi64(_Product, _Swapped));
+                }
+            }
+
+            for (size_t _Idx = 0; _Idx < 2; ++_Idx) {
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Acc) + _Idx, _Vacc[_Idx]);
+            }
+        }
+
+        using _Accumulate_fn = void (*)(uint64_t*, const unsigned char*, size_t, const uint64_t*) noexcept;
+
+        inline _Accumulate_fn _Select_accumulate() noexcept {
+            switch (_Get_isa_level()) {
+            case _Isa_level::_Avx2:
+                return &_Accumulate_avx2;
+            case _Isa_level::_Sse2:
+                return &_Accumulate_sse2;
+            default:
+                return &_Accumulate_scalar;
+            }
+        }
+
+        inline uint64_t _Hash_long(const unsigned char* const _Ptr, const size_t _Size, const uint64_t _Seed,
+            const _Accumulate_fn _Accumulate) noexcept {
+            // hashes more than _Hash_long_threshold bytes
+            uint64_t _Acc[_Hash_stripe_lanes];
+            for (size_t _Lane = 0; _Lane < _Hash_stripe_lanes; ++_Lane) {
+                _Acc[_Lane] = _Secret._Lanes[_Lane] ^ _Seed;
+            }
+
+            const size_t _Blocks = (_Size - 1) / _Hash_block_size; // the last byte always goes to the tail
+            const uint64_t* const _Scramble_keys = _Secret._Lanes + _Hash_block_stripes;
+            for (size_t _Block = 0; _Block < _Blocks; ++_Block) {
+                _Accumulate(_Acc, _Ptr + _Block * _Hash_block_size, _Hash_block_stripes, _Secret._Lanes);
+                _Scramble_scalar(_Acc, _Scramble_keys);
+            }
+
+            // the remaining full stripes, then the last 64 bytes (may overlap with the already hashed ones)
+            const size_t _Tail_offset = _Blocks * _Hash_block_size;
+            const size_t _Stripes     = (_Size - _Tail_offset - 1) / _Hash_stripe_size;
+            _Accumulate(_Acc, _Ptr + _Tail_offset, _Stripes, _Secret._Lanes);
+            _Accumulate(_Acc, _Ptr + _Size - _Hash_stripe_size, 1, _Secret._Lanes + _Hash_block_stripes - 3);
+
+            uint64_t _Hash = _Size * _Hash_p0;
+            for (size_t _Lane = 0; _Lane < _Hash_stripe_lanes; _Lane += 2) {
+                _Hash += _Mix(_Acc[_Lane] ^ _Secret._Lanes[_Lane + 3], _Acc[_Lane + 1] ^ _Secret._Lanes[_Lane + 4]);
+            }
+
+            return _Avalanche(_Hash);
+        }
+    } // namespace mjstr_impl
+} // namespace mjx
+
+#endif // _MJSTR_IMPL_HASH_LONG_HPP_
\ No newline at end of file
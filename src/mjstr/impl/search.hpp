@@ -0,0 +1,371 @@
+// search.hpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#ifndef _MJSTR_IMPL_SEARCH_HPP_
+#define _MJSTR_IMPL_SEARCH_HPP_
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <immintrin.h>
+#include <mjstr/impl/char_traits.hpp>
+#include <mjstr/impl/cpu.hpp>
+#include <mjstr/impl/two_way.hpp>
+
+namespace mjx {
+    namespace mjstr_impl {
+        // Note: The SIMD search compares the first and the last character of the needle with two blocks
+        //       of the haystack, which are shifted by the needle size minus one. Only the positions where
+        //       both characters match are verified with _Eq(), which skips almost all false candidates
+        //       without any branch. Every element produces sizeof(_Elem) bits in the comparison mask.
+
+        template <class _Elem>
+        _MJSTR_TARGET_SSE2 inline __m128i _Broadcast_sse2(const _Elem _Ch) noexcept {
+            if constexpr (sizeof(_Elem) == 1) {
+                return _mm_set1_epi8(static_cast<char>(_Ch));
+            } else if constexpr (sizeof(_Elem) == 2) {
+                return _mm_set1_epi16(static_cast<short>(_Ch));
+            } else {
+                return _mm_set1_epi32(static_cast<int>(_Ch));
+            }
+        }
+
+        template <class _Elem>
+        _MJSTR_TARGET_SSE2 inline __m128i _Compare_sse2(const __m128i _Left, const __m128i _Right) noexcept {
+            if constexpr (sizeof(_Elem) == 1) {
+                return _mm_cmpeq_epi8(_Left, _Right);
+            } else if constexpr (sizeof(_Elem) == 2) {
+                return _mm_cmpeq_epi16(_Left, _Right);
+            } else {
+                return _mm_cmpeq_epi32(_Left, _Right);
+            }
+        }
+
+        template <class _Elem>
+        _MJSTR_TARGET_AVX2 inline __m256i _Broadcast_avx2(const _Elem _Ch) noexcept {
+            if constexpr (sizeof(_Elem) == 1) {
+                return _mm256_set1_epi8(static_cast<char>(_Ch));
+            } else if constexpr (sizeof(_Elem) == 2) {
+                return _mm256_set1_epi16(static_cast<short>(_Ch));
+            } else {
+                return _mm256_set1_epi32(static_cast<int>(_Ch));
+            }
+        }
+
+        template <class _Elem>
+        _MJSTR_TARGET_AVX2 inline __m256i _Compare_avx2(const __m256i _Left, const __m256i _Right) noexcept {
+            if constexpr (sizeof(_Elem) == 1) {
+                return _mm256_cmpeq_epi8(_Left, _Right);
+            } else if constexpr (sizeof(_Elem) == 2) {
+                return _mm256_cmpeq_epi16(_Left, _Right);
+            } else {
+                return _mm256_cmpeq_epi32(_Left, _Right);
+            }
+        }
+
+        template <class _Elem>
+        constexpr uint32_t _Element_mask(const int _Bit) noexcept {
+            // returns the bits that belong to the element that starts at _Bit
+            return ((1U << sizeof(_Elem)) - 1) << _Bit;
+        }
+
+        template <class _Elem>
+        inline bool _Verify_match(const _Elem* const _Candidate, const _Elem* const _Needle,
+            const size_t _Needle_size) noexcept {
+            // the first and the last character are already known to match
+            return _Needle_size <= 2 || _Char_traits<_Elem>::_Eq(_Candidate + 1, _Needle + 1, _Needle_size - 2);
+        }
+
+        inline constexpr size_t _Search_interrupted = static_cast<size_t>(-2);
+
+        template <class _Elem>
+        inline size_t _Search_scalar(const _Elem* const _Haystack, const size_t _Haystack_size,
+            const _Elem* const _Needle, const size_t _Needle_size, size_t& _Pos, size_t& _Budget) noexcept {
+            // search for the needle at positions [_Pos, _Haystack_size - _Needle_size]
+            const size_t _Last_pos = _Haystack_size - _Needle_size;
+            while (_Pos <= _Last_pos) {
+                const size_t _Idx = _Char_traits<_Elem>::_Find(_Haystack + _Pos, _Last_pos - _Pos + 1, *_Needle);
+                if (_Idx == static_cast<size_t>(-1)) { // no more candidates
+                    break;
+                }
+
+                _Pos += _Idx;
+                if (_Char_traits<_Elem>::_Eq(_Haystack + _Pos + 1, _Needle + 1, _Needle_size - 1)) {
+                    return _Pos;
+                }
+
+                ++_Pos;
+                if (--_Budget == 0) { // too many false candidates
+                    return _Search_interrupted;
+                }
+            }
+
+            return static_cast<size_t>(-1);
+        }
+
+        template <class _Elem>
+        inline size_t _Reverse_search_scalar(const _Elem* const _Haystack, size_t& _Candidates,
+            const _Elem* const _Needle, const size_t _Needle_size, size_t& _Budget) noexcept {
+            // search for the needle at positions [0, _Candidates), starting from the last one
+            while (_Candidates > 0) {
+                const _Elem* const _Candidate = _Haystack + --_Candidates;
+                if (*_Candidate == *_Needle) {
+                    if (_Char_traits<_Elem>::_Eq(_Candidate, _Needle, _Needle_size)) {
+                        return _Candidates;
+                    }
+
+                    if (--_Budget == 0) { // too many false candidates
+                        return _Search_interrupted;
+                    }
+                }
+            }
+
+            return static_cast<size_t>(-1);
+        }
+
+        template <class _Elem>
+        _MJSTR_TARGET_SSE2 size_t _Search_sse2(const _Elem* const _Haystack, const size_t _Haystack_size,
+            const _Elem* const _Needle, const size_t _Needle_size, size_t& _Pos, size_t& _Budget) noexcept {
+            constexpr size_t _Lanes  = 16 / sizeof(_Elem);
+            const size_t _Candidates = _Haystack_size - _Needle_size + 1;
+            const __m128i _First     = _Broadcast_sse2(_Needle[0]);
+            const __m128i _Last      = _Broadcast_sse2(_Needle[_Needle_size - 1]);
+            for (; _Pos + _Lanes <= _Candidates; _Pos += _Lanes) {
+                const _Elem* const _Block = _Haystack + _Pos;
+                const __m128i _Block_first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Block));
+                const __m128i _Block_last  =
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Block + _Needle_size - 1));
+                uint32_t _Mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_and_si128(
+                    _Compare_sse2<_Elem>(_Block_first, _First), _Compare_sse2<_Elem>(_Block_last, _Last))));
+                while (_Mask != 0) {
+                    const int _Bit    = ::std::countr_zero(_Mask);
+                    const size_t _Off = static_cast<size_t>(_Bit) / sizeof(_Elem);
+                    if (_Verify_match(_Block + _Off, _Needle, _Needle_size)) {
+                        return _Pos + _Off;
+                    }
+
+                    if (--_Budget == 0) { // too many false candidates, resume after this one
+                        _Pos += _Off + 1;
+                        return _Search_interrupted;
+                    }
+
+                    _Mask &= ~_Element_mask<_Elem>(_Bit);
+                }
+            }
+
+            return _Search_scalar(_Haystack, _Haystack_size, _Needle, _Needle_size, _Pos, _Budget);
+        }
+
+        template <class _Elem>
+        _MJSTR_TARGET_AVX2 size_t _Search_avx2(const _Elem* const _Haystack, const size_t _Haystack_size,
+            const _Elem* const _Needle, const size_t _Needle_size, size_t& _Pos, size_t& _Budget) noexcept {
+            constexpr size_t _Lanes  = 32 / sizeof(_Elem);
+            const size_t _Candidates = _Haystack_size - _Needle_size + 1;
+            const __m256i _First     = _Broadcast_avx2(_Needle[0]);
+            const __m256i _Last      = _Broadcast_avx2(_Needle[_Needle_size - 1]);
+            for (; _Pos + _Lanes <= _Candidates; _Pos += _Lanes) {
+                const _Elem* const _Block  = _Haystack + _Pos;
+                const __m256i _Block_first = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Block));
+                const __m256i _Block_last  =
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Block + _Needle_size - 1));
+                uint32_t _Mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(
+                    _Compare_avx2<_Elem>(_Block_first, _First), _Compare_avx2<_Elem>(_Block_last, _Last))));
+                while (_Mask != 0) {
+                    const int _Bit    = ::std::countr_zero(_Mask);
+                    const size_t _Off = static_cast<size_t>(_Bit) / sizeof(_Elem);
+                    if (_Verify_match(_Block + _Off, _Needle, _Needle_size)) {
+                        return _Pos + _Off;
+                    }
+
+                    if (--_Budget == 0) { // too many false candidates, resume after this one
+                        _Pos += _Off + 1;
+                        return _Search_interrupted;
+                    }
+
+                    _Mask &= ~_Element_mask<_Elem>(_Bit);
+                }
+            }
+
+            return _Search_scalar(_Haystack, _Haystack_size, _Needle, _Needle_size, _Pos, _Budget);
+        }
+
+        template <class _Elem>
+        _MJSTR_TARGET_SSE2 size_t _Reverse_search_sse2(const _Elem* const _Haystack, size_t& _Candidates,
+            const _Elem* const _Needle, const size_t _Needle_size, size_t& _Budget) noexcept {
+            constexpr size_t _Lanes = 16 / sizeof(_Elem);
+            const __m128i _First    = _Broadcast_sse2(_Needle[0]);
+            const __m128i _Last     = _Broadcast_sse2(_Needle[_Needle_size - 1]);
+            for (; _Candidates >= _Lanes; _Candidates -= _Lanes) {
+                const _Elem* const _Block  = _Haystack + (_Candidates - _Lanes);
+                const __m128i _Block_first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Block));
+                const __m128i _Block_last  =
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Block + _Needle_size - 1));
+                uint32_t _Mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_and_si128(
+                    _Compare_sse2<_Elem>(_Block_first, _First), _Compare_sse2<_Elem>(_Block_last, _Last))));
+                while (_Mask != 0) {
+                    const int _Bit    = 31 - ::std::countl_zero(_Mask) - static_cast<int>(sizeof(_Elem) - 1);
+                    const size_t _Off = static_cast<size_t>(_Bit) / sizeof(_Elem);
+                    if (_Verify_match(_Block + _Off, _Needle, _Needle_size)) {
+                        return _Candidates - _Lanes + _Off;
+                    }
+
+                    if (--_Budget == 0) { // too many false candidates, resume before this one
+                        _Candidates -= _Lanes - _Off;
+                        return _Search_interrupted;
+                    }
+
+                    _Mask &= ~_Element_mask<_Elem>(_Bit);
+                }
+            }
+
+            return _Reverse_search_scalar(_Haystack, _Candidates, _Needle, _Needle_size, _Budget);
+        }
+
+        template <class _Elem>
+        _MJSTR_TARGET_AVX2 size_t _Reverse_search_avx2(const _Elem* const _Haystack, size_t& _Candidates,
+            const _Elem* const _Needle, const size_t _Needle_size, size_t& _Budget) noexcept {
+            constexpr size_t _Lanes = 32 / sizeof(_Elem);
+            const __m256i _First    = _Broadcast_avx2(_Needle[0]);
+            const __m256i _Last     = _Broadcast_avx2(_Needle[_Needle_size - 1]);
+            for (; _Candidates >= _Lanes; _Candidates -= _Lanes) {
+                const _Elem* const _Block  = _Haystack + (_Candidates - _Lanes);
+                const __m256i _Block_first = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Block));
+                const __m256i _Block_last  =
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Block + _Needle_size - 1));
+                uint32_t _Mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(
+                    _Compare_avx2<_Elem>(_Block_first, _First), _Compare_avx2<_Elem>(_Block_last, _Last))));
+                while (_Mask != 0) {
+                    const int _Bit    = 31 - ::std::countl_zero(_Mask) - static_cast<int>(sizeof(_Elem) - 1);
+                    const size_t _Off = static_cast<size_t>(_Bit) / sizeof(_Elem);
+                    if (_Verify_match(_Block + _Off, _Needle, _Needle_size)) {
+                        return _Candidates - _Lanes + _Off;
+                    }
+
+                    if (--_Budget == 0) { // too many false candidates, resume before this one
+                        _Candidates -= _Lanes - _Off;
+                        return _Search_interrupted;
+                    }
+
+                    _Mask &= ~_Element_mask<_Elem>(_Bit);
+                }
+            }
+
+            return _Reverse_search_scalar(_Haystack, _Candidates, _Needle, _Needle_size, _Budget);
+        }
+
+        // Note: The SIMD search is quadratic in the worst case (e.g. "aaa...aba...aaa" in "aaa...aaa"), since
+        //       every position can pass the filter and fail late in the verification. For needles that
+        //       are at least _Two_way_threshold characters long, the number of failed verifications is limited
+        //       to a multiple of the number of non-overlapping windows, which keeps their cost linear.
+        //       Once the budget is exhausted, the rest of the haystack is searched with the Two-Way algorithm.
+        //       Shorter needles are never interrupted, their verification cost is bounded by the needle size.
+
+        inline constexpr size_t _Two_way_threshold = 32;
+
+        inline size_t _Verification_budget(const size_t _Haystack_size, const size_t _Needle_size) noexcept {
+            // returns the number of false candidates after which the search switches to the Two-Way algorithm
+            if (_Needle_size < _Two_way_threshold) {
+                return static_cast<size_t>(-1);
+            }
+
+            return _Haystack_size / _Needle_size * 4 + 64;
+        }
+
+        template <class _Elem>
+        inline size_t _Search(const _Elem* const _Haystack, const size_t _Haystack_size,
+            const _Elem* const _Needle, const size_t _Needle_size,
+            const _Two_way_table* _Table = nullptr) noexcept {
+            // finds the first occurrence of the needle, an empty needle is always found at the beginning,
+            // _Table may point to the precomputed forward table of the needle
+            if (_Needle_size > _Haystack_size) {
+                return static_cast<size_t>(-1);
+            }
+
+            switch (_Needle_size) {
+            case 0:
+                return 0;
+            case 1:
+                return _Char_traits<_Elem>::_Find(_Haystack, _Haystack_size, *_Needle);
+            default:
+                break;
+            }
+
+            size_t _Pos    = 0;
+            size_t _Budget = _Verification_budget(_Haystack_size, _Needle_size);
+            size_t _Result;
+            switch (_Get_isa_level()) {
+            case _Isa_level::_Avx2:
+                _Result = _Search_avx2(_Haystack, _Haystack_size, _Needle, _Needle_size, _Pos, _Budget);
+                break;
+            case _Isa_level::_Sse2:
+                _Result = _Search_sse2(_Haystack, _Haystack_size, _Needle, _Needle_size, _Pos, _Budget);
+                break;
+            default:
+                _Result = _Search_scalar(_Haystack, _Haystack_size, _Needle, _Needle_size, _Pos, _Budget);
+                break;
+            }
+
+            if (_Result != _Search_interrupted) {
+                return _Result;
+            }
+
+            _Two_way_table _Local_table;
+            if (!_Table) { // compute the table only when it's really needed
+                _Build_two_way_table(_Local_table, _Sequence<_Elem, false>{_Needle, _Needle_size});
+                _Table = &_Local_table;
+            }
+
+            _Result = _Two_way_search(*_Table, _Sequence<_Elem, false>{_Haystack + _Pos, _Haystack_size - _Pos},
+                _Sequence<_Elem, false>{_Needle, _Needle_size});
+            return _Result != static_cast<size_t>(-1) ? _Pos + _Result : _Result;
+        }
+
+        template <class _Elem>
+        inline size_t _Reverse_search(const _Elem* const _Haystack, const size_t _Haystack_size,
+            const _Elem* const _Needle, const size_t _Needle_size,
+            const _Two_way_table* _Table = nullptr) noexcept {
+            // finds the last occurrence of the needle, an empty needle is always found at the end,
+            // _Table may point to the precomputed table of the reversed needle
+            if (_Needle_size > _Haystack_size) {
+                return static_cast<size_t>(-1);
+            } else if (_Needle_size == 0) {
+                return _Haystack_size;
+            }
+
+            size_t _Candidates = _Haystack_size - _Needle_size + 1;
+            size_t _Budget     = _Verification_budget(_Haystack_size, _Needle_size);
+            size_t _Result;
+            switch (_Get_isa_level()) {
+            case _Isa_level::_Avx2:
+                _Result = _Reverse_search_avx2(_Haystack, _Candidates, _Needle, _Needle_size, _Budget);
+                break;
+            case _Isa_level::_Sse2:
+                _Result = _Reverse_search_sse2(_Haystack, _Candidates, _Needle, _Needle_size, _Budget);
+                break;
+            default:
+                _Result = _Reverse_search_scalar(_Haystack, _Candidates, _Needle, _Needle_size, _Budget);
+                break;
+            }
+
+            if (_Result != _Search_interrupted) {
+                return _Result;
+            }
+
+            _Two_way_table _Local_table;
+            if (!_Table) { // compute the table only when it's really needed
+                _Build_two_way_table(_Local_table, _Sequence<_Elem, true>{_Needle, _Needle_size});
+                _Table = &_Local_table;
+            }
+
+            // search the remaining candidates backwards, the result is relative to the end of that range
+            const size_t _Range_size = _Candidates + _Needle_size - 1;
+            _Result = _Two_way_search(*_Table, _Sequence<_Elem, true>{_Haystack, _Range_size},
+                _Sequence<_Elem, true>{_Needle, _Needle_size});
+            return _Result != static_cast<size_t>(-1) ? _Range_size - _Needle_size - _Result : _Result;
+        }
+    } // namespace mjstr_impl
+} // namespace mjx
+
+#endif // _MJSTR_IMPL_SEARCH_HPP_
\ No newline at end of file
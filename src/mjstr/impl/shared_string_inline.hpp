@@ -0,0 +1,49 @@
+// shared_string_inline.hpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#ifndef _MJSTR_IMPL_SHARED_STRING_INLINE_HPP_
+#define _MJSTR_IMPL_SHARED_STRING_INLINE_HPP_
+#include <mjstr/shared_string.hpp>
+
+namespace mjx {
+    template <class _Elem>
+    _MJSTR_INLINE typename shared_string<_Elem>::const_pointer
+        shared_string<_Elem>::_Rep_data(const _Rep* const _Target) noexcept {
+        return reinterpret_cast<const_pointer>(reinterpret_cast<const byte_t*>(_Target) + _Header_size);
+    }
+
+    template <class _Elem>
+    _MJSTR_INLINE shared_string<_Elem>::operator string_view<_Elem>() const noexcept {
+        return view();
+    }
+
+    template <class _Elem>
+    _MJSTR_INLINE string_view<_Elem> shared_string<_Elem>::view() const noexcept {
+        return _Myrep ? string_view<_Elem>{_Rep_data(_Myrep), _Myrep->_Size} : string_view<_Elem>{};
+    }
+
+    template <class _Elem>
+    _MJSTR_INLINE typename shared_string<_Elem>::const_pointer shared_string<_Elem>::data() const noexcept {
+        return _Myrep ? _Rep_data(_Myrep) : _Empty_str;
+    }
+
+    template <class _Elem>
+    _MJSTR_INLINE typename shared_string<_Elem>::const_pointer shared_string<_Elem>::c_str() const noexcept {
+        return data();
+    }
+
+    template <class _Elem>
+    _MJSTR_INLINE bool shared_string<_Elem>::empty() const noexcept {
+        return _Myrep == nullptr;
+    }
+
+    template <class _Elem>
+    _MJSTR_INLINE typename shared_string<_Elem>::size_type shared_string<_Elem>::size() const noexcept {
+        return _Myrep ? _Myrep->_Size : 0;
+    }
+} // namespace mjx
+
+#endif // _MJSTR_IMPL_SHARED_STRING_INLINE_HPP_
\ No newline at end of file
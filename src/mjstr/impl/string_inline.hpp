@@ -0,0 +1,399 @@
+// string_inline.hpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#ifndef _MJSTR_IMPL_STRING_INLINE_HPP_
+#define _MJSTR_IMPL_STRING_INLINE_HPP_
+#include <mjstr/impl/utils.hpp>
+#include <mjstr/string.hpp>
+#include <type_traits>
+
+namespace mjx {
+    template <class _Elem>
+    _MJSTR_CONSTEXPR string_const_iterator<_Elem>::string_const_iterator() noexcept
+#ifdef _DEBUG
+        : _Myptr(nullptr), _Mybegin(nullptr), _Myend(nullptr) {}
+#else // ^^^ _DEBUG ^^^ / vvv NDEBUG vvv
+        : _Myptr(nullptr) {}
+#endif // _DEBUG
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR string_const_iterator<_Elem>::string_const_iterator(
+#ifdef _DEBUG
+        pointer _First, pointer _Last) noexcept : _Myptr(_First), _Mybegin(_First), _Myend(_Last) {
+        _INTERNAL_ASSERT(_First <= _Last, "invalid iterator bounds");
+    }
+#else // ^^^ _DEBUG ^^^ / vvv NDEBUG vvv
+        pointer _Ptr) noexcept : _Myptr(_Ptr) {}
+#endif // _DEBUG
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR typename string_const_iterator<_Elem>::reference
+        string_const_iterator<_Elem>::operator*() const noexcept {
+#ifdef _DEBUG
+        _INTERNAL_ASSERT(_Myptr != nullptr && _Myptr != _Myend, "attempt to dereference invalid iterator");
+#endif // _DEBUG
+        return *_Myptr;
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR typename string_const_iterator<_Elem>::pointer
+        string_const_iterator<_Elem>::operator->() const noexcept {
+#ifdef _DEBUG
+        _INTERNAL_ASSERT(_Myptr != nullptr && _Myptr != _Myend, "attempt to dereference invalid iterator");
+#endif // _DEBUG
+        return _Myptr;
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR typename string_const_iterator<_Elem>::reference
+        string_const_iterator<_Elem>::operator[](const difference_type _Off) const noexcept {
+#ifdef _DEBUG
+        _INTERNAL_ASSERT(_Myptr != nullptr, "attempt to use invalid iterator");
+        _INTERNAL_ASSERT(_Myend - _Myptr >= _Off, "attempt to access non-existent element");
+#endif // _DEBUG
+        return _Myptr[_Off];
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR string_const_iterator<_Elem>& string_const_iterator<_Elem>::operator++() noexcept {
+#ifdef _DEBUG
+        _INTERNAL_ASSERT(_Myptr != nullptr, "attempt to use invalid iterator");
+        _INTERNAL_ASSERT(_Myend - _Myptr > 0, "attempt to advance iterator that points to the end");
+#endif // _DEBUG
+        ++_Myptr;
+        return *this;
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR string_const_iterator<_Elem> string_const_iterator<_Elem>::operator++(int) noexcept {
+        const string_const_iterator _Temp = *this;
+        ++*this;
+        return _Temp;
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR string_const_iterator<_Elem>& string_const_iterator<_Elem>::operator--() noexcept {
+#ifdef _DEBUG
+        _INTERNAL_ASSERT(_Myptr != nullptr, "attempt to use invalid iterator");
+        _INTERNAL_ASSERT(_Myptr - _Mybegin > 0, "attempt to retreat iterator that points to the beginning");
+#endif // _DEBUG
+        --_Myptr;
+        return *this;
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR string_const_iterator<_Elem> string_const_iterator<_Elem>::operator--(int) noexcept {
+        const string_const_iterator _Temp = *this;
+        --*this;
+        return _Temp;
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR string_const_iterator<_Elem>&
+        string_const_iterator<_Elem>::operator+=(const difference_type _Off) noexcept {
+#ifdef _DEBUG
+        _INTERNAL_ASSERT(_Myptr != nullptr, "attempt to use invalid iterator");
+        _INTERNAL_ASSERT(_Myend - _Myptr >= _Off, "attempt to advance iterator beyond the end");
+#endif // _DEBUG
+        _Myptr += _Off;
+        return *this;
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR string_const_iterator<_Elem>&
+        string_const_iterator<_Elem>::operator-=(const difference_type _Off) noexcept {
+#ifdef _DEBUG
+        _INTERNAL_ASSERT(_Myptr != nullptr, "attempt to use invalid iterator");
+        _INTERNAL_ASSERT(_Myptr - _Mybegin >= _Off, "attempt to retreat iterator beyond the beginning");
+#endif // _DEBUG
+        _Myptr -= _Off;
+        return *this;
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR string_const_iterator<_Elem>
+        string_const_iterator<_Elem>::operator+(const difference_type _Off) const noexcept {
+        string_const_iterator _Temp = *this;
+        _Temp                      += _Off;
+        return _Temp;
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR string_const_iterator<_Elem>
+        string_const_iterator<_Elem>::operator-(const difference_type _Off) const noexcept {
+        string_const_iterator _Temp = *this;
+        _Temp                      -= _Off;
+        return _Temp;
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR bool string_const_iterator<_Elem>::operator==(const string_const_iterator& _Other) const noexcept {
+        return _Myptr == _Other._Myptr;
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR ::std::strong_ordering
+        string_const_iterator<_Elem>::operator<=>(const string_const_iterator& _Other) const noexcept {
+        return _Myptr <=> _Other._Myptr;
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR string_iterator<_Elem>::string_iterator() noexcept : _Mybase() {}
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR string_iterator<_Elem>::string_iterator(
+#ifdef _DEBUG
+        pointer _First, pointer _Last) noexcept : _Mybase(_First, _Last) {}
+#else // ^^^ _DEBUG ^^^ / vvv NDEBUG vvv
+        pointer _Ptr) noexcept : _Mybase(_Ptr) {}
+#endif // _DEBUG
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR typename string_iterator<_Elem>::reference string_iterator<_Elem>::operator*() const noexcept {
+        return const_cast<reference>(_Mybase::operator*());
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR typename string_iterator<_Elem>::pointer string_iterator<_Elem>::operator->() const noexcept {
+        return const_cast<pointer>(_Mybase::operator->());
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR typename string_iterator<_Elem>::reference
+        string_iterator<_Elem>::operator[](const difference_type _Off) const noexcept {
+        return const_cast<reference>(_Mybase::operator[](_Off));
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR string_iterator<_Elem>& string_iterator<_Elem>::operator++() noexcept {
+        _Mybase::operator++();
+        return *this;
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR string_iterator<_Elem> string_iterator<_Elem>::operator++(int) noexcept {
+        string_iterator _Temp = *this;
+        _Mybase::operator++();
+        return _Temp;
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR string_iterator<_Elem>& string_iterator<_Elem>::operator--() noexcept {
+        _Mybase::operator--();
+        return *this;
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR string_iterator<_Elem> string_iterator<_Elem>::operator--(int) noexcept {
+        string_iterator _Temp = *this;
+        _Mybase::operator--();
+        return _Temp;
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR string_iterator<_Elem>& string_iterator<_Elem>::operator+=(const difference_type _Off) noexcept {
+        _Mybase::operator+=(_Off);
+        return *this;
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR string_iterator<_Elem>& string_iterator<_Elem>::operator-=(const difference_type _Off) noexcept {
+        _Mybase::operator-=(_Off);
+        return *this;
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR string_iterator<_Elem>
+        string_iterator<_Elem>::operator+(const difference_type _Off) const noexcept {
+        string_iterator _Temp = *this;
+        _Temp                += _Off;
+        return _Temp;
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR string_iterator<_Elem>
+        string_iterator<_Elem>::operator-(const difference_type _Off) const noexcept {
+        string_iterator _Temp = *this;
+        _Temp                -= _Off;
+        return _Temp;
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    _MJSTR_INLINE bool string<_Elem, _InlineBytes>::_Internal_buffer::_Is_small() const noexcept {
+        // Note: Only the last element is read to test the large flag. Reading the whole capacity right after
+        //       the small size was stored would prevent store-to-load forwarding and stall every access.
+        using _Unsigned_elem = ::std::make_unsigned_t<value_type>;
+        return (static_cast<_Unsigned_elem>(_Small[_Small_buffer_capacity]) & _Large_marker) == 0;
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    _MJSTR_INLINE typename string<_Elem, _InlineBytes>::pointer
+        string<_Elem, _InlineBytes>::_Internal_buffer::_Get() noexcept {
+        return _Is_small() ? _Small : _Large._Ptr;
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    _MJSTR_INLINE typename string<_Elem, _InlineBytes>::const_pointer
+        string<_Elem, _InlineBytes>::_Internal_buffer::_Get() const noexcept {
+        return _Is_small() ? _Small : _Large._Ptr;
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    _MJSTR_INLINE typename string<_Elem, _InlineBytes>::size_type
+        string<_Elem, _InlineBytes>::_Internal_buffer::_Get_size() const noexcept {
+        if (_Is_small()) { // the last element stores the number of unused characters
+            return _Small_buffer_capacity - static_cast<size_type>(_Small[_Small_buffer_capacity]);
+        }
+
+        return _Large._Size;
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    _MJSTR_INLINE typename string<_Elem, _InlineBytes>::size_type
+        string<_Elem, _InlineBytes>::_Internal_buffer::_Get_capacity() const noexcept {
+        return _Is_small() ? _Small_buffer_capacity : _Large._Capacity & _Capacity_mask;
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    _MJSTR_INLINE void string<_Elem, _InlineBytes>::_Internal_buffer::_Set_size(const size_type _New_size) noexcept {
+        if (_Is_small()) { // store the number of unused characters
+            _Small[_Small_buffer_capacity] = static_cast<value_type>(_Small_buffer_capacity - _New_size);
+        } else {
+            _Large._Size = _New_size;
+        }
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    _MJSTR_INLINE string<_Elem, _InlineBytes>::operator string_view<_Elem>() const noexcept {
+        return string_view<_Elem>{_Mybuf._Get(), _Mybuf._Get_size()};
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    _MJSTR_INLINE typename string<_Elem, _InlineBytes>::reference
+        string<_Elem, _InlineBytes>::operator[](const size_type _Idx) noexcept {
+        // no bounds checking is performed, the behavior is undefined if _Idx >= size()
+        return _Mybuf._Get()[_Idx];
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    _MJSTR_INLINE typename string<_Elem, _InlineBytes>::const_reference
+        string<_Elem, _InlineBytes>::operator[](const size_type _Idx) const noexcept {
+        // no bounds checking is performed, the behavior is undefined if _Idx >= size()
+        return _Mybuf._Get()[_Idx];
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    _MJSTR_INLINE typename string<_Elem, _InlineBytes>::iterator string<_Elem, _InlineBytes>::begin() noexcept {
+#ifdef _DEBUG
+        return iterator{_Mybuf._Get(), _Mybuf._Get() + _Mybuf._Get_size()};
+#else // ^^^ _DEBUG ^^^ / vvv NDEBUG vvv
+        return iterator{_Mybuf._Get()};
+#endif // _DEBUG
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    _MJSTR_INLINE typename string<_Elem, _InlineBytes>::const_iterator
+        string<_Elem, _InlineBytes>::begin() const noexcept {
+#ifdef _DEBUG
+        return const_iterator{_Mybuf._Get(), _Mybuf._Get() + _Mybuf._Get_size()};
+#else // ^^^ _DEBUG ^^^ / vvv NDEBUG vvv
+        return const_iterator{_Mybuf._Get()};
+#endif // _DEBUG
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    _MJSTR_INLINE typename string<_Elem, _InlineBytes>::iterator string<_Elem, _InlineBytes>::end() noexcept {
+#ifdef _DEBUG
+        return iterator{_Mybuf._Get() + _Mybuf._Get_size(), _Mybuf._Get() + _Mybuf._Get_size()};
+#else // ^^^ _DEBUG ^^^ / vvv NDEBUG vvv
+        return iterator{_Mybuf._Get() + _Mybuf._Get_size()};
+#endif // _DEBUG
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    _MJSTR_INLINE typename string<_Elem, _InlineBytes>::const_iterator
+        string<_Elem, _InlineBytes>::end() const noexcept {
+#ifdef _DEBUG
+        return const_iterator{_Mybuf._Get() + _Mybuf._Get_size(), _Mybuf._Get() + _Mybuf._Get_size()};
+#else // ^^^ _DEBUG ^^^ / vvv NDEBUG vvv
+        return const_iterator{_Mybuf._Get() + _Mybuf._Get_size()};
+#endif // _DEBUG
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    _MJSTR_INLINE typename string<_Elem, _InlineBytes>::reference string<_Elem, _InlineBytes>::front() noexcept {
+#ifdef _DEBUG
+        _INTERNAL_ASSERT(_Mybuf._Get_size() > 0, "attempt to access non-existent element");
+#endif // _DEBUG
+        return *_Mybuf._Get();
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    _MJSTR_INLINE typename string<_Elem, _InlineBytes>::const_reference
+        string<_Elem, _InlineBytes>::front() const noexcept {
+#ifdef _DEBUG
+        _INTERNAL_ASSERT(_Mybuf._Get_size() > 0, "attempt to access non-existent element");
+#endif // _DEBUG
+        return *_Mybuf._Get();
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    _MJSTR_INLINE typename string<_Elem, _InlineBytes>::reference string<_Elem, _InlineBytes>::back() noexcept {
+#ifdef _DEBUG
+        _INTERNAL_ASSERT(_Mybuf._Get_size() > 0, "attempt to access non-existent element");
+#endif // _DEBUG
+        return _Mybuf._Get()[_Mybuf._Get_size() - 1];
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    _MJSTR_INLINE typename string<_Elem, _InlineBytes>::const_reference
+        string<_Elem, _InlineBytes>::back() const noexcept {
+#ifdef _DEBUG
+        _INTERNAL_ASSERT(_Mybuf._Get_size() > 0, "attempt to access non-existent element");
+#endif // _DEBUG
+        return _Mybuf._Get()[_Mybuf._Get_size() - 1];
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    _MJSTR_INLINE typename string<_Elem, _InlineBytes>::pointer string<_Elem, _InlineBytes>::data() noexcept {
+        return _Mybuf._Get();
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    _MJSTR_INLINE typename string<_Elem, _InlineBytes>::const_pointer
+        string<_Elem, _InlineBytes>::data() const noexcept {
+        return _Mybuf._Get();
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    _MJSTR_INLINE typename string<_Elem, _InlineBytes>::const_pointer
+        string<_Elem, _InlineBytes>::c_str() const noexcept {
+        return _Mybuf._Get();
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    _MJSTR_INLINE bool string<_Elem, _InlineBytes>::empty() const noexcept {
+        return _Mybuf._Get_size() == 0;
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    _MJSTR_INLINE typename string<_Elem, _InlineBytes>::size_type
+        string<_Elem, _InlineBytes>::capacity() const noexcept {
+        return _Mybuf._Get_capacity();
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    _MJSTR_INLINE typename string<_Elem, _InlineBytes>::size_type string<_Elem, _InlineBytes>::size() const noexcept {
+        return _Mybuf._Get_size();
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    _MJSTR_INLINE string_view<_Elem> string<_Elem, _InlineBytes>::view() const noexcept {
+        return string_view<_Elem>{_Mybuf._Get(), _Mybuf._Get_size()};
+    }
+} // namespace mjx
+
+#endif // _MJSTR_IMPL_STRING_INLINE_HPP_
\ No newline at end of file
@@ -0,0 +1,234 @@
+// string_view_inline.hpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#ifndef _MJSTR_IMPL_STRING_VIEW_INLINE_HPP_
+#define _MJSTR_IMPL_STRING_VIEW_INLINE_HPP_
+#include <mjstr/impl/utils.hpp>
+#include <mjstr/string_view.hpp>
+
+namespace mjx {
+    template <class _Elem>
+    _MJSTR_CONSTEXPR string_view_iterator<_Elem>::string_view_iterator() noexcept
+#ifdef _DEBUG
+        : _Myptr(nullptr), _Mybegin(nullptr), _Myend(nullptr) {}
+#else // ^^^ _DEBUG ^^^ / vvv NDEBUG vvv
+        : _Myptr(nullptr) {}
+#endif // _DEBUG
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR string_view_iterator<_Elem>::string_view_iterator(
+#ifdef _DEBUG
+        pointer _First, pointer _Last) noexcept : _Myptr(_First), _Mybegin(_First), _Myend(_Last) {
+        _INTERNAL_ASSERT(_First <= _Last, "invalid iterator bounds");
+    }
+#else // ^^^ _DEBUG ^^^ / vvv NDEBUG vvv
+        pointer _Ptr) noexcept : _Myptr(_Ptr) {}
+#endif // _DEBUG
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR typename string_view_iterator<_Elem>::reference
+        string_view_iterator<_Elem>::operator*() const noexcept {
+#ifdef _DEBUG
+        _INTERNAL_ASSERT(_Myptr != nullptr && _Myptr != _Myend, "attempt to dereference invalid iterator");
+#endif // _DEBUG
+        return *_Myptr;
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR typename string_view_iterator<_Elem>::pointer
+        string_view_iterator<_Elem>::operator->() const noexcept {
+#ifdef _DEBUG
+        _INTERNAL_ASSERT(_Myptr != nullptr && _Myptr != _Myend, "attempt to dereference invalid iterator");
+#endif // _DEBUG
+        return _Myptr;
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR typename string_view_iterator<_Elem>::reference
+        string_view_iterator<_Elem>::operator[](const difference_type _Off) const noexcept {
+#ifdef _DEBUG
+        _INTERNAL_ASSERT(_Myptr != nullptr, "attempt to use invalid iterator");
+        _INTERNAL_ASSERT(_Myend - _Myptr >= _Off, "attempt to access non-existent element");
+#endif // _DEBUG
+        return _Myptr[_Off];
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR string_view_iterator<_Elem>& string_view_iterator<_Elem>::operator++() noexcept {
+#ifdef _DEBUG
+        _INTERNAL_ASSERT(_Myptr != nullptr, "attempt to use invalid iterator");
+        _INTERNAL_ASSERT(_Myend - _Myptr > 0, "attempt to advance iterator that points to the end");
+#endif // _DEBUG
+        ++_Myptr;
+        return *this;
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR string_view_iterator<_Elem> string_view_iterator<_Elem>::operator++(int) noexcept {
+        const string_view_iterator _Temp = *this;
+        ++*this;
+        return _Temp;
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR string_view_iterator<_Elem>& string_view_iterator<_Elem>::operator--() noexcept {
+#ifdef _DEBUG
+        _INTERNAL_ASSERT(_Myptr != nullptr, "attempt to use invalid iterator");
+        _INTERNAL_ASSERT(_Myptr - _Mybegin > 0, "attempt to retreat iterator that points to the beginning");
+#endif // _DEBUG
+        --_Myptr;
+        return *this;
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR string_view_iterator<_Elem> string_view_iterator<_Elem>::operator--(int) noexcept {
+        const string_view_iterator _Temp = *this;
+        --*this;
+        return _Temp;
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR string_view_iterator<_Elem>&
+        string_view_iterator<_Elem>::operator+=(const difference_type _Off) noexcept {
+#ifdef _DEBUG
+        _INTERNAL_ASSERT(_Myptr != nullptr, "attempt to use invalid iterator");
+        _INTERNAL_ASSERT(_Myend - _Myptr >= _Off, "attempt to advance iterator beyond the end");
+#endif // _DEBUG
+        _Myptr += _Off;
+        return *this;
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR string_view_iterator<_Elem>&
+        string_view_iterator<_Elem>::operator-=(const difference_type _Off) noexcept {
+#ifdef _DEBUG
+        _INTERNAL_ASSERT(_Myptr != nullptr, "attempt to use invalid iterator");
+        _INTERNAL_ASSERT(_Myptr - _Mybegin >= _Off, "attempt to retreat iterator beyond the beginning");
+#endif // _DEBUG
+        _Myptr -= _Off;
+        return *this;
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR string_view_iterator<_Elem>
+        string_view_iterator<_Elem>::operator+(const difference_type _Off) const noexcept {
+        string_view_iterator _Temp = *this;
+        _Temp                     += _Off;
+        return _Temp;
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR string_view_iterator<_Elem>
+        string_view_iterator<_Elem>::operator-(const difference_type _Off) const noexcept {
+        string_view_iterator _Temp = *this;
+        _Temp                     -= _Off;
+        return _Temp;
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR bool string_view_iterator<_Elem>::operator==(const string_view_iterator& _Other) const noexcept {
+        return _Myptr == _Other._Myptr;
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR ::std::strong_ordering
+        string_view_iterator<_Elem>::operator<=>(const string_view_iterator& _Other) const noexcept {
+        return _Myptr <=> _Other._Myptr;
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR string_view<_Elem>::string_view() noexcept : _Mydata(nullptr), _Mysize(0) {}
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR string_view<_Elem>::string_view(const_pointer _Ptr, const size_type _Count) noexcept
+        : _Mydata(_Ptr), _Mysize(_Count) {}
+
+    template <class _Elem>
+    _MJSTR_INLINE string_view<_Elem>::string_view(const_pointer _Ptr) noexcept
+        : _Mydata(_Ptr), _Mysize(traits_type::length(_Ptr)) {}
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR typename string_view<_Elem>::const_reference
+        string_view<_Elem>::operator[](const size_type _Idx) const noexcept {
+        // no bounds checking is performed, the behavior is undefined if _Idx >= size()
+        return _Mydata[_Idx];
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR typename string_view<_Elem>::const_iterator string_view<_Elem>::begin() const noexcept {
+#ifdef _DEBUG
+        return const_iterator{_Mydata, _Mydata + _Mysize};
+#else // ^^^ _DEBUG ^^^ / vvv NDEBUG vvv
+        return const_iterator{_Mydata};
+#endif // _DEBUG
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR typename string_view<_Elem>::const_iterator string_view<_Elem>::end() const noexcept {
+#ifdef _DEBUG
+        return const_iterator{_Mydata + _Mysize, _Mydata + _Mysize};
+#else // ^^^ _DEBUG ^^^ / vvv NDEBUG vvv
+        return const_iterator{_Mydata + _Mysize};
+#endif // _DEBUG
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR typename string_view<_Elem>::const_reference string_view<_Elem>::front() const noexcept {
+#ifdef _DEBUG
+        _INTERNAL_ASSERT(_Mysize > 0, "attempt to access non-existent element");
+#endif // _DEBUG
+        return _Mydata[0];
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR typename string_view<_Elem>::const_reference string_view<_Elem>::back() const noexcept {
+#ifdef _DEBUG
+        _INTERNAL_ASSERT(_Mysize > 0, "attempt to access non-existent element");
+#endif // _DEBUG
+        return _Mydata[_Mysize - 1];
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR typename string_view<_Elem>::const_pointer string_view<_Elem>::data() const noexcept {
+        return _Mydata;
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR typename string_view<_Elem>::size_type string_view<_Elem>::size() const noexcept {
+        return _Mysize;
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR bool string_view<_Elem>::empty() const noexcept {
+        return _Mysize == 0;
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR void string_view<_Elem>::remove_prefix(const size_type _Count) noexcept {
+#ifdef _DEBUG
+        _INTERNAL_ASSERT(_Count <= _Mysize, "attempt to remove prefix longer than total string size");
+#endif // _DEBUG
+        _Mydata += _Count;
+        _Mysize -= _Count;
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR void string_view<_Elem>::remove_suffix(const size_type _Count) noexcept {
+#ifdef _DEBUG
+        _INTERNAL_ASSERT(_Count <= _Mysize, "attempt to remove suffix longer than total string size");
+#endif // _DEBUG
+        _Mysize -= _Count;
+    }
+
+    template <class _Elem>
+    _MJSTR_CONSTEXPR void string_view<_Elem>::swap(string_view& _Other) noexcept {
+        const string_view _Temp = *this;
+        *this                   = _Other;
+        _Other                  = _Temp;
+    }
+} // namespace mjx
+
+#endif // _MJSTR_IMPL_STRING_VIEW_INLINE_HPP_
\ No newline at end of file
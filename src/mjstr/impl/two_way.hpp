@@ -0,0 +1,177 @@
+// two_way.hpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#ifndef _MJSTR_IMPL_TWO_WAY_HPP_
+#define _MJSTR_IMPL_TWO_WAY_HPP_
+#include <cstddef>
+
+namespace mjx {
+    namespace mjstr_impl {
+        // Note: The Two-Way algorithm (Crochemore-Perrin) splits the needle at its critical factorization
+        //       and matches the right part first, then the left part. It runs in O(n + m) time and O(1)
+        //       space for any input, so it's used whenever the SIMD search would become quadratic.
+        //       The shift table (Horspool's bad character rule) lets it skip windows whose last character
+        //       doesn't occur in the needle. Characters wider than a byte share a slot with all characters
+        //       that have the same low byte, which only makes the shifts shorter, never incorrect.
+
+        struct _Two_way_table { // precomputed needle data for the Two-Way algorithm
+            size_t _Suffix; // the position of the critical factorization
+            size_t _Period; // the period of the needle (or the shift after a match if the needle is not periodic)
+            bool _Periodic; // true if the left part of the needle is repeated in the right part
+            size_t _Shift[256]; // the distance from the last occurrence of each character to the end
+        };
+
+        template <class _Elem, bool _Reversed>
+        struct _Sequence { // accesses a character sequence, optionally in reverse order
+            const _Elem* _Ptr;
+            size_t _Size;
+
+            _Elem operator[](const size_t _Idx) const noexcept {
+                if constexpr (_Reversed) {
+                    return _Ptr[_Size - 1 - _Idx];
+                } else {
+                    return _Ptr[_Idx];
+                }
+            }
+        };
+
+        template <class _Elem>
+        constexpr unsigned char _Shift_slot(const _Elem _Ch) noexcept {
+            return static_cast<unsigned char>(_Ch);
+        }
+
+        template <class _Elem, bool _Reversed>
+        inline size_t _Maximal_suffix(
+            const _Sequence<_Elem, _Reversed> _Needle, size_t& _Period, const bool _Inverted) noexcept {
+            // computes the maximal suffix of the needle according to either the natural or the inverted order
+            size_t _Max_suffix = static_cast<size_t>(-1); // wraps to zero when incremented
+            size_t _Idx        = 0;
+            size_t _Off        = 1;
+            _Period            = 1;
+            while (_Idx + _Off < _Needle._Size) {
+                const _Elem _Left  = _Needle[_Idx + _Off];
+                const _Elem _Right = _Needle[_Max_suffix + _Off];
+                if (_Inverted ? _Right < _Left : _Left < _Right) { // the suffix is still maximal
+                    _Idx   += _Off;
+                    _Off    = 1;
+                    _Period = _Idx - _Max_suffix;
+                } else if (_Left == _Right) { // advance through the repetition
+                    if (_Off != _Period) {
+                        ++_Off;
+                    } else {
+                        _Idx += _Period;
+                        _Off  = 1;
+                    }
+                } else { // found a greater suffix
+                    _Max_suffix = _Idx++;
+                    _Off        = 1;
+                    _Period     = 1;
+                }
+            }
+
+            return _Max_suffix + 1;
+        }
+
+        template <class _Elem, bool _Reversed>
+        inline void _Build_two_way_table(
+            _Two_way_table& _Table, const _Sequence<_Elem, _Reversed> _Needle) noexcept {
+            // computes the critical factorization of the needle, the needle must not be empty
+            size_t _Period;
+            size_t _Inverted_period;
+            const size_t _Suffix          = _Maximal_suffix(_Needle, _Period, false);
+            const size_t _Inverted_suffix = _Maximal_suffix(_Needle, _Inverted_period, true);
+            if (_Inverted_suffix > _Suffix) { // the critical factorization is the greater of both suffixes
+                _Table._Suffix = _Inverted_suffix;
+                _Table._Period = _Inverted_period;
+            } else {
+                _Table._Suffix = _Suffix;
+                _Table._Period = _Period;
+            }
+
+            // the needle is periodic if its left part occurs again _Period characters later
+            _Table._Periodic = _Table._Period + _Table._Suffix <= _Needle._Size;
+            for (size_t _Idx = 0; _Table._Periodic && _Idx < _Table._Suffix; ++_Idx) {
+                if (_Needle[_Idx] != _Needle[_Idx + _Table._Period]) {
+                    _Table._Periodic = false;
+                }
+            }
+
+            if (!_Table._Periodic) { // the shift after a match is bounded by the greater part of the needle
+                const size_t _Right_size = _Needle._Size - _Table._Suffix;
+                _Table._Period           = (_Table._Suffix > _Right_size ? _Table._Suffix : _Right_size) + 1;
+            }
+
+            for (size_t& _Shift : _Table._Shift) {
+                _Shift = _Needle._Size;
+            }
+
+            for (size_t _Idx = 0; _Idx < _Needle._Size; ++_Idx) { // later occurrences overwrite earlier ones
+                _Table._Shift[_Shift_slot(_Needle[_Idx])] = _Needle._Size - _Idx - 1;
+            }
+        }
+
+        template <class _Elem, bool _Reversed>
+        inline size_t _Two_way_search(const _Two_way_table& _Table,
+            const _Sequence<_Elem, _Reversed> _Haystack, const _Sequence<_Elem, _Reversed> _Needle) noexcept {
+            // finds the first occurrence of the needle in the haystack, both must use the same order
+            const size_t _Needle_size = _Needle._Size;
+            if (_Needle_size > _Haystack._Size) {
+                return static_cast<size_t>(-1);
+            }
+
+            const size_t _Suffix   = _Table._Suffix;
+            const size_t _Period   = _Table._Period;
+            const size_t _Last_pos = _Haystack._Size - _Needle_size;
+            size_t _Memory         = 0; // the number of characters known to match (periodic needles only)
+            size_t _Pos            = 0;
+            size_t _Idx;
+            while (_Pos <= _Last_pos) {
+                size_t _Shift = _Table._Shift[_Shift_slot(_Haystack[_Pos + _Needle_size - 1])];
+                if (_Shift > 0) { // the last character of the window doesn't end the needle
+                    if (_Table._Periodic && _Memory > 0 && _Shift < _Period) {
+                        _Shift = _Needle_size - _Period;
+                    }
+
+                    _Memory = 0;
+                    _Pos   += _Shift;
+                    continue;
+                }
+
+                // match the right part of the needle
+                _Idx = _Suffix > _Memory ? _Suffix : _Memory;
+                while (_Idx < _Needle_size && _Needle[_Idx] == _Haystack[_Pos + _Idx]) {
+                    ++_Idx;
+                }
+
+                if (_Idx < _Needle_size) { // mismatch in the right part, skip the matched characters
+                    _Pos   += _Idx - _Suffix + 1;
+                    _Memory = 0;
+                    continue;
+                }
+
+                // match the left part of the needle, from right to left
+                const size_t _Left_end = _Table._Periodic ? _Memory : 0;
+                _Idx                   = _Suffix;
+                while (_Idx > _Left_end && _Needle[_Idx - 1] == _Haystack[_Pos + _Idx - 1]) {
+                    --_Idx;
+                }
+
+                if (_Idx <= _Left_end) { // the whole needle matches
+                    return _Pos;
+                }
+
+                _Pos += _Period;
+                if (_Table._Periodic) { // the shifted window already matches a prefix of the needle
+                    _Memory = _Needle_size - _Period;
+                }
+            }
+
+            return static_cast<size_t>(-1);
+        }
+    } // namespace mjstr_impl
+} // namespace mjx
+
+#endif // _MJSTR_IMPL_TWO_WAY_HPP_
\ No newline at end of file
@@ -0,0 +1,272 @@
+// utf8.hpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#ifndef _MJSTR_IMPL_UTF8_HPP_
+#define _MJSTR_IMPL_UTF8_HPP_
+#include <cstddef>
+#include <cstdint>
+#include <immintrin.h>
+#include <mjstr/conversion.hpp>
+#include <mjstr/impl/cpu.hpp>
+#include <type_traits>
+
+namespace mjx {
+    namespace mjstr_impl {
+        constexpr bool _Is_continuation_byte(const uint8_t _Byte) noexcept {
+            return (_Byte & 0xC0) == 0x80; // 10XXXXXX pattern
+        }
+
+        template <class _Elem>
+        constexpr size_t _Find_sequence_start(const _Elem* const _Bytes, size_t _Pos) noexcept {
+            // moves _Pos back to the leading byte of the sequence, skips at most three continuation bytes
+            for (size_t _Count = 0; _Count < 3 && _Pos > 0; ++_Count, --_Pos) {
+                if (!_Is_continuation_byte(static_cast<uint8_t>(_Bytes[_Pos]))) {
+                    break;
+                }
+            }
+
+            return _Pos;
+        }
+
+        template <class _Elem>
+        constexpr utf8_validation_result _Validate_utf8_scalar(
+            const _Elem* const _Bytes, const size_t _Size, size_t _Pos, const size_t _Limit) noexcept {
+            // validates the sequences that start within [_Pos, _Limit), _Pos must be a character boundary,
+            // on success returns the end of the last sequence (the well-formed sequences are listed
+            // in the Unicode Standard, table 3-7)
+            while (_Pos < _Limit) {
+                const uint8_t _Lead = static_cast<uint8_t>(_Bytes[_Pos]);
+                if (_Lead <= 0x7F) { // 0XXXXXXX pattern, single byte
+                    ++_Pos;
+                    continue;
+                }
+
+                // the second byte has a narrower range after some leading bytes
+                size_t _Length;
+                uint8_t _Min_second     = 0x80;
+                uint8_t _Max_second     = 0xBF;
+                utf8_error _Range_error = utf8_error::none;
+                if (_Lead <= 0xBF) { // 10XXXXXX pattern, continuation byte
+                    return {_Pos, utf8_error::unexpected_continuation};
+                } else if (_Lead <= 0xC1) { // would encode U+0000...U+007F
+                    return {_Pos, utf8_error::overlong_encoding};
+                } else if (_Lead <= 0xDF) { // 110XXXXX pattern, two bytes
+                    _Length = 2;
+                } else if (_Lead <= 0xEF) { // 1110XXXX pattern, three bytes
+                    _Length = 3;
+                    if (_Lead == 0xE0) { // U+0000...U+07FF would be overlong
+                        _Min_second  = 0xA0;
+                        _Range_error = utf8_error::overlong_encoding;
+                    } else if (_Lead == 0xED) { // U+D800...U+DFFF are surrogates
+                        _Max_second  = 0x9F;
+                        _Range_error = utf8_error::surrogate;
+                    }
+                } else if (_Lead <= 0xF4) { // 11110XXX pattern, four bytes
+                    _Length = 4;
+                    if (_Lead == 0xF0) { // U+0000...U+FFFF would be overlong
+                        _Min_second  = 0x90;
+                        _Range_error = utf8_error::overlong_encoding;
+                    } else if (_Lead == 0xF4) { // U+110000 and above are not valid code points
+                        _Max_second  = 0x8F;
+                        _Range_error = utf8_error::code_point_too_big;
+                    }
+                } else if (_Lead <= 0xF7) { // would encode U+140000...U+1FFFFF
+                    return {_Pos, utf8_error::code_point_too_big};
+                } else { // 11111XXX pattern, never used
+                    return {_Pos, utf8_error::invalid_leading_byte};
+                }
+
+                for (size_t _Idx = 1; _Idx < _Length; ++_Idx) {
+                    if (_Pos + _Idx == _Size) { // the input ends in the middle of the sequence
+                        return {_Pos, utf8_error::incomplete_sequence};
+                    }
+
+                    const uint8_t _Byte = static_cast<uint8_t>(_Bytes[_Pos + _Idx]);
+                    if (!_Is_continuation_byte(_Byte)) {
+                        return {_Pos, utf8_error::missing_continuation};
+                    }
+
+                    if (_Idx == 1 && (_Byte < _Min_second || _Byte > _Max_second)) {
+                        return {_Pos, _Range_error};
+                    }
+                }
+
+                _Pos += _Length;
+            }
+
+            return {_Pos, utf8_error::none};
+        }
+
+        template <class _Elem>
+        _MJSTR_TARGET_SSE2 utf8_validation_result _Validate_utf8_sse2(
+            const _Elem* const _Bytes, const size_t _Size) noexcept {
+            // skips ASCII blocks, everything else is validated with the scalar validator
+            size_t _Pos = 0;
+            while (_Pos + 16 <= _Size) {
+                const __m128i _Block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Bytes + _Pos));
+                if (_mm_movemask_epi8(_Block) == 0) { // ASCII block, always valid
+                    _Pos += 16;
+                    continue;
+                }
+
+                const utf8_validation_result _Result = _Validate_utf8_scalar(_Bytes, _Size, _Pos, _Pos + 16);
+                if (_Result.error != utf8_error::none) {
+                    return _Result;
+                }
+
+                _Pos = _Result.offset; // the last sequence may end in the next block
+            }
+
+            return _Validate_utf8_scalar(_Bytes, _Size, _Pos, _Size);
+        }
+
+        // Note: The AVX2 validator implements the lookup algorithm by Keiser and Lemire ("Validating UTF-8
+        //       In Less Than One Instruction Per Byte"). Each byte is classified together with the previous
+        //       one using three 16-entry tables (the high nibble of the previous byte, its low nibble
+        //       and the high nibble of the current byte). A bit remains set after combining the tables only
+        //       if the pair forms an invalid sequence. The expected continuation bytes of three- and four-byte
+        //       sequences are checked separately. The validator only detects that a block contains an error,
+        //       the exact offset and kind are found by the scalar validator.
+
+        inline constexpr uint8_t _Utf8_too_short      = 1 << 0; // 11XXXXXX 0XXXXXXX or 11XXXXXX 11XXXXXX
+        inline constexpr uint8_t _Utf8_too_long       = 1 << 1; // 0XXXXXXX 10XXXXXX
+        inline constexpr uint8_t _Utf8_overlong_3     = 1 << 2; // 11100000 100XXXXX
+        inline constexpr uint8_t _Utf8_too_large      = 1 << 3; // 11110100 1001XXXX or 11110100 101XXXXX
+        inline constexpr uint8_t _Utf8_surrogate      = 1 << 4; // 11101101 101XXXXX
+        inline constexpr uint8_t _Utf8_overlong_2     = 1 << 5; // 1100000X 10XXXXXX
+        inline constexpr uint8_t _Utf8_too_large_1000 = 1 << 6; // 11110101 1000XXXX or 1111011X 1000XXXX
+        inline constexpr uint8_t _Utf8_overlong_4     = 1 << 6; // 11110000 1000XXXX
+        inline constexpr uint8_t _Utf8_two_conts      = 1 << 7; // 10XXXXXX 10XXXXXX
+        inline constexpr uint8_t _Utf8_carry          = _Utf8_too_short | _Utf8_too_long | _Utf8_two_conts;
+
+        inline constexpr uint8_t _Utf8_first_high_table[16] = { // the high nibble of the previous byte
+            _Utf8_too_long, _Utf8_too_long, _Utf8_too_long, _Utf8_too_long, // 0XXX (ASCII)
+            _Utf8_too_long, _Utf8_too_long, _Utf8_too_long, _Utf8_too_long,
+            _Utf8_two_conts, _Utf8_two_conts, _Utf8_two_conts, _Utf8_two_conts, // 10XX (continuation)
+            _Utf8_too_short | _Utf8_overlong_2, // 1100 (two-byte leading byte)
+            _Utf8_too_short, // 1101 (two-byte leading byte)
+            _Utf8_too_short | _Utf8_overlong_3 | _Utf8_surrogate, // 1110 (three-byte leading byte)
+            _Utf8_too_short | _Utf8_too_large | _Utf8_too_large_1000 | _Utf8_overlong_4 // 1111 (four-byte)
+        };
+
+        inline constexpr uint8_t _Utf8_first_low_table[16] = { // the low nibble of the previous byte
+            _Utf8_carry | _Utf8_overlong_3 | _Utf8_overlong_2 | _Utf8_overlong_4, // 0000
+            _Utf8_carry | _Utf8_overlong_2, // 0001
+            _Utf8_carry, // 0010
+            _Utf8_carry, // 0011
+            _Utf8_carry | _Utf8_too_large, // 0100
+            _Utf8_carry | _Utf8_too_large | _Utf8_too_large_1000, // 0101
+            _Utf8_carry | _Utf8_too_large | _Utf8_too_large_1000, // 0110
+            _Utf8_carry | _Utf8_too_large | _Utf8_too_large_1000, // 0111
+            _Utf8_carry | _Utf8_too_large | _Utf8_too_large_1000, // 1000
+            _Utf8_carry | _Utf8_too_large | _Utf8_too_large_1000, // 1001
+            _Utf8_carry | _Utf8_too_large | _Utf8_too_large_1000, // 1010
+            _Utf8_carry | _Utf8_too_large | _Utf8_too_large_1000, // 1011
+            _Utf8_carry | _Utf8_too_large | _Utf8_too_large_1000, // 1100
+            _Utf8_carry | _Utf8_too_large | _Utf8_too_large_1000 | _Utf8_surrogate, // 1101
+            _Utf8_carry | _Utf8_too_large | _Utf8_too_large_1000, // 1110
+            _Utf8_carry | _Utf8_too_large | _Utf8_too_large_1000 // 1111
+        };
+
+        inline constexpr uint8_t _Utf8_second_high_table[16] = { // the high nibble of the current byte
+            _Utf8_too_short, _Utf8_too_short, _Utf8_too_short, _Utf8_too_short, // 0XXX (ASCII)
+            _Utf8_too_short, _Utf8_too_short, _Utf8_too_short, _Utf8_too_short,
+            _Utf8_too_long | _Utf8_overlong_2 | _Utf8_two_conts | _Utf8_overlong_3 | _Utf8_too_large_1000
+                | _Utf8_overlong_4, // 1000
+            _Utf8_too_long | _Utf8_overlong_2 | _Utf8_two_conts | _Utf8_overlong_3 | _Utf8_too_large, // 1001
+            _Utf8_too_long | _Utf8_overlong_2 | _Utf8_two_conts | _Utf8_surrogate | _Utf8_too_large, // 1010
+            _Utf8_too_long | _Utf8_overlong_2 | _Utf8_two_conts | _Utf8_surrogate | _Utf8_too_large, // 1011
+            _Utf8_too_short, _Utf8_too_short, _Utf8_too_short, _Utf8_too_short // 11XX (leading byte)
+        };
+
+        _MJSTR_TARGET_AVX2 inline __m256i _Load_utf8_table_avx2(const uint8_t (&_Table)[16]) noexcept {
+            // repeats the table in both 128-bit lanes, as required by _mm256_shuffle_epi8()
+            return _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(_Table)));
+        }
+
+        _MJSTR_TARGET_AVX2 inline __m256i _High_nibbles_avx2(const __m256i _Bytes) noexcept {
+            return _mm256_and_si256(_mm256_srli_epi16(_Bytes, 4), _mm256_set1_epi8(0x0F));
+        }
+
+        template <class _Elem>
+        _MJSTR_TARGET_AVX2 size_t _Validate_utf8_avx2(const _Elem* const _Bytes, const size_t _Size) noexcept {
+            // returns the start of the first block that contains an error, or the end of the last complete block
+            const __m256i _First_high  = _Load_utf8_table_avx2(_Utf8_first_high_table);
+            const __m256i _First_low   = _Load_utf8_table_avx2(_Utf8_first_low_table);
+            const __m256i _Second_high = _Load_utf8_table_avx2(_Utf8_second_high_table);
+            const __m256i _Low_nibble  = _mm256_set1_epi8(0x0F);
+            const __m256i _Third_lead  = _mm256_set1_epi8(static_cast<char>(0xE0 - 0x80));
+            const __m256i _Fourth_lead = _mm256_set1_epi8(static_cast<char>(0xF0 - 0x80));
+            const __m256i _High_bit    = _mm256_set1_epi8(static_cast<char>(0x80));
+            const __m256i _Incomplete  = _mm256_setr_epi8( // the largest bytes that can end a block
+                -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, static_cast<char>(0xF0 - 1),
+                static_cast<char>(0xE0 - 1), static_cast<char>(0xC0 - 1));
+            __m256i _Prev_block      = _mm256_setzero_si256();
+            __m256i _Prev_incomplete = _mm256_setzero_si256();
+            size_t _Pos              = 0;
+            for (; _Pos + 32 <= _Size; _Pos += 32) {
+                const __m256i _Block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Bytes + _Pos));
+                __m256i _Error;
+                if (_mm256_movemask_epi8(_Block) == 0) { // ASCII block, only the previous block can be incomplete
+                    _Error = _Prev_incomplete;
+                } else {
+                    // shift the previous bytes in, _Shifted holds the high lane of the previous block
+                    // and the low lane of the current one
+                    const __m256i _Shifted = _mm256_permute2x128_si256(_Prev_block, _Block, 0x21);
+                    const __m256i _Prev1   = _mm256_alignr_epi8(_Block, _Shifted, 15);
+                    const __m256i _Prev2   = _mm256_alignr_epi8(_Block, _Shifted, 14);
+                    const __m256i _Prev3   = _mm256_alignr_epi8(_Block, _Shifted, 13);
+                    const __m256i _Special = _mm256_and_si256(
+                        _mm256_and_si256(_mm256_shuffle_epi8(_First_high, _High_nibbles_avx2(_Prev1)),
+                            _mm256_shuffle_epi8(_First_low, _mm256_and_si256(_Prev1, _Low_nibble))),
+                        _mm256_shuffle_epi8(_Second_high, _High_nibbles_avx2(_Block)));
+
+                    // the second and third byte after a three- or four-byte leading byte must be continuations
+                    const __m256i _Must_continue = _mm256_and_si256(
+                        _mm256_or_si256(
+                            _mm256_subs_epu8(_Prev2, _Third_lead), _mm256_subs_epu8(_Prev3, _Fourth_lead)),
+                        _High_bit);
+                    _Error           = _mm256_xor_si256(_Must_continue, _Special);
+                    _Prev_incomplete = _mm256_subs_epu8(_Block, _Incomplete);
+                }
+
+                if (!_mm256_testz_si256(_Error, _Error)) {
+                    break;
+                }
+
+                _Prev_block = _Block;
+            }
+
+            return _Pos;
+        }
+
+        template <class _Elem>
+        constexpr utf8_validation_result _Validate_utf8(const _Elem* const _Bytes, const size_t _Size) noexcept {
+            // finds the first invalid sequence in _Bytes
+            if (!::std::is_constant_evaluated()) {
+                switch (_Get_isa_level()) {
+                case _Isa_level::_Avx2:
+                    {
+                        // the bytes before _Pos form valid sequences, except for the last one that may be
+                        // incomplete, the scalar validator finds the exact error or validates the remaining bytes
+                        const size_t _Pos = _Validate_utf8_avx2(_Bytes, _Size);
+                        return _Validate_utf8_scalar(
+                            _Bytes, _Size, _Find_sequence_start(_Bytes, _Pos >= 3 ? _Pos - 3 : 0), _Size);
+                    }
+                case _Isa_level::_Sse2:
+                    return _Validate_utf8_sse2(_Bytes, _Size);
+                default:
+                    break;
+                }
+            }
+
+            return _Validate_utf8_scalar(_Bytes, _Size, 0, _Size);
+        }
+    } // namespace mjstr_impl
+} // namespace mjx
+
+#endif // _MJSTR_IMPL_UTF8_HPP_
\ No newline at end of file
@@ -0,0 +1,24 @@
+// inline.hpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#ifndef _MJSTR_INLINE_HPP_
+#define _MJSTR_INLINE_HPP_
+
+// Note: This header must be included before any other MJSTR header, otherwise the trivial members
+//       will already be declared as non-constexpr and the remaining headers won't define them.
+//       Prefer building the whole project with MJSTR_INLINE_ACCESSORS=ON, which defines
+//       _MJSTR_INLINE_ACCESSORS for the library and all its consumers.
+#ifndef _MJSTR_INLINE_ACCESSORS
+#if defined(_MJSTR_API_HPP_)
+#error <mjstr/inline.hpp> must be included before any other MJSTR header.
+#endif // defined(_MJSTR_API_HPP_)
+#define _MJSTR_INLINE_ACCESSORS 1
+#endif // _MJSTR_INLINE_ACCESSORS
+
+#include <mjstr/char_traits.hpp>
+#include <mjstr/string.hpp>
+#include <mjstr/string_view.hpp>
+#endif // _MJSTR_INLINE_HPP_
\ No newline at end of file
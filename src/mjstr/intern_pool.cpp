@@ -0,0 +1,235 @@
+// intern_pool.cpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <atomic>
+#include <cstdint>
+#include <mjmem/exception.hpp>
+#include <mjstr/impl/hash.hpp>
+#include <mjstr/intern_pool.hpp>
+#include <mutex>
+#include <new>
+
+namespace mjx {
+    namespace mjstr_impl {
+        struct _Intern_entry { // stored in the shard's arena, followed by the characters
+            uint64_t _Hash;
+            size_t _Size;
+        };
+
+        struct _Intern_table { // open addressing table, followed by the slots
+            _Intern_table* _Prev; // the replaced table, kept alive for concurrent lookups
+            size_t _Mask; // the number of slots minus one
+
+            ::std::atomic<const _Intern_entry*>* _Slots() noexcept {
+                return reinterpret_cast<::std::atomic<const _Intern_entry*>*>(this + 1);
+            }
+        };
+
+        inline constexpr size_t _Intern_min_slots  = 64;
+        inline constexpr size_t _Intern_block_size = 16 << 10; // the size of the arena blocks
+        inline constexpr int _Intern_shard_shift   = 60; // the top 4 bits of the hash select the shard
+
+        inline size_t _Intern_table_bytes(const size_t _Slots) noexcept {
+            return sizeof(_Intern_table) + _Slots * sizeof(::std::atomic<const _Intern_entry*>);
+        }
+
+        template <class _Elem>
+        const _Elem* _Intern_chars(const _Intern_entry* const _Entry) noexcept {
+            return reinterpret_cast<const _Elem*>(_Entry + 1);
+        }
+
+        template <class _Elem>
+        const _Intern_entry* _Find_intern_entry(_Intern_table* const _Table, const uint64_t _Hash,
+            const _Elem* const _Ptr, const size_t _Size) noexcept {
+            // Note: May run concurrently with an insertion. The slots are published with release semantics,
+            //       so a loaded entry is always complete. A miss is confirmed by the caller under the lock.
+            if (!_Table) { // nothing stored yet
+                return nullptr;
+            }
+
+            ::std::atomic<const _Intern_entry*>* const _Slots = _Table->_Slots();
+            for (size_t _Idx = _Hash & _Table->_Mask;; _Idx = (_Idx + 1) & _Table->_Mask) {
+                const _Intern_entry* const _Entry = _Slots[_Idx].load(::std::memory_order_acquire);
+                if (!_Entry) { // reached an empty slot, the value is not in the table
+                    return nullptr;
+                }
+
+                if (_Entry->_Hash == _Hash && _Entry->_Size == _Size
+                    && char_traits<_Elem>::compare(_Intern_chars<_Elem>(_Entry), _Ptr, _Size) == 0) {
+                    return _Entry;
+                }
+            }
+        }
+
+        inline void _Insert_intern_entry(_Intern_table* const _Table, const _Intern_entry* const _Entry) noexcept {
+            // the table always has an empty slot, the load factor is limited to 3/4
+            ::std::atomic<const _Intern_entry*>* const _Slots = _Table->_Slots();
+            size_t _Idx                                       = _Entry->_Hash & _Table->_Mask;
+            while (_Slots[_Idx].load(::std::memory_order_relaxed)) {
+                _Idx = (_Idx + 1) & _Table->_Mask;
+            }
+
+            _Slots[_Idx].store(_Entry, ::std::memory_order_release);
+        }
+    } // namespace mjstr_impl
+
+    template <class _Elem>
+    struct alignas(64) intern_pool<_Elem>::_Shard { // aligned to avoid false sharing between shards
+        explicit _Shard(memory_resource* const _Resource) noexcept
+            : _Mytable(nullptr), _Mycount(0), _Mymutex(), _Myarena(mjstr_impl::_Intern_block_size, _Resource) {}
+
+        ::std::atomic<mjstr_impl::_Intern_table*> _Mytable;
+        ::std::atomic<size_t> _Mycount;
+        ::std::mutex _Mymutex; // held only while inserting
+        arena_resource _Myarena; // stores the entries
+    };
+
+    static_assert(intern_pool<char>::shard_count == size_t{1} << (64 - mjstr_impl::_Intern_shard_shift),
+        "the shard selection must match the number of shards");
+
+    template <class _Elem>
+    intern_pool<_Elem>::intern_pool() : intern_pool(nullptr) {}
+
+    template <class _Elem>
+    intern_pool<_Elem>::intern_pool(memory_resource* const _Resource)
+        : _Myresource(_Resource ? _Resource : global_memory_resource()), _Mystorage(nullptr), _Myshards(nullptr) {
+        // the resource guarantees a smaller alignment than required by the shards, align them manually
+        constexpr size_t _Mask = alignof(_Shard) - 1;
+        _Mystorage             = _Myresource->allocate(shard_count * sizeof(_Shard) + _Mask); // may throw
+        _Myshards = reinterpret_cast<_Shard*>((reinterpret_cast<uintptr_t>(_Mystorage) + _Mask) & ~uintptr_t{_Mask});
+        for (size_type _Idx = 0; _Idx < shard_count; ++_Idx) {
+            ::new (static_cast<void*>(_Myshards + _Idx)) _Shard(_Myresource);
+        }
+    }
+
+    template <class _Elem>
+    intern_pool<_Elem>::~intern_pool() noexcept {
+        for (size_type _Idx = 0; _Idx < shard_count; ++_Idx) {
+            _Shard& _Target                   = _Myshards[_Idx];
+            mjstr_impl::_Intern_table* _Table = _Target._Mytable.load(::std::memory_order_relaxed);
+            while (_Table) {
+                mjstr_impl::_Intern_table* const _Prev = _Table->_Prev;
+                _Myresource->deallocate(_Table, mjstr_impl::_Intern_table_bytes(_Table->_Mask + 1));
+                _Table = _Prev;
+            }
+
+            _Target.~_Shard(); // releases the arena
+        }
+
+        _Myresource->deallocate(_Mystorage, shard_count * sizeof(_Shard) + alignof(_Shard) - 1);
+    }
+
+    template <class _Elem>
+    interned_string<_Elem> intern_pool<_Elem>::intern(const string_view<_Elem> _Str) {
+        const const_pointer _Ptr = _Str.data();
+        const size_type _Size    = _Str.size();
+        if (_Size == 0) { // the empty value is represented by a null handle
+            return interned_string<_Elem>{};
+        }
+
+        // Note: The top bits of the hash select the shard and the bottom bits select the slot,
+        //       so the values are spread evenly within every shard.
+        const uint64_t _Hash = mjstr_impl::_Hash_bytes_inline(_Ptr, _Size * sizeof(_Elem), 0);
+        _Shard& _Target      = _Myshards[_Hash >> mjstr_impl::_Intern_shard_shift];
+        const mjstr_impl::_Intern_entry* _Entry =
+            mjstr_impl::_Find_intern_entry(_Target._Mytable.load(::std::memory_order_acquire), _Hash, _Ptr, _Size);
+        if (_Entry) { // the common case, the value is already stored
+            return interned_string<_Elem>{mjstr_impl::_Intern_chars<_Elem>(_Entry), _Size};
+        }
+
+        ::std::lock_guard<::std::mutex> _Guard(_Target._Mymutex);
+        mjstr_impl::_Intern_table* _Table = _Target._Mytable.load(::std::memory_order_relaxed);
+        _Entry                            = mjstr_impl::_Find_intern_entry(_Table, _Hash, _Ptr, _Size);
+        if (_Entry) { // another thread stored the value in the meantime
+            return interned_string<_Elem>{mjstr_impl::_Intern_chars<_Elem>(_Entry), _Size};
+        }
+
+        constexpr size_type _Max_size = (SIZE_MAX - sizeof(mjstr_impl::_Intern_entry)) / sizeof(_Elem);
+        if (_Size > _Max_size) { // requested too much memory, break
+            allocation_limit_exceeded::raise();
+        }
+
+        mjstr_impl::_Intern_entry* const _New_entry = static_cast<mjstr_impl::_Intern_entry*>(
+            _Target._Myarena.allocate(sizeof(mjstr_impl::_Intern_entry) + _Size * sizeof(_Elem))); // may throw
+        _New_entry->_Hash = _Hash;
+        _New_entry->_Size = _Size;
+        traits_type::copy(const_cast<_Elem*>(mjstr_impl::_Intern_chars<_Elem>(_New_entry)), _Ptr, _Size);
+
+        const size_type _Count = _Target._Mycount.load(::std::memory_order_relaxed);
+        if (!_Table || (_Count + 1) * 4 > (_Table->_Mask + 1) * 3) { // grow the table
+            // Note: Lookups may still use the current table, so it's kept until the pool is destroyed.
+            //       The tables grow geometrically, so the old ones take at most as much memory as the new one.
+            const size_type _Slots = _Table ? (_Table->_Mask + 1) * 2 : mjstr_impl::_Intern_min_slots;
+            mjstr_impl::_Intern_table* const _New_table = static_cast<mjstr_impl::_Intern_table*>(
+                _Myresource->allocate(mjstr_impl::_Intern_table_bytes(_Slots))); // may throw
+            _New_table->_Prev = _Table;
+            _New_table->_Mask = _Slots - 1;
+            ::std::atomic<const mjstr_impl::_Intern_entry*>* const _New_slots = _New_table->_Slots();
+            for (size_type _Idx = 0; _Idx < _Slots; ++_Idx) {
+                ::new (static_cast<void*>(_New_slots + _Idx)) ::std::atomic<const mjstr_impl::_Intern_entry*>(nullptr);
+            }
+
+            if (_Table) { // move the stored entries to the new table
+                ::std::atomic<const mjstr_impl::_Intern_entry*>* const _Old_slots = _Table->_Slots();
+                for (size_type _Idx = 0; _Idx <= _Table->_Mask; ++_Idx) {
+                    const mjstr_impl::_Intern_entry* const _Old_entry =
+                        _Old_slots[_Idx].load(::std::memory_order_relaxed);
+                    if (_Old_entry) {
+                        mjstr_impl::_Insert_intern_entry(_New_table, _Old_entry);
+                    }
+                }
+            }
+
+            _Table = _New_table;
+            mjstr_impl::_Insert_intern_entry(_Table, _New_entry);
+            _Target._Mytable.store(_Table, ::std::memory_order_release);
+        } else {
+            mjstr_impl::_Insert_intern_entry(_Table, _New_entry);
+        }
+
+        _Target._Mycount.store(_Count + 1, ::std::memory_order_relaxed);
+        return interned_string<_Elem>{mjstr_impl::_Intern_chars<_Elem>(_New_entry), _Size};
+    }
+
+    template <class _Elem>
+    interned_string<_Elem> intern_pool<_Elem>::find(const string_view<_Elem> _Str) const noexcept {
+        const const_pointer _Ptr = _Str.data();
+        const size_type _Size    = _Str.size();
+        if (_Size == 0) { // the empty value is represented by a null handle
+            return interned_string<_Elem>{};
+        }
+
+        const uint64_t _Hash                          = mjstr_impl::_Hash_bytes_inline(_Ptr, _Size * sizeof(_Elem), 0);
+        const _Shard& _Target                         = _Myshards[_Hash >> mjstr_impl::_Intern_shard_shift];
+        const mjstr_impl::_Intern_entry* const _Entry =
+            mjstr_impl::_Find_intern_entry(_Target._Mytable.load(::std::memory_order_acquire), _Hash, _Ptr, _Size);
+        return _Entry ? interned_string<_Elem>{mjstr_impl::_Intern_chars<_Elem>(_Entry), _Size}
+                      : interned_string<_Elem>{};
+    }
+
+    template <class _Elem>
+    bool intern_pool<_Elem>::empty() const noexcept {
+        return size() == 0;
+    }
+
+    template <class _Elem>
+    typename intern_pool<_Elem>::size_type intern_pool<_Elem>::size() const noexcept {
+        size_type _Count = 0;
+        for (size_type _Idx = 0; _Idx < shard_count; ++_Idx) {
+            _Count += _Myshards[_Idx]._Mycount.load(::std::memory_order_relaxed);
+        }
+
+        return _Count;
+    }
+
+    template <class _Elem>
+    memory_resource* intern_pool<_Elem>::get_memory_resource() const noexcept {
+        return _Myresource;
+    }
+
+    template class _MJSTR_API intern_pool<byte_t>;
+    template class _MJSTR_API intern_pool<char>;
+    template class _MJSTR_API intern_pool<wchar_t>;
+} // namespace mjx
\ No newline at end of file
@@ -0,0 +1,145 @@
+// intern_pool.hpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#ifndef _MJSTR_INTERN_POOL_HPP_
+#define _MJSTR_INTERN_POOL_HPP_
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mjstr/api.hpp>
+#include <mjstr/char_traits.hpp>
+#include <mjstr/memory_resource.hpp>
+#include <mjstr/string_view.hpp>
+
+namespace mjx {
+    template <class _Elem>
+    class intern_pool;
+
+    template <class _Elem>
+    class interned_string { // handle to a value stored in an intern_pool, compared by address
+    public:
+        static_assert(compatible_element<_Elem>, "invalid element type for interned_string<CharT>");
+
+        using value_type    = _Elem;
+        using size_type     = size_t;
+        using const_pointer = const _Elem*;
+
+        // Note: The empty value is never stored, it's represented by a null handle instead. Handles returned
+        //       by the same pool compare equal if and only if their values are equal, handles from different
+        //       pools must be compared by their views.
+        constexpr interned_string() noexcept : _Myptr(nullptr), _Mysize(0) {}
+
+        // returns a view into the interned characters, valid as long as the pool exists
+        _MJSTR_CONSTEXPR operator string_view<_Elem>() const noexcept {
+            return string_view<_Elem>{_Myptr, _Mysize};
+        }
+
+        // returns a view into the interned characters, valid as long as the pool exists
+        _MJSTR_CONSTEXPR string_view<_Elem> view() const noexcept {
+            return string_view<_Elem>{_Myptr, _Mysize};
+        }
+
+        // returns the interned characters (a null pointer if the value is empty)
+        constexpr const_pointer data() const noexcept {
+            return _Myptr;
+        }
+
+        // returns the number of characters
+        constexpr size_type size() const noexcept {
+            return _Mysize;
+        }
+
+        // checks whether the value is empty
+        constexpr bool empty() const noexcept {
+            return _Mysize == 0;
+        }
+
+        // compares two handles by address, a constant time operation
+        friend constexpr bool operator==(const interned_string _Left, const interned_string _Right) noexcept {
+            return _Left._Myptr == _Right._Myptr;
+        }
+
+        // orders two handles by address, the order is unrelated to the values
+        friend ::std::strong_ordering operator<=>(
+            const interned_string _Left, const interned_string _Right) noexcept {
+            return ::std::compare_three_way{}(_Left._Myptr, _Right._Myptr);
+        }
+
+    private:
+        friend intern_pool<_Elem>;
+
+        constexpr interned_string(const_pointer _Ptr, const size_type _Size) noexcept
+            : _Myptr(_Ptr), _Mysize(_Size) {}
+
+        const_pointer _Myptr;
+        size_type _Mysize;
+    };
+
+    template <class _Elem>
+    class _MJSTR_API intern_pool { // stores every distinct value once, safe to use from many threads
+    public:
+        static_assert(compatible_element<_Elem>, "invalid element type for intern_pool<CharT>");
+
+        using value_type    = _Elem;
+        using size_type     = size_t;
+        using const_pointer = const _Elem*;
+        using traits_type   = char_traits<_Elem>;
+
+        // the number of independently locked parts of the pool
+        static constexpr size_type shard_count = 16;
+
+        // Note: The pool is split into shards selected by the hash of the value. Lookups never lock,
+        //       only inserting a new value locks its shard. The values are stored in per-shard arenas
+        //       and never move, so the handles stay valid until the pool is destroyed.
+        //       The memory is taken from _Resource (the global allocator if nullptr).
+        intern_pool();
+        explicit intern_pool(memory_resource* const _Resource);
+        ~intern_pool() noexcept;
+
+        intern_pool(const intern_pool&)            = delete;
+        intern_pool& operator=(const intern_pool&) = delete;
+
+        // returns the handle to the stored value, stores the value first if it's not in the pool yet
+        interned_string<_Elem> intern(const string_view<_Elem> _Str);
+
+        // returns the handle to the stored value, or a null handle if the value is not in the pool
+        interned_string<_Elem> find(const string_view<_Elem> _Str) const noexcept;
+
+        // checks whether the pool is empty
+        bool empty() const noexcept;
+
+        // returns the number of distinct values stored in the pool
+        size_type size() const noexcept;
+
+        // returns the resource used to allocate the memory
+        memory_resource* get_memory_resource() const noexcept;
+
+    private:
+        struct _Shard;
+
+        memory_resource* _Myresource;
+        void* _Mystorage; // the memory that holds the shards
+        _Shard* _Myshards; // aligned to the cache line size
+    };
+
+    using byte_intern_pool    = intern_pool<byte_t>;
+    using utf8_intern_pool    = intern_pool<char>;
+    using unicode_intern_pool = intern_pool<wchar_t>;
+
+    using byte_interned_string    = interned_string<byte_t>;
+    using utf8_interned_string    = interned_string<char>;
+    using unicode_interned_string = interned_string<wchar_t>;
+} // namespace mjx
+
+template <class _Elem>
+struct std::hash<::mjx::interned_string<_Elem>> { // hashes the address, consistent with operator==
+    size_t operator()(const ::mjx::interned_string<_Elem> _Str) const noexcept {
+        return ::std::hash<const _Elem*>{}(_Str.data());
+    }
+};
+
+#endif // _MJSTR_INTERN_POOL_HPP_
\ No newline at end of file
@@ -0,0 +1,170 @@
+// join.hpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#ifndef _MJSTR_JOIN_HPP_
+#define _MJSTR_JOIN_HPP_
+#include <concepts>
+#include <cstddef>
+#include <mjmem/exception.hpp>
+#include <mjstr/char_traits.hpp>
+#include <mjstr/impl/char_traits.hpp>
+#include <mjstr/memory_resource.hpp>
+#include <mjstr/string.hpp>
+#include <mjstr/string_view.hpp>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+namespace mjx {
+    namespace mjstr_impl {
+        template <class _Range, class _Elem>
+        concept _Joinable_range = ::std::ranges::input_range<_Range>
+                               && ::std::convertible_to<::std::ranges::range_reference_t<_Range>, string_view<_Elem>>;
+
+        template <class _Elem, class _Range>
+        inline size_t _Joined_length(_Range& _Pieces, const size_t _Sep_size, size_t _Total) {
+            bool _First = true;
+            for (auto&& _Piece : _Pieces) {
+                const size_t _Size = string_view<_Elem>{_Piece}.size();
+                const size_t _Step = _First ? _Size : _Sep_size + _Size;
+                if (_Step < _Size || _Step > static_cast<size_t>(-1) - _Total) { // requested too much memory, break
+                    allocation_limit_exceeded::raise();
+                }
+
+                _Total += _Step;
+                _First  = false;
+            }
+
+            return _Total;
+        }
+
+        template <class _Elem, class _Range>
+        inline void _Write_joined(_Elem* _Next, _Range& _Pieces, const string_view<_Elem> _Sep) noexcept {
+            const _Elem* const _Sep_data = _Sep.data();
+            const size_t _Sep_size       = _Sep.size();
+            bool _First                  = true;
+            for (auto&& _Piece : _Pieces) {
+                const string_view<_Elem> _Str{_Piece};
+                if (!_First) {
+                    _Char_traits<_Elem>::_Copy(_Next, _Sep_data, _Sep_size);
+                    _Next += _Sep_size;
+                }
+
+                const size_t _Size = _Str.size();
+                _Char_traits<_Elem>::_Copy(_Next, _Str.data(), _Size);
+                _Next  += _Size;
+                _First  = false;
+            }
+        }
+
+        template <class _Elem, class _Range>
+        inline bool _Views_any(
+            _Range& _Pieces, const string_view<_Elem> _Sep, const _Elem* const _First, const size_t _Count) noexcept {
+            // checks whether the separator or any piece views the _Count characters starting at _First
+            if (_Overlaps(_Sep, _First, _Count)) {
+                return true;
+            }
+
+            for (auto&& _Piece : _Pieces) {
+                if (_Overlaps(string_view<_Elem>{_Piece}, _First, _Count)) {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        template <class _Elem, size_t _InlineBytes, class _Range>
+        inline void _Join_into(string<_Elem, _InlineBytes>& _Dest, _Range&& _Pieces, const string_view<_Elem> _Sep) {
+            if constexpr (::std::ranges::forward_range<_Range>) {
+                // Note: The first pass computes the exact length, so the string is reallocated at most once
+                //       and every piece is copied exactly once by the second pass.
+                const size_t _Old_size = _Dest.size();
+                const size_t _Total    = _Joined_length<_Elem>(_Pieces, _Sep.size(), _Old_size);
+                if (_Total > _Dest.capacity() && _Views_any(_Pieces, _Sep, _Dest.data(), _Old_size)) {
+                    // Note: The pieces would be read from the buffer freed by the reallocation,
+                    //       so the result is built in a new string instead.
+                    string<_Elem, _InlineBytes> _Result(_Dest.get_memory_resource(), _Total); // may throw
+                    _Result.resize_uninitialized(_Total);
+                    _Char_traits<_Elem>::_Copy(_Result.data(), _Dest.data(), _Old_size);
+                    _Write_joined(_Result.data() + _Old_size, _Pieces, _Sep);
+                    _Dest = ::std::move(_Result);
+                    return;
+                }
+
+                // an empty string gets the exact capacity, a non-empty one grows geometrically, so repeated
+                // joins into the same string don't reallocate every time
+                if (_Old_size == 0) {
+                    _Dest.reserve(_Total); // may throw
+                }
+
+                _Dest.resize_uninitialized(_Total); // may throw
+                _Write_joined(_Dest.data() + _Old_size, _Pieces, _Sep);
+            } else { // a single-pass range, the length is unknown up front
+                bool _First = true;
+                for (auto&& _Piece : _Pieces) {
+                    if (!_First) {
+                        _Dest.append(_Sep.data(), _Sep.size());
+                    }
+
+                    _Dest.append(string_view<_Elem>{_Piece});
+                    _First = false;
+                }
+            }
+        }
+
+        template <class _Str_t, class _Elem, class _Range>
+        inline _Str_t _Join(_Range&& _Pieces, const string_view<_Elem> _Sep, memory_resource* const _Resource) {
+            if constexpr (::std::ranges::forward_range<_Range>) {
+                const size_t _Total = _Joined_length<_Elem>(_Pieces, _Sep.size(), 0);
+                _Str_t _Result(_Resource, _Total); // the only allocation, may throw
+                _Result.resize_uninitialized(_Total);
+                _Write_joined(_Result.data(), _Pieces, _Sep);
+                return _Result;
+            } else {
+                _Str_t _Result(_Resource);
+                _Join_into(_Result, ::std::forward<_Range>(_Pieces), _Sep);
+                return _Result;
+            }
+        }
+    } // namespace mjstr_impl
+
+    // Note: The pieces may be any range of values convertible to a view, e.g. strings, views or pointers
+    //       to null-terminated strings. Forward ranges are traversed twice, once to compute the exact length
+    //       and once to copy the pieces, so the result is allocated once. Single-pass ranges are appended
+    //       piece by piece instead.
+
+    // appends the pieces separated by _Sep to _Dest, the current contents of _Dest are kept
+    template <class _Elem, size_t _InlineBytes, class _Range>
+        requires mjstr_impl::_Joinable_range<_Range, _Elem>
+    inline string<_Elem, _InlineBytes>& join_into(
+        string<_Elem, _InlineBytes>& _Dest, _Range&& _Pieces, const ::std::type_identity_t<string_view<_Elem>> _Sep) {
+        mjstr_impl::_Join_into(_Dest, ::std::forward<_Range>(_Pieces), _Sep);
+        return _Dest;
+    }
+
+    // returns the pieces separated by _Sep, the memory is taken from _Resource (the global allocator if nullptr)
+    template <class _Range>
+        requires mjstr_impl::_Joinable_range<_Range, byte_t>
+    inline byte_string join(_Range&& _Pieces, const byte_string_view _Sep, memory_resource* const _Resource = nullptr) {
+        return mjstr_impl::_Join<byte_string>(::std::forward<_Range>(_Pieces), _Sep, _Resource);
+    }
+
+    template <class _Range>
+        requires mjstr_impl::_Joinable_range<_Range, char>
+    inline utf8_string join(_Range&& _Pieces, const utf8_string_view _Sep, memory_resource* const _Resource = nullptr) {
+        return mjstr_impl::_Join<utf8_string>(::std::forward<_Range>(_Pieces), _Sep, _Resource);
+    }
+
+    template <class _Range>
+        requires mjstr_impl::_Joinable_range<_Range, wchar_t>
+    inline unicode_string join(
+        _Range&& _Pieces, const unicode_string_view _Sep, memory_resource* const _Resource = nullptr) {
+        return mjstr_impl::_Join<unicode_string>(::std::forward<_Range>(_Pieces), _Sep, _Resource);
+    }
+} // namespace mjx
+
+#endif // _MJSTR_JOIN_HPP_
\ No newline at end of file
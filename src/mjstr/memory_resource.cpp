@@ -0,0 +1,96 @@
+// memory_resource.cpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdint>
+#include <mjmem/exception.hpp>
+#include <mjmem/object_allocator.hpp>
+#include <mjstr/memory_resource.hpp>
+
+namespace mjx {
+    memory_resource::~memory_resource() noexcept {}
+
+    void* memory_resource::allocate(const size_t _Size) {
+        return do_allocate(_Size);
+    }
+
+    void memory_resource::deallocate(void* const _Ptr, const size_t _Size) noexcept {
+        do_deallocate(_Ptr, _Size);
+    }
+
+    class _Global_memory_resource : public memory_resource { // forwards to the global allocator
+    private:
+        void* do_allocate(const size_t _Size) override {
+            return ::mjx::allocate_object_array<byte_t>(_Size);
+        }
+
+        void do_deallocate(void* const _Ptr, const size_t _Size) noexcept override {
+            ::mjx::delete_object_array(static_cast<byte_t*>(_Ptr), _Size);
+        }
+    };
+
+    memory_resource* global_memory_resource() noexcept {
+        static _Global_memory_resource _Resource;
+        return &_Resource;
+    }
+
+    arena_resource::arena_resource(const size_t _Block_size, memory_resource* const _Upstream) noexcept
+        : _Myupstream(_Upstream ? _Upstream : global_memory_resource()), _Myblocks(nullptr),
+          _Mycur(nullptr), _Myend(nullptr), _Myblock_size(_Block_size) {}
+
+    arena_resource::~arena_resource() noexcept {
+        release();
+    }
+
+    void arena_resource::release() noexcept {
+        while (_Myblocks) {
+            _Block_header* const _Next = _Myblocks->_Next;
+            _Myupstream->deallocate(_Myblocks, _Myblocks->_Size);
+            _Myblocks = _Next;
+        }
+
+        _Mycur = nullptr;
+        _Myend = nullptr;
+    }
+
+    size_t arena_resource::reserved_bytes() const noexcept {
+        size_t _Bytes = 0;
+        for (const _Block_header* _Block = _Myblocks; _Block; _Block = _Block->_Next) {
+            _Bytes += _Block->_Size;
+        }
+
+        return _Bytes;
+    }
+
+    void* arena_resource::do_allocate(const size_t _Size) {
+        // every allocation starts at an aligned address, so the size is rounded up
+        constexpr size_t _Mask        = alignment - 1;
+        constexpr size_t _Header_size = (sizeof(_Block_header) + _Mask) & ~_Mask;
+        if (_Size > SIZE_MAX - _Header_size - _Mask) { // requested too much memory, break
+            allocation_limit_exceeded::raise();
+        }
+
+        const size_t _Aligned_size = (_Size + _Mask) & ~_Mask;
+        if (static_cast<size_t>(_Myend - _Mycur) < _Aligned_size) { // take a new block from the upstream resource
+            const size_t _Block_size = _Aligned_size + _Header_size > _Myblock_size
+                ? _Aligned_size + _Header_size : _Myblock_size;
+            _Block_header* const _Block =
+                static_cast<_Block_header*>(_Myupstream->allocate(_Block_size)); // may throw
+            _Block->_Next = _Myblocks;
+            _Block->_Size = _Block_size;
+            _Myblocks     = _Block;
+            _Mycur        = reinterpret_cast<byte_t*>(_Block) + _Header_size;
+            _Myend        = reinterpret_cast<byte_t*>(_Block) + _Block_size;
+        }
+
+        void* const _Ptr = _Mycur;
+        _Mycur          += _Aligned_size;
+        return _Ptr;
+    }
+
+    void arena_resource::do_deallocate(void* const _Ptr, const size_t _Size) noexcept {
+        (void) _Ptr;
+        (void) _Size;
+    }
+} // namespace mjx
\ No newline at end of file
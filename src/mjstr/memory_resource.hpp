@@ -0,0 +1,72 @@
+// memory_resource.hpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#ifndef _MJSTR_MEMORY_RESOURCE_HPP_
+#define _MJSTR_MEMORY_RESOURCE_HPP_
+#include <cstddef>
+#include <mjstr/api.hpp>
+#include <mjstr/char_traits.hpp>
+
+namespace mjx {
+    class _MJSTR_API memory_resource { // source of memory for strings
+    public:
+        // the alignment of every allocated block
+        static constexpr size_t alignment = 2 * sizeof(void*);
+
+        memory_resource() noexcept = default;
+        virtual ~memory_resource() noexcept;
+
+        memory_resource(const memory_resource&)            = delete;
+        memory_resource& operator=(const memory_resource&) = delete;
+
+        // allocates _Size bytes
+        void* allocate(const size_t _Size);
+
+        // deallocates memory previously allocated from this resource
+        void deallocate(void* const _Ptr, const size_t _Size) noexcept;
+
+    private:
+        virtual void* do_allocate(const size_t _Size)                             = 0;
+        virtual void do_deallocate(void* const _Ptr, const size_t _Size) noexcept = 0;
+    };
+
+    // returns the resource that uses the global allocator, used by default
+    _MJSTR_API memory_resource* global_memory_resource() noexcept;
+
+    class _MJSTR_API arena_resource : public memory_resource { // bump allocator, frees all memory at once
+    public:
+        static constexpr size_t default_block_size = 64 << 10;
+
+        // Note: The memory is taken from _Upstream in blocks of at least _Block_size bytes. Deallocation
+        //       does nothing, all blocks are returned to _Upstream by release() or the destructor.
+        explicit arena_resource(
+            const size_t _Block_size = default_block_size, memory_resource* const _Upstream = nullptr) noexcept;
+        ~arena_resource() noexcept override;
+
+        // returns all allocated memory to the upstream resource
+        void release() noexcept;
+
+        // returns the number of bytes taken from the upstream resource
+        size_t reserved_bytes() const noexcept;
+
+    private:
+        struct _Block_header { // stored at the beginning of every block
+            _Block_header* _Next;
+            size_t _Size; // including the header
+        };
+
+        void* do_allocate(const size_t _Size) override;
+        void do_deallocate(void* const _Ptr, const size_t _Size) noexcept override;
+
+        memory_resource* _Myupstream;
+        _Block_header* _Myblocks; // the most recently allocated block first
+        byte_t* _Mycur; // the first free byte in the current block
+        byte_t* _Myend; // the end of the current block
+        size_t _Myblock_size;
+    };
+} // namespace mjx
+
+#endif // _MJSTR_MEMORY_RESOURCE_HPP_
\ No newline at end of file
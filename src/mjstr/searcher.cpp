@@ -0,0 +1,67 @@
+// searcher.cpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <mjstr/impl/search.hpp>
+#include <mjstr/searcher.hpp>
+
+namespace mjx {
+    template <class _Elem>
+    searcher<_Elem>::searcher(const string_view<_Elem> _Needle) noexcept
+        : _Myneedle(_Needle), _Myforward(), _Mybackward() {
+        if (_Needle.size() >= mjstr_impl::_Two_way_threshold) { // shorter needles never use the tables
+            mjstr_impl::_Build_two_way_table(
+                _Myforward, mjstr_impl::_Sequence<_Elem, false>{_Needle.data(), _Needle.size()});
+            mjstr_impl::_Build_two_way_table(
+                _Mybackward, mjstr_impl::_Sequence<_Elem, true>{_Needle.data(), _Needle.size()});
+        }
+    }
+
+    template <class _Elem>
+    string_view<_Elem> searcher<_Elem>::needle() const noexcept {
+        return _Myneedle;
+    }
+
+    template <class _Elem>
+    typename searcher<_Elem>::size_type
+        searcher<_Elem>::find(const string_view<_Elem> _Haystack, const size_type _Off) const noexcept {
+        const size_type _Haystack_size = _Haystack.size();
+        const size_type _Needle_size   = _Myneedle.size();
+        if (_Off >= _Haystack_size || _Haystack_size - _Off < _Needle_size) {
+            return npos;
+        }
+
+        if (_Needle_size == 0) { // empty string is always considered as found
+            return _Off;
+        }
+
+        const size_type _Idx = mjstr_impl::_Search(
+            _Haystack.data() + _Off, _Haystack_size - _Off, _Myneedle.data(), _Needle_size, &_Myforward);
+        return _Idx != npos ? _Idx + _Off : npos;
+    }
+
+    template <class _Elem>
+    typename searcher<_Elem>::size_type
+        searcher<_Elem>::rfind(const string_view<_Elem> _Haystack, const size_type _Off) const noexcept {
+        const size_type _Haystack_size = _Haystack.size();
+        const size_type _Needle_size   = _Myneedle.size();
+        if (_Needle_size > _Haystack_size) {
+            return npos;
+        }
+
+        if (_Needle_size == 0) { // empty string is always considered as found
+            return (::std::min)(_Off, _Haystack_size - 1);
+        }
+
+        // search only the characters that can contain an occurrence starting at or before _Off
+        return mjstr_impl::_Reverse_search(_Haystack.data(),
+            (::std::min)(_Off, _Haystack_size - _Needle_size) + _Needle_size, _Myneedle.data(), _Needle_size,
+            &_Mybackward);
+    }
+
+    template class _MJSTR_API searcher<byte_t>;
+    template class _MJSTR_API searcher<char>;
+    template class _MJSTR_API searcher<wchar_t>;
+} // namespace mjx
\ No newline at end of file
@@ -0,0 +1,52 @@
+// searcher.hpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#ifndef _MJSTR_SEARCHER_HPP_
+#define _MJSTR_SEARCHER_HPP_
+#include <cstddef>
+#include <mjstr/api.hpp>
+#include <mjstr/char_traits.hpp>
+#include <mjstr/impl/two_way.hpp>
+#include <mjstr/string_view.hpp>
+
+namespace mjx {
+    template <class _Elem>
+    class _MJSTR_API searcher { // searches many haystacks for the same needle
+    public:
+        static_assert(compatible_element<_Elem>, "invalid element type for searcher<CharT>");
+
+        using value_type = _Elem;
+        using size_type  = size_t;
+
+        static constexpr size_type npos = static_cast<size_type>(-1);
+
+        // Note: The searcher doesn't copy the needle, so it must outlive the searcher.
+        explicit searcher(const string_view<_Elem> _Needle) noexcept;
+
+        searcher(const searcher&) noexcept            = default;
+        searcher& operator=(const searcher&) noexcept = default;
+
+        // returns the needle
+        string_view<_Elem> needle() const noexcept;
+
+        // finds the first occurrence of the needle
+        size_type find(const string_view<_Elem> _Haystack, const size_type _Off = 0) const noexcept;
+
+        // finds the last occurrence of the needle
+        size_type rfind(const string_view<_Elem> _Haystack, const size_type _Off = npos) const noexcept;
+
+    private:
+        string_view<_Elem> _Myneedle;
+        mjstr_impl::_Two_way_table _Myforward; // used only if the needle is long enough
+        mjstr_impl::_Two_way_table _Mybackward; // the same as _Myforward, but for the reversed needle
+    };
+
+    using byte_searcher    = searcher<byte_t>;
+    using utf8_searcher    = searcher<char>;
+    using unicode_searcher = searcher<wchar_t>;
+} // namespace mjx
+
+#endif // _MJSTR_SEARCHER_HPP_
\ No newline at end of file
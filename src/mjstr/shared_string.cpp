@@ -0,0 +1,111 @@
+// shared_string.cpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <mjmem/exception.hpp>
+#include <mjstr/impl/shared_string_inline.hpp>
+#include <mjstr/shared_string.hpp>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace mjx {
+    template <class _Elem>
+    shared_string<_Elem>::shared_string() noexcept : _Myrep(nullptr) {}
+
+    template <class _Elem>
+    shared_string<_Elem>::shared_string(const shared_string& _Other) noexcept : _Myrep(_Other._Myrep) {
+        if (_Myrep) { // the new reference is derived from an existing one, no ordering is required
+            _Myrep->_Refs.fetch_add(1, ::std::memory_order_relaxed);
+        }
+    }
+
+    template <class _Elem>
+    shared_string<_Elem>::shared_string(shared_string&& _Other) noexcept : _Myrep(_Other._Myrep) {
+        _Other._Myrep = nullptr;
+    }
+
+    template <class _Elem>
+    shared_string<_Elem>::shared_string(const string_view<_Elem> _Str, memory_resource* const _Resource)
+        : shared_string(_Str.data(), _Str.size(), _Resource) {}
+
+    template <class _Elem>
+    shared_string<_Elem>::shared_string(
+        const_pointer _Ptr, const size_type _Count, memory_resource* const _Resource)
+        : _Myrep(nullptr) {
+        if (_Count == 0) { // the empty value is represented by a null pointer
+            return;
+        }
+
+        constexpr size_type _Max_size = (static_cast<size_type>(-1) - _Header_size) / sizeof(_Elem) - 1;
+        if (_Count > _Max_size) { // requested too much memory, break
+            allocation_limit_exceeded::raise();
+        }
+
+        memory_resource* const _Target = _Resource ? _Resource : global_memory_resource();
+        void* const _Raw               = _Target->allocate(_Header_size + (_Count + 1) * sizeof(_Elem)); // may throw
+        _Myrep                         = ::new (_Raw) _Rep{{1}, _Count, _Target};
+        _Elem* const _Chars            = const_cast<_Elem*>(_Rep_data(_Myrep));
+        traits_type::copy(_Chars, _Ptr, _Count);
+        _Chars[_Count] = _Elem();
+    }
+
+    template <class _Elem>
+    shared_string<_Elem>::~shared_string() noexcept {
+        reset();
+    }
+
+    template <class _Elem>
+    shared_string<_Elem>& shared_string<_Elem>::operator=(const shared_string& _Other) noexcept {
+        shared_string(_Other).swap(*this); // the copy keeps the characters alive if both strings share them
+        return *this;
+    }
+
+    template <class _Elem>
+    shared_string<_Elem>& shared_string<_Elem>::operator=(shared_string&& _Other) noexcept {
+        if (this != ::std::addressof(_Other)) {
+            reset();
+            swap(_Other);
+        }
+
+        return *this;
+    }
+
+    template <class _Elem>
+    typename shared_string<_Elem>::size_type shared_string<_Elem>::use_count() const noexcept {
+        return _Myrep ? _Myrep->_Refs.load(::std::memory_order_relaxed) : 0;
+    }
+
+    template <class _Elem>
+    string<_Elem> shared_string<_Elem>::to_string(memory_resource* const _Resource) const {
+        return string<_Elem>{view(), _Resource};
+    }
+
+    template <class _Elem>
+    void shared_string<_Elem>::reset() noexcept {
+        if (!_Myrep) {
+            return;
+        }
+
+        // Note: The release half publishes the last use of the characters by this thread, the acquire half
+        //       makes the uses by all other threads visible before the memory is freed.
+        if (_Myrep->_Refs.fetch_sub(1, ::std::memory_order_acq_rel) == 1) {
+            const size_type _Bytes         = _Header_size + (_Myrep->_Size + 1) * sizeof(_Elem);
+            memory_resource* const _Target = _Myrep->_Resource;
+            _Myrep->~_Rep();
+            _Target->deallocate(_Myrep, _Bytes);
+        }
+
+        _Myrep = nullptr;
+    }
+
+    template <class _Elem>
+    void shared_string<_Elem>::swap(shared_string& _Other) noexcept {
+        ::std::swap(_Myrep, _Other._Myrep);
+    }
+
+    template class _MJSTR_API shared_string<byte_t>;
+    template class _MJSTR_API shared_string<char>;
+    template class _MJSTR_API shared_string<wchar_t>;
+} // namespace mjx
\ No newline at end of file
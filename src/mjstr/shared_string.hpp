@@ -0,0 +1,130 @@
+// shared_string.hpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#ifndef _MJSTR_SHARED_STRING_HPP_
+#define _MJSTR_SHARED_STRING_HPP_
+#include <atomic>
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <mjstr/api.hpp>
+#include <mjstr/char_traits.hpp>
+#include <mjstr/impl/hash.hpp>
+#include <mjstr/memory_resource.hpp>
+#include <mjstr/string.hpp>
+#include <mjstr/string_view.hpp>
+
+namespace mjx {
+    template <class _Elem>
+    class _MJSTR_API shared_string { // immutable string, copies share one reference-counted allocation
+    public:
+        static_assert(compatible_element<_Elem>, "invalid element type for shared_string<CharT>");
+
+        using value_type    = _Elem;
+        using size_type     = size_t;
+        using const_pointer = const _Elem*;
+        using traits_type   = char_traits<_Elem>;
+
+        // Note: The header (reference count, size and resource) and the characters are stored in a single
+        //       allocation from _Resource (the global allocator if nullptr). The empty value doesn't allocate.
+        //       Copies only increment the reference count, so a value can be shared by many threads,
+        //       but a single shared_string object must not be modified concurrently.
+        shared_string() noexcept;
+        shared_string(const shared_string& _Other) noexcept;
+        shared_string(shared_string&& _Other) noexcept;
+        explicit shared_string(const string_view<_Elem> _Str, memory_resource* const _Resource = nullptr);
+        shared_string(const_pointer _Ptr, const size_type _Count, memory_resource* const _Resource = nullptr);
+        ~shared_string() noexcept;
+
+        shared_string(::std::nullptr_t) = delete;
+
+        shared_string& operator=(const shared_string& _Other) noexcept;
+        shared_string& operator=(shared_string&& _Other) noexcept;
+
+        // returns a view into the shared characters, valid as long as any copy exists
+        _MJSTR_INLINE operator string_view<_Elem>() const noexcept;
+
+        // returns a view into the shared characters, valid as long as any copy exists
+        _MJSTR_INLINE string_view<_Elem> view() const noexcept;
+
+        // returns a pointer to the first character
+        _MJSTR_INLINE const_pointer data() const noexcept;
+
+        // returns a standard C character array version of the string
+        _MJSTR_INLINE const_pointer c_str() const noexcept;
+
+        // checks whether the string is empty
+        _MJSTR_INLINE bool empty() const noexcept;
+
+        // returns the number of characters
+        _MJSTR_INLINE size_type size() const noexcept;
+
+        // returns the number of objects that share the characters (0 if the string is empty),
+        // the value may already be outdated if other threads copy the string
+        size_type use_count() const noexcept;
+
+        // returns a modifiable copy of the characters, allocated from _Resource (the global allocator if nullptr)
+        string<_Elem> to_string(memory_resource* const _Resource = nullptr) const;
+
+        // releases the characters and makes the string empty
+        void reset() noexcept;
+
+        // swaps two strings
+        void swap(shared_string& _Other) noexcept;
+
+        // compares two strings, strings that share the characters are equal without comparing them
+        friend bool operator==(const shared_string& _Left, const shared_string& _Right) noexcept {
+            return _Left._Myrep == _Right._Myrep || _Left.view() == _Right.view();
+        }
+
+        friend bool operator==(const shared_string& _Left, const string_view<_Elem> _Right) noexcept {
+            return _Left.view() == _Right;
+        }
+
+        friend ::std::strong_ordering operator<=>(const shared_string& _Left, const shared_string& _Right) noexcept {
+            return _Left.view() <=> _Right.view();
+        }
+
+        friend ::std::strong_ordering operator<=>(
+            const shared_string& _Left, const string_view<_Elem> _Right) noexcept {
+            return _Left.view() <=> _Right;
+        }
+
+    private:
+        struct _Rep { // stored at the beginning of the allocation, followed by the characters
+            ::std::atomic<size_type> _Refs;
+            size_type _Size;
+            memory_resource* _Resource;
+        };
+
+        static constexpr size_type _Header_size =
+            (sizeof(_Rep) + memory_resource::alignment - 1) & ~(memory_resource::alignment - 1);
+
+        // returned by c_str() if the string is empty
+        static constexpr _Elem _Empty_str[1] = {};
+
+        // returns the characters that follow the header
+        static _MJSTR_INLINE const_pointer _Rep_data(const _Rep* const _Target) noexcept;
+
+        _Rep* _Myrep; // null if the string is empty
+    };
+
+    using byte_shared_string    = shared_string<byte_t>;
+    using utf8_shared_string    = shared_string<char>;
+    using unicode_shared_string = shared_string<wchar_t>;
+} // namespace mjx
+
+template <class _Elem>
+struct std::hash<::mjx::shared_string<_Elem>> { // consistent with the hash of the string and its view
+    size_t operator()(const ::mjx::shared_string<_Elem>& _Str) const noexcept {
+        return static_cast<size_t>(::mjx::mjstr_impl::_Hash_bytes_inline(_Str.data(), _Str.size() * sizeof(_Elem), 0));
+    }
+};
+
+#ifdef _MJSTR_INLINE_ACCESSORS
+#include <mjstr/impl/shared_string_inline.hpp>
+#endif // _MJSTR_INLINE_ACCESSORS
+#endif // _MJSTR_SHARED_STRING_HPP_
\ No newline at end of file
@@ -0,0 +1,291 @@
+// split.hpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#ifndef _MJSTR_SPLIT_HPP_
+#define _MJSTR_SPLIT_HPP_
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <mjstr/char_traits.hpp>
+#include <mjstr/impl/char_set.hpp>
+#include <mjstr/impl/char_traits.hpp>
+#include <mjstr/impl/utils.hpp>
+#include <mjstr/string_view.hpp>
+
+namespace mjx {
+    struct split_options {
+        bool skip_empty  = false; // don't return empty fields
+        size_t max_count = static_cast<size_t>(-1); // the last returned field contains the rest of the input
+    };
+
+    namespace mjstr_impl {
+        enum class _Split_mode : unsigned char {
+            _Char, // split at a single character
+            _Substring, // split at a sequence of characters
+            _Any // split at any character from a set
+        };
+    } // namespace mjstr_impl
+
+    template <class _Elem>
+    class split_range { // lazy range of the fields of a view, never allocates
+    public:
+        static_assert(compatible_element<_Elem>, "invalid element type for split_range<CharT>");
+
+        using value_type  = string_view<_Elem>;
+        using size_type   = size_t;
+        using traits_type = char_traits<_Elem>;
+
+        static constexpr size_type npos = static_cast<size_type>(-1);
+
+        class iterator { // forward iterator over the fields, valid as long as the range exists
+        public:
+            using iterator_concept  = ::std::forward_iterator_tag;
+            using iterator_category = ::std::input_iterator_tag; // the fields are returned by value
+            using value_type        = string_view<_Elem>;
+            using difference_type   = ptrdiff_t;
+            using pointer           = const string_view<_Elem>*;
+            using reference         = string_view<_Elem>;
+
+            iterator() noexcept : _Myrange(nullptr), _Myfield(), _Mynext(0), _Mycount(0) {}
+
+            // returns the current field, a view into the split view
+            reference operator*() const noexcept {
+#ifdef _DEBUG
+                _INTERNAL_ASSERT(_Myrange != nullptr, "attempt to dereference end iterator");
+#endif // _DEBUG
+                return _Myfield;
+            }
+
+            pointer operator->() const noexcept {
+#ifdef _DEBUG
+                _INTERNAL_ASSERT(_Myrange != nullptr, "attempt to dereference end iterator");
+#endif // _DEBUG
+                return ::std::addressof(_Myfield);
+            }
+
+            // advances the iterator to the next field
+            iterator& operator++() noexcept {
+#ifdef _DEBUG
+                _INTERNAL_ASSERT(_Myrange != nullptr, "attempt to increment end iterator");
+#endif // _DEBUG
+                _Myrange->_Next_field(*this);
+                return *this;
+            }
+
+            iterator operator++(int) noexcept {
+                iterator _Temp = *this;
+                ++*this;
+                return _Temp;
+            }
+
+            friend bool operator==(const iterator& _Left, const iterator& _Right) noexcept {
+                return _Left._Myrange == _Right._Myrange && _Left._Mycount == _Right._Mycount;
+            }
+
+        private:
+            friend split_range;
+
+            const split_range* _Myrange; // null if there are no more fields
+            string_view<_Elem> _Myfield;
+            size_type _Mynext; // the offset of the next field, npos if the current field is the last one
+            size_type _Mycount; // the number of fields returned so far, including the current one
+        };
+
+        using const_iterator = iterator;
+
+        // Note: Use split(), split_any() and split_whitespace() to create the range. The range refers to
+        //       the split characters and the delimiters, both must outlive it and all its iterators.
+        split_range(const string_view<_Elem> _Str, const string_view<_Elem> _Delim, const _Elem _Ch,
+            const mjstr_impl::_Split_mode _Mode, const split_options& _Options) noexcept
+            : _Mydata(_Str.data()), _Mysize(_Str.size()), _Mydelim(_Delim.data()), _Mydelim_size(_Delim.size()),
+              _Mych(_Ch), _Mymode(_Mode), _Myoptions(_Options), _Myset() {
+            if (_Mode == mjstr_impl::_Split_mode::_Any) { // build the set once, it's used by every search
+                mjstr_impl::_Build_char_set(_Myset, _Mydelim, _Mydelim_size);
+            }
+        }
+
+        // returns an iterator to the first field, finds the field first
+        iterator begin() const noexcept {
+            iterator _Iter;
+            if (_Myoptions.max_count > 0) {
+                _Iter._Myrange = this;
+                _Next_field(_Iter);
+            }
+
+            return _Iter;
+        }
+
+        // returns an iterator past the last field
+        iterator end() const noexcept {
+            return iterator{};
+        }
+
+    private:
+        using _Traits = mjstr_impl::_Char_traits<_Elem>;
+
+        size_type _Find_delimiter(const size_type _Off) const noexcept {
+            // returns the offset of the next delimiter, the searches use the SIMD kernels
+            size_type _Pos;
+            switch (_Mymode) {
+            case mjstr_impl::_Split_mode::_Char:
+                _Pos = _Traits::_Find(_Mydata + _Off, _Mysize - _Off, _Mych);
+                break;
+            case mjstr_impl::_Split_mode::_Substring:
+                if (_Mydelim_size == 0) { // nothing to split at
+                    return npos;
+                }
+
+                _Pos = traits_type::find(_Mydata + _Off, _Mysize - _Off, _Mydelim, _Mydelim_size);
+                break;
+            default:
+                _Pos = mjstr_impl::_Find_in_char_set<true>(_Mydata + _Off, _Mysize - _Off, _Myset, _Mydelim);
+                break;
+            }
+
+            return _Pos != npos ? _Off + _Pos : npos;
+        }
+
+        size_type _Skip_delimiters(size_type _Off) const noexcept {
+            // returns the offset of the first character that doesn't start a delimiter
+            switch (_Mymode) {
+            case mjstr_impl::_Split_mode::_Char:
+                while (_Off < _Mysize && _Mydata[_Off] == _Mych) {
+                    ++_Off;
+                }
+
+                break;
+            case mjstr_impl::_Split_mode::_Substring:
+                if (_Mydelim_size > 0) {
+                    while (_Mysize - _Off >= _Mydelim_size && _Traits::_Eq(_Mydata + _Off, _Mydelim, _Mydelim_size)) {
+                        _Off += _Mydelim_size;
+                    }
+                }
+
+                break;
+            default:
+                if (_Off < _Mysize && mjstr_impl::_Char_set_contains(_Myset, _Mydelim, _Mydata[_Off])) {
+                    // usually a short run, scan it with the SIMD kernels anyway
+                    const size_type _Pos = mjstr_impl::_Find_in_char_set<false>(
+                        _Mydata + _Off + 1, _Mysize - _Off - 1, _Myset, _Mydelim);
+                    return _Pos != npos ? _Off + 1 + _Pos : npos;
+                }
+
+                break;
+            }
+
+            return _Off < _Mysize ? _Off : npos;
+        }
+
+        void _Next_field(iterator& _Iter) const noexcept {
+            size_type _First = _Iter._Mynext;
+            if (_First != npos && _Myoptions.skip_empty) {
+                _First = _Skip_delimiters(_First);
+            }
+
+            if (_First == npos) { // no more fields
+                _Iter = iterator{};
+                return;
+            }
+
+            // the last allowed field contains the rest of the input, including the delimiters
+            const size_type _Last = _Iter._Mycount + 1 == _Myoptions.max_count ? npos : _Find_delimiter(_First);
+            if (_Last == npos) {
+                _Iter._Myfield = string_view<_Elem>{_Mydata + _First, _Mysize - _First};
+                _Iter._Mynext  = npos;
+            } else {
+                _Iter._Myfield = string_view<_Elem>{_Mydata + _First, _Last - _First};
+                _Iter._Mynext  = _Last + (_Mymode == mjstr_impl::_Split_mode::_Substring ? _Mydelim_size : 1);
+            }
+
+            ++_Iter._Mycount;
+        }
+
+        const _Elem* _Mydata; // cached, the accessors of the view may be defined in the library
+        size_type _Mysize;
+        const _Elem* _Mydelim; // unused if a single character delimits the fields
+        size_type _Mydelim_size;
+        _Elem _Mych; // used only if a single character delimits the fields
+        mjstr_impl::_Split_mode _Mymode;
+        split_options _Myoptions;
+        mjstr_impl::_Char_set _Myset; // used only if any character from a set delimits the fields
+    };
+
+    using byte_split_range    = split_range<byte_t>;
+    using utf8_split_range    = split_range<char>;
+    using unicode_split_range = split_range<wchar_t>;
+
+    // Note: The fields are views into _Str, nothing is copied or allocated. The input is scanned lazily,
+    //       one field per increment, so it may be arbitrarily large. An empty input contains a single empty
+    //       field unless the empty fields are skipped, and an empty delimiter doesn't split the input.
+
+    // splits a view at every occurrence of a character or a sequence of characters
+    inline byte_split_range split(
+        const byte_string_view _Str, const byte_t _Delim, const split_options& _Options = {}) noexcept {
+        return byte_split_range{_Str, byte_string_view{}, _Delim, mjstr_impl::_Split_mode::_Char, _Options};
+    }
+
+    inline utf8_split_range split(
+        const utf8_string_view _Str, const char _Delim, const split_options& _Options = {}) noexcept {
+        return utf8_split_range{_Str, utf8_string_view{}, _Delim, mjstr_impl::_Split_mode::_Char, _Options};
+    }
+
+    inline unicode_split_range split(
+        const unicode_string_view _Str, const wchar_t _Delim, const split_options& _Options = {}) noexcept {
+        return unicode_split_range{_Str, unicode_string_view{}, _Delim, mjstr_impl::_Split_mode::_Char, _Options};
+    }
+
+    inline byte_split_range split(
+        const byte_string_view _Str, const byte_string_view _Delim, const split_options& _Options = {}) noexcept {
+        return byte_split_range{_Str, _Delim, byte_t{}, mjstr_impl::_Split_mode::_Substring, _Options};
+    }
+
+    inline utf8_split_range split(
+        const utf8_string_view _Str, const utf8_string_view _Delim, const split_options& _Options = {}) noexcept {
+        return utf8_split_range{_Str, _Delim, char{}, mjstr_impl::_Split_mode::_Substring, _Options};
+    }
+
+    inline unicode_split_range split(const unicode_string_view _Str, const unicode_string_view _Delim,
+        const split_options& _Options = {}) noexcept {
+        return unicode_split_range{_Str, _Delim, wchar_t{}, mjstr_impl::_Split_mode::_Substring, _Options};
+    }
+
+    // splits a view at every character from _Set
+    inline byte_split_range split_any(
+        const byte_string_view _Str, const byte_string_view _Set, const split_options& _Options = {}) noexcept {
+        return byte_split_range{_Str, _Set, byte_t{}, mjstr_impl::_Split_mode::_Any, _Options};
+    }
+
+    inline utf8_split_range split_any(
+        const utf8_string_view _Str, const utf8_string_view _Set, const split_options& _Options = {}) noexcept {
+        return utf8_split_range{_Str, _Set, char{}, mjstr_impl::_Split_mode::_Any, _Options};
+    }
+
+    inline unicode_split_range split_any(const unicode_string_view _Str, const unicode_string_view _Set,
+        const split_options& _Options = {}) noexcept {
+        return unicode_split_range{_Str, _Set, wchar_t{}, mjstr_impl::_Split_mode::_Any, _Options};
+    }
+
+    // splits a view at runs of ASCII whitespace, the empty fields are always skipped
+    inline byte_split_range split_whitespace(
+        const byte_string_view _Str, const size_t _Max_count = static_cast<size_t>(-1)) noexcept {
+        const byte_string_view _Set{mjstr_impl::_Whitespace_chars<byte_t>, mjstr_impl::_Whitespace_count};
+        return split_any(_Str, _Set, {true, _Max_count});
+    }
+
+    inline utf8_split_range split_whitespace(
+        const utf8_string_view _Str, const size_t _Max_count = static_cast<size_t>(-1)) noexcept {
+        const utf8_string_view _Set{mjstr_impl::_Whitespace_chars<char>, mjstr_impl::_Whitespace_count};
+        return split_any(_Str, _Set, {true, _Max_count});
+    }
+
+    inline unicode_split_range split_whitespace(
+        const unicode_string_view _Str, const size_t _Max_count = static_cast<size_t>(-1)) noexcept {
+        const unicode_string_view _Set{mjstr_impl::_Whitespace_chars<wchar_t>, mjstr_impl::_Whitespace_count};
+        return split_any(_Str, _Set, {true, _Max_count});
+    }
+} // namespace mjx
+
+#endif // _MJSTR_SPLIT_HPP_
\ No newline at end of file
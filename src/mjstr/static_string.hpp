@@ -0,0 +1,821 @@
+// static_string.hpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#ifndef _MJSTR_STATIC_STRING_HPP_
+#define _MJSTR_STATIC_STRING_HPP_
+#include <algorithm>
+#include <climits>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <mjmem/exception.hpp>
+#include <mjstr/char_traits.hpp>
+#include <mjstr/impl/utils.hpp>
+#include <mjstr/string.hpp>
+#include <mjstr/string_view.hpp>
+#include <type_traits>
+
+namespace mjx {
+    namespace mjstr_impl {
+        template <size_t _Capacity>
+        using _Compact_size_t = ::std::conditional_t<_Capacity <= UINT8_MAX, uint8_t,
+            ::std::conditional_t<_Capacity <= UINT16_MAX, uint16_t,
+                ::std::conditional_t<_Capacity <= UINT32_MAX, uint32_t, size_t>>>;
+    } // namespace mjstr_impl
+
+    template <class _Elem, size_t _Capacity>
+    class static_string { // fixed-capacity string that never allocates memory
+    public:
+        static_assert(compatible_element<_Elem>, "invalid element type for static_string<CharT, N>");
+        static_assert(_Capacity > 0, "static_string<CharT, N> requires non-zero capacity");
+
+        using value_type      = _Elem;
+        using size_type       = size_t;
+        using difference_type = ptrdiff_t;
+        using pointer         = _Elem*;
+        using const_pointer   = const _Elem*;
+        using reference       = _Elem&;
+        using const_reference = const _Elem&;
+        using traits_type     = char_traits<_Elem>;
+
+        using const_iterator = string_const_iterator<_Elem>;
+        using iterator       = string_iterator<_Elem>;
+
+        static constexpr size_type npos = static_cast<size_type>(-1);
+
+        // Note: The string is trivially copyable, so arrays of strings may be copied with memcpy().
+        //       Operations that would exceed the capacity throw allocation_limit_exceeded and leave
+        //       the string unchanged, append_truncated() stores as many characters as fit instead.
+        static_string() noexcept;
+        static_string(const static_string&)            = default;
+        static_string& operator=(const static_string&) = default;
+        ~static_string()                               = default;
+
+        static_string(const size_type _Count, const value_type _Ch);
+        static_string(const_pointer _Ptr, const size_type _Count);
+        static_string(const_pointer _Ptr);
+        static_string(const string_view<_Elem> _Str);
+
+        static_string(::std::nullptr_t)            = delete;
+        static_string& operator=(::std::nullptr_t) = delete;
+
+        // returns a non-modifiable string_view into the entire string
+        operator string_view<_Elem>() const noexcept;
+
+        // assigns characters to the string
+        static_string& operator=(const_pointer _Ptr);
+        static_string& operator=(const value_type _Ch);
+        static_string& operator=(const string_view<_Elem> _Str);
+
+        // appends characters to the end
+        static_string& operator+=(const_pointer _Ptr);
+        static_string& operator+=(const value_type _Ch);
+        static_string& operator+=(const string_view<_Elem> _Str);
+
+        // accesses the specified character
+        reference operator[](const size_type _Idx) noexcept;
+        const_reference operator[](const size_type _Idx) const noexcept;
+
+        // returns an iterator to the beginning
+        iterator begin() noexcept;
+        const_iterator begin() const noexcept;
+
+        // returns an iterator to the end
+        iterator end() noexcept;
+        const_iterator end() const noexcept;
+
+        // accesses the specified character with bounds checking
+        reference at(const size_type _Idx);
+        const_reference at(const size_type _Idx) const;
+
+        // accesses the first character
+        reference front() noexcept;
+        const_reference front() const noexcept;
+
+        // accesses the last character
+        reference back() noexcept;
+        const_reference back() const noexcept;
+
+        // returns a pointer to the first character of a string
+        pointer data() noexcept;
+        const_pointer data() const noexcept;
+
+        // returns a non-modifiable standard C character array version of the string
+        const_pointer c_str() const noexcept;
+
+        // checks whether the string is empty
+        bool empty() const noexcept;
+
+        // checks whether the string is full
+        bool full() const noexcept;
+
+        // returns the number of characters that can be held
+        static constexpr size_type capacity() noexcept;
+
+        // returns the number of characters
+        size_type size() const noexcept;
+
+        // returns the maximum number of characters
+        static constexpr size_type max_size() noexcept;
+
+        // returns the string as a view
+        string_view<_Elem> view() const noexcept;
+
+        // copies characters
+        size_type copy(pointer _Dest, size_type _Count, const size_type _Off = 0) const;
+
+        // swaps the contents
+        void swap(static_string& _Other) noexcept;
+
+        // clears the contents
+        void clear() noexcept;
+
+        // changes the number of characters stored
+        void resize(const size_type _New_size, const value_type _Ch = value_type{});
+
+        // assigns characters to the string
+        static_string& assign(const size_type _Count, const value_type _Ch);
+        static_string& assign(const_pointer _Ptr, const size_type _Count);
+        static_string& assign(const_pointer _Ptr);
+        static_string& assign(const string_view<_Elem> _Str);
+
+        // appends characters to the end
+        static_string& append(const size_type _Count, const value_type _Ch);
+        static_string& append(const_pointer _Ptr, const size_type _Count);
+        static_string& append(const_pointer _Ptr);
+        static_string& append(const string_view<_Elem> _Str);
+
+        // appends as many characters as fit, returns the number of appended characters
+        size_type append_truncated(const string_view<_Elem> _Str) noexcept;
+
+        // appends a character to the end
+        void push_back(const value_type _Ch);
+
+        // removes the last character
+        void pop_back() noexcept;
+
+        // removes characters
+        static_string& erase(const size_type _Off = 0, size_type _Count = npos);
+        iterator erase(const const_iterator _Where);
+        iterator erase(const const_iterator _First, const const_iterator _Last);
+
+        // inserts characters
+        static_string& insert(const size_type _Off, const size_type _Count, const value_type _Ch);
+        static_string& insert(const size_type _Off, const_pointer _Ptr, const size_type _Count);
+        static_string& insert(const size_type _Off, const_pointer _Ptr);
+        static_string& insert(const size_type _Off, const string_view<_Elem> _Str);
+        iterator insert(const const_iterator _Where, const value_type _Ch);
+
+        // replaces specified portion of the string
+        static_string& replace(const size_type _Off, size_type _Count, const_pointer _Ptr, const size_type _Ptr_count);
+        static_string& replace(const size_type _Off, size_type _Count, const_pointer _Ptr);
+        static_string& replace(const size_type _Off, size_type _Count, const size_type _Ch_count, const value_type _Ch);
+        static_string& replace(const size_type _Off, size_type _Count, const string_view<_Elem> _Str);
+        static_string& replace(const const_iterator _First, const const_iterator _Last, const string_view<_Elem> _Str);
+
+        // finds the first occurrence of the given substring
+        size_type find(const_pointer _Ptr, const size_type _Off, const size_type _Count) const noexcept;
+        size_type find(const value_type _Ch, const size_type _Off = 0) const noexcept;
+        size_type find(const string_view<_Elem> _Str, const size_type _Off = 0) const noexcept;
+
+        // finds the last occurrence of the given substring
+        size_type rfind(const_pointer _Ptr, const size_type _Off, const size_type _Count) const noexcept;
+        size_type rfind(const value_type _Ch, const size_type _Off = npos) const noexcept;
+        size_type rfind(const string_view<_Elem> _Str, const size_type _Off = npos) const noexcept;
+
+        // compares two strings
+        int compare(const_pointer _Ptr, const size_type _Count) const noexcept;
+        int compare(const_pointer _Ptr) const noexcept;
+        int compare(const string_view<_Elem> _Str) const noexcept;
+
+        // checks if the string starts with the given prefix
+        bool starts_with(const string_view<_Elem> _Str) const noexcept;
+        bool starts_with(const value_type _Ch) const noexcept;
+
+        // checks if the string ends with the given suffix
+        bool ends_with(const string_view<_Elem> _Str) const noexcept;
+        bool ends_with(const value_type _Ch) const noexcept;
+
+        // checks if the string contains the given substring or character
+        bool contains(const string_view<_Elem> _Str) const noexcept;
+        bool contains(const value_type _Ch) const noexcept;
+
+        // returns a substring
+        static_string substr(const size_type _Off = 0, size_type _Count = npos) const;
+
+    private:
+        using _Size_t = mjstr_impl::_Compact_size_t<_Capacity>;
+
+        // throws an exception if the specified offset is out of range
+        void _Check_offset(const size_type _Off) const;
+
+        // throws an exception if the specified offset is out of range (special case)
+        void _Check_offset_for_insertion(const size_type _Off) const;
+
+        // replaces _Count characters at _Off with _New_count uninitialized ones, returns the first of them
+        pointer _Make_room(const size_type _Off, const size_type _Count, const size_type _New_count);
+
+        // returns an offset of the specified iterator
+        size_type _Offset_of(const const_iterator _Iter) const noexcept;
+
+        // returns an iterator to the specified offset
+        iterator _Iterator_at(const size_type _Off) noexcept;
+
+        value_type _Mybuf[_Capacity + 1]; // characters and null-terminator
+        _Size_t _Mysize; // number of characters currently stored in the string
+    };
+
+    template <size_t _Capacity>
+    using static_byte_string = static_string<byte_t, _Capacity>;
+    template <size_t _Capacity>
+    using static_utf8_string = static_string<char, _Capacity>;
+    template <size_t _Capacity>
+    using static_unicode_string = static_string<wchar_t, _Capacity>;
+
+    template <class _Elem, size_t _Capacity>
+    static_string<_Elem, _Capacity>::static_string() noexcept : _Mysize(0) {
+        _Mybuf[0] = static_cast<value_type>(0); // the rest of the buffer stays uninitialized
+    }
+
+    template <class _Elem, size_t _Capacity>
+    static_string<_Elem, _Capacity>::static_string(const size_type _Count, const value_type _Ch) : static_string() {
+        append(_Count, _Ch);
+    }
+
+    template <class _Elem, size_t _Capacity>
+    static_string<_Elem, _Capacity>::static_string(const_pointer _Ptr, const size_type _Count) : static_string() {
+        append(_Ptr, _Count);
+    }
+
+    template <class _Elem, size_t _Capacity>
+    static_string<_Elem, _Capacity>::static_string(const_pointer _Ptr) : static_string() {
+        append(_Ptr, traits_type::length(_Ptr));
+    }
+
+    template <class _Elem, size_t _Capacity>
+    static_string<_Elem, _Capacity>::static_string(const string_view<_Elem> _Str) : static_string() {
+        append(_Str.data(), _Str.size());
+    }
+
+    template <class _Elem, size_t _Capacity>
+    void static_string<_Elem, _Capacity>::_Check_offset(const size_type _Off) const {
+        if (_Off >= _Mysize) { // must be within [0, size())
+            resource_overrun::raise();
+        }
+    }
+
+    template <class _Elem, size_t _Capacity>
+    void static_string<_Elem, _Capacity>::_Check_offset_for_insertion(const size_type _Off) const {
+        if (_Off > _Mysize) { // must be within [0, size()]
+            resource_overrun::raise();
+        }
+    }
+
+    template <class _Elem, size_t _Capacity>
+    typename static_string<_Elem, _Capacity>::pointer static_string<_Elem, _Capacity>::_Make_room(
+        const size_type _Off, const size_type _Count, const size_type _New_count) {
+        if (_New_count > _Count && _New_count - _Count > _Capacity - _Mysize) { // doesn't fit, break
+            allocation_limit_exceeded::raise();
+        }
+
+        // move the remaining characters and null-terminator
+        pointer _Where = _Mybuf + _Off;
+        traits_type::move(_Where + _New_count, _Where + _Count, _Mysize - _Off - _Count + 1);
+        _Mysize = static_cast<_Size_t>(_Mysize - _Count + _New_count);
+        return _Where;
+    }
+
+    template <class _Elem, size_t _Capacity>
+    typename static_string<_Elem, _Capacity>::size_type
+        static_string<_Elem, _Capacity>::_Offset_of(const const_iterator _Iter) const noexcept {
+        return static_cast<size_type>(_Iter._Myptr - _Mybuf);
+    }
+
+    template <class _Elem, size_t _Capacity>
+    typename static_string<_Elem, _Capacity>::iterator
+        static_string<_Elem, _Capacity>::_Iterator_at(const size_type _Off) noexcept {
+        return begin() + static_cast<difference_type>(_Off);
+    }
+
+    template <class _Elem, size_t _Capacity>
+    static_string<_Elem, _Capacity>::operator string_view<_Elem>() const noexcept {
+        return string_view<_Elem>{_Mybuf, _Mysize};
+    }
+
+    template <class _Elem, size_t _Capacity>
+    static_string<_Elem, _Capacity>& static_string<_Elem, _Capacity>::operator=(const_pointer _Ptr) {
+        return assign(_Ptr, traits_type::length(_Ptr));
+    }
+
+    template <class _Elem, size_t _Capacity>
+    static_string<_Elem, _Capacity>& static_string<_Elem, _Capacity>::operator=(const value_type _Ch) {
+        return assign(1, _Ch);
+    }
+
+    template <class _Elem, size_t _Capacity>
+    static_string<_Elem, _Capacity>& static_string<_Elem, _Capacity>::operator=(const string_view<_Elem> _Str) {
+        return assign(_Str.data(), _Str.size());
+    }
+
+    template <class _Elem, size_t _Capacity>
+    static_string<_Elem, _Capacity>& static_string<_Elem, _Capacity>::operator+=(const_pointer _Ptr) {
+        return append(_Ptr, traits_type::length(_Ptr));
+    }
+
+    template <class _Elem, size_t _Capacity>
+    static_string<_Elem, _Capacity>& static_string<_Elem, _Capacity>::operator+=(const value_type _Ch) {
+        push_back(_Ch);
+        return *this;
+    }
+
+    template <class _Elem, size_t _Capacity>
+    static_string<_Elem, _Capacity>& static_string<_Elem, _Capacity>::operator+=(const string_view<_Elem> _Str) {
+        return append(_Str.data(), _Str.size());
+    }
+
+    template <class _Elem, size_t _Capacity>
+    typename static_string<_Elem, _Capacity>::reference
+        static_string<_Elem, _Capacity>::operator[](const size_type _Idx) noexcept {
+#ifdef _DEBUG
+        _INTERNAL_ASSERT(_Idx < _Mysize, "attempt to access non-existent element");
+#endif // _DEBUG
+        return _Mybuf[_Idx];
+    }
+
+    template <class _Elem, size_t _Capacity>
+    typename static_string<_Elem, _Capacity>::const_reference
+        static_string<_Elem, _Capacity>::operator[](const size_type _Idx) const noexcept {
+#ifdef _DEBUG
+        _INTERNAL_ASSERT(_Idx < _Mysize, "attempt to access non-existent element");
+#endif // _DEBUG
+        return _Mybuf[_Idx];
+    }
+
+    template <class _Elem, size_t _Capacity>
+    typename static_string<_Elem, _Capacity>::iterator static_string<_Elem, _Capacity>::begin() noexcept {
+#ifdef _DEBUG
+        return iterator{_Mybuf, _Mybuf + _Mysize};
+#else // ^^^ _DEBUG ^^^ / vvv NDEBUG vvv
+        return iterator{_Mybuf};
+#endif // _DEBUG
+    }
+
+    template <class _Elem, size_t _Capacity>
+    typename static_string<_Elem, _Capacity>::const_iterator static_string<_Elem, _Capacity>::begin() const noexcept {
+#ifdef _DEBUG
+        return const_iterator{_Mybuf, _Mybuf + _Mysize};
+#else // ^^^ _DEBUG ^^^ / vvv NDEBUG vvv
+        return const_iterator{_Mybuf};
+#endif // _DEBUG
+    }
+
+    template <class _Elem, size_t _Capacity>
+    typename static_string<_Elem, _Capacity>::iterator static_string<_Elem, _Capacity>::end() noexcept {
+#ifdef _DEBUG
+        return iterator{_Mybuf + _Mysize, _Mybuf + _Mysize};
+#else // ^^^ _DEBUG ^^^ / vvv NDEBUG vvv
+        return iterator{_Mybuf + _Mysize};
+#endif // _DEBUG
+    }
+
+    template <class _Elem, size_t _Capacity>
+    typename static_string<_Elem, _Capacity>::const_iterator static_string<_Elem, _Capacity>::end() const noexcept {
+#ifdef _DEBUG
+        return const_iterator{_Mybuf + _Mysize, _Mybuf + _Mysize};
+#else // ^^^ _DEBUG ^^^ / vvv NDEBUG vvv
+        return const_iterator{_Mybuf + _Mysize};
+#endif // _DEBUG
+    }
+
+    template <class _Elem, size_t _Capacity>
+    typename static_string<_Elem, _Capacity>::reference static_string<_Elem, _Capacity>::at(const size_type _Idx) {
+        _Check_offset(_Idx);
+        return _Mybuf[_Idx];
+    }
+
+    template <class _Elem, size_t _Capacity>
+    typename static_string<_Elem, _Capacity>::const_reference
+        static_string<_Elem, _Capacity>::at(const size_type _Idx) const {
+        _Check_offset(_Idx);
+        return _Mybuf[_Idx];
+    }
+
+    template <class _Elem, size_t _Capacity>
+    typename static_string<_Elem, _Capacity>::reference static_string<_Elem, _Capacity>::front() noexcept {
+#ifdef _DEBUG
+        _INTERNAL_ASSERT(_Mysize > 0, "attempt to access non-existent element");
+#endif // _DEBUG
+        return _Mybuf[0];
+    }
+
+    template <class _Elem, size_t _Capacity>
+    typename static_string<_Elem, _Capacity>::const_reference static_string<_Elem, _Capacity>::front() const noexcept {
+#ifdef _DEBUG
+        _INTERNAL_ASSERT(_Mysize > 0, "attempt to access non-existent element");
+#endif // _DEBUG
+        return _Mybuf[0];
+    }
+
+    template <class _Elem, size_t _Capacity>
+    typename static_string<_Elem, _Capacity>::reference static_string<_Elem, _Capacity>::back() noexcept {
+#ifdef _DEBUG
+        _INTERNAL_ASSERT(_Mysize > 0, "attempt to access non-existent element");
+#endif // _DEBUG
+        return _Mybuf[_Mysize - 1];
+    }
+
+    template <class _Elem, size_t _Capacity>
+    typename static_string<_Elem, _Capacity>::const_reference static_string<_Elem, _Capacity>::back() const noexcept {
+#ifdef _DEBUG
+        _INTERNAL_ASSERT(_Mysize > 0, "attempt to access non-existent element");
+#endif // _DEBUG
+        return _Mybuf[_Mysize - 1];
+    }
+
+    template <class _Elem, size_t _Capacity>
+    typename static_string<_Elem, _Capacity>::pointer static_string<_Elem, _Capacity>::data() noexcept {
+        return _Mybuf;
+    }
+
+    template <class _Elem, size_t _Capacity>
+    typename static_string<_Elem, _Capacity>::const_pointer static_string<_Elem, _Capacity>::data() const noexcept {
+        return _Mybuf;
+    }
+
+    template <class _Elem, size_t _Capacity>
+    typename static_string<_Elem, _Capacity>::const_pointer static_string<_Elem, _Capacity>::c_str() const noexcept {
+        return _Mybuf;
+    }
+
+    template <class _Elem, size_t _Capacity>
+    bool static_string<_Elem, _Capacity>::empty() const noexcept {
+        return _Mysize == 0;
+    }
+
+    template <class _Elem, size_t _Capacity>
+    bool static_string<_Elem, _Capacity>::full() const noexcept {
+        return _Mysize == _Capacity;
+    }
+
+    template <class _Elem, size_t _Capacity>
+    constexpr typename static_string<_Elem, _Capacity>::size_type static_string<_Elem, _Capacity>::capacity() noexcept {
+        return _Capacity;
+    }
+
+    template <class _Elem, size_t _Capacity>
+    typename static_string<_Elem, _Capacity>::size_type static_string<_Elem, _Capacity>::size() const noexcept {
+        return _Mysize;
+    }
+
+    template <class _Elem, size_t _Capacity>
+    constexpr typename static_string<_Elem, _Capacity>::size_type static_string<_Elem, _Capacity>::max_size() noexcept {
+        return _Capacity;
+    }
+
+    template <class _Elem, size_t _Capacity>
+    string_view<_Elem> static_string<_Elem, _Capacity>::view() const noexcept {
+        return string_view<_Elem>{_Mybuf, _Mysize};
+    }
+
+    template <class _Elem, size_t _Capacity>
+    typename static_string<_Elem, _Capacity>::size_type
+        static_string<_Elem, _Capacity>::copy(pointer _Dest, size_type _Count, const size_type _Off) const {
+        return view().copy(_Dest, _Count, _Off);
+    }
+
+    template <class _Elem, size_t _Capacity>
+    void static_string<_Elem, _Capacity>::swap(static_string& _Other) noexcept {
+        const static_string _Temp = _Other;
+        _Other                    = *this;
+        *this                     = _Temp;
+    }
+
+    template <class _Elem, size_t _Capacity>
+    void static_string<_Elem, _Capacity>::clear() noexcept {
+        _Mybuf[0] = static_cast<value_type>(0);
+        _Mysize   = 0;
+    }
+
+    template <class _Elem, size_t _Capacity>
+    void static_string<_Elem, _Capacity>::resize(const size_type _New_size, const value_type _Ch) {
+        if (_New_size <= _Mysize) { // decrease size
+            _Mybuf[_New_size] = static_cast<value_type>(0);
+            _Mysize           = static_cast<_Size_t>(_New_size);
+        } else { // increase size
+            append(_New_size - _Mysize, _Ch);
+        }
+    }
+
+    template <class _Elem, size_t _Capacity>
+    static_string<_Elem, _Capacity>& static_string<_Elem, _Capacity>::assign(
+        const size_type _Count, const value_type _Ch) {
+        if (_Count > _Capacity) { // doesn't fit, break
+            allocation_limit_exceeded::raise();
+        }
+
+        traits_type::assign(_Mybuf, _Count, _Ch);
+        _Mybuf[_Count] = static_cast<value_type>(0);
+        _Mysize        = static_cast<_Size_t>(_Count);
+        return *this;
+    }
+
+    template <class _Elem, size_t _Capacity>
+    static_string<_Elem, _Capacity>& static_string<_Elem, _Capacity>::assign(
+        const_pointer _Ptr, const size_type _Count) {
+        if (_Count > _Capacity) { // doesn't fit, break
+            allocation_limit_exceeded::raise();
+        }
+
+        traits_type::move(_Mybuf, _Ptr, _Count); // the source may be a part of this string
+        _Mybuf[_Count] = static_cast<value_type>(0);
+        _Mysize        = static_cast<_Size_t>(_Count);
+        return *this;
+    }
+
+    template <class _Elem, size_t _Capacity>
+    static_string<_Elem, _Capacity>& static_string<_Elem, _Capacity>::assign(const_pointer _Ptr) {
+        return assign(_Ptr, traits_type::length(_Ptr));
+    }
+
+    template <class _Elem, size_t _Capacity>
+    static_string<_Elem, _Capacity>& static_string<_Elem, _Capacity>::assign(const string_view<_Elem> _Str) {
+        return assign(_Str.data(), _Str.size());
+    }
+
+    template <class _Elem, size_t _Capacity>
+    static_string<_Elem, _Capacity>& static_string<_Elem, _Capacity>::append(
+        const size_type _Count, const value_type _Ch) {
+        traits_type::assign(_Make_room(_Mysize, 0, _Count), _Count, _Ch);
+        return *this;
+    }
+
+    template <class _Elem, size_t _Capacity>
+    static_string<_Elem, _Capacity>& static_string<_Elem, _Capacity>::append(
+        const_pointer _Ptr, const size_type _Count) {
+        traits_type::copy(_Make_room(_Mysize, 0, _Count), _Ptr, _Count);
+        return *this;
+    }
+
+    template <class _Elem, size_t _Capacity>
+    static_string<_Elem, _Capacity>& static_string<_Elem, _Capacity>::append(const_pointer _Ptr) {
+        return append(_Ptr, traits_type::length(_Ptr));
+    }
+
+    template <class _Elem, size_t _Capacity>
+    static_string<_Elem, _Capacity>& static_string<_Elem, _Capacity>::append(const string_view<_Elem> _Str) {
+        return append(_Str.data(), _Str.size());
+    }
+
+    template <class _Elem, size_t _Capacity>
+    typename static_string<_Elem, _Capacity>::size_type
+        static_string<_Elem, _Capacity>::append_truncated(const string_view<_Elem> _Str) noexcept {
+        // Note: The string is truncated at a code unit boundary, it may split a multi-unit code point.
+        const size_type _Count = (::std::min)(_Str.size(), _Capacity - static_cast<size_type>(_Mysize));
+        traits_type::copy(_Mybuf + _Mysize, _Str.data(), _Count);
+        _Mysize         = static_cast<_Size_t>(_Mysize + _Count);
+        _Mybuf[_Mysize] = static_cast<value_type>(0);
+        return _Count;
+    }
+
+    template <class _Elem, size_t _Capacity>
+    void static_string<_Elem, _Capacity>::push_back(const value_type _Ch) {
+        if (_Mysize == _Capacity) { // no space left, break
+            allocation_limit_exceeded::raise();
+        }
+
+        _Mybuf[_Mysize]   = _Ch;
+        _Mybuf[++_Mysize] = static_cast<value_type>(0);
+    }
+
+    template <class _Elem, size_t _Capacity>
+    void static_string<_Elem, _Capacity>::pop_back() noexcept {
+#ifdef _DEBUG
+        _INTERNAL_ASSERT(_Mysize > 0, "pop_back() called on empty string");
+#endif // _DEBUG
+        _Mybuf[--_Mysize] = static_cast<value_type>(0);
+    }
+
+    template <class _Elem, size_t _Capacity>
+    static_string<_Elem, _Capacity>& static_string<_Elem, _Capacity>::erase(const size_type _Off, size_type _Count) {
+        _Check_offset_for_insertion(_Off);
+        _Count = (::std::min)(_Count, _Mysize - _Off);
+        _Make_room(_Off, _Count, 0);
+        return *this;
+    }
+
+    template <class _Elem, size_t _Capacity>
+    typename static_string<_Elem, _Capacity>::iterator
+        static_string<_Elem, _Capacity>::erase(const const_iterator _Where) {
+        const size_type _Off = _Offset_of(_Where);
+        erase(_Off, 1);
+        return _Iterator_at(_Off);
+    }
+
+    template <class _Elem, size_t _Capacity>
+    typename static_string<_Elem, _Capacity>::iterator
+        static_string<_Elem, _Capacity>::erase(const const_iterator _First, const const_iterator _Last) {
+        const size_type _Off = _Offset_of(_First);
+        erase(_Off, static_cast<size_type>(_Last._Myptr - _First._Myptr));
+        return _Iterator_at(_Off);
+    }
+
+    template <class _Elem, size_t _Capacity>
+    static_string<_Elem, _Capacity>& static_string<_Elem, _Capacity>::insert(
+        const size_type _Off, const size_type _Count, const value_type _Ch) {
+        _Check_offset_for_insertion(_Off);
+        traits_type::assign(_Make_room(_Off, 0, _Count), _Count, _Ch);
+        return *this;
+    }
+
+    template <class _Elem, size_t _Capacity>
+    static_string<_Elem, _Capacity>& static_string<_Elem, _Capacity>::insert(
+        const size_type _Off, const_pointer _Ptr, const size_type _Count) {
+        _Check_offset_for_insertion(_Off);
+        traits_type::copy(_Make_room(_Off, 0, _Count), _Ptr, _Count);
+        return *this;
+    }
+
+    template <class _Elem, size_t _Capacity>
+    static_string<_Elem, _Capacity>& static_string<_Elem, _Capacity>::insert(const size_type _Off, const_pointer _Ptr) {
+        return insert(_Off, _Ptr, traits_type::length(_Ptr));
+    }
+
+    template <class _Elem, size_t _Capacity>
+    static_string<_Elem, _Capacity>& static_string<_Elem, _Capacity>::insert(
+        const size_type _Off, const string_view<_Elem> _Str) {
+        return insert(_Off, _Str.data(), _Str.size());
+    }
+
+    template <class _Elem, size_t _Capacity>
+    typename static_string<_Elem, _Capacity>::iterator
+        static_string<_Elem, _Capacity>::insert(const const_iterator _Where, const value_type _Ch) {
+        const size_type _Off = _Offset_of(_Where);
+        insert(_Off, 1, _Ch);
+        return _Iterator_at(_Off);
+    }
+
+    template <class _Elem, size_t _Capacity>
+    static_string<_Elem, _Capacity>& static_string<_Elem, _Capacity>::replace(
+        const size_type _Off, size_type _Count, const_pointer _Ptr, const size_type _Ptr_count) {
+        _Check_offset(_Off);
+        _Count = (::std::min)(_Count, _Mysize - _Off);
+        traits_type::copy(_Make_room(_Off, _Count, _Ptr_count), _Ptr, _Ptr_count);
+        return *this;
+    }
+
+    template <class _Elem, size_t _Capacity>
+    static_string<_Elem, _Capacity>& static_string<_Elem, _Capacity>::replace(
+        const size_type _Off, size_type _Count, const_pointer _Ptr) {
+        return replace(_Off, _Count, _Ptr, traits_type::length(_Ptr));
+    }
+
+    template <class _Elem, size_t _Capacity>
+    static_string<_Elem, _Capacity>& static_string<_Elem, _Capacity>::replace(
+        const size_type _Off, size_type _Count, const size_type _Ch_count, const value_type _Ch) {
+        _Check_offset(_Off);
+        _Count = (::std::min)(_Count, _Mysize - _Off);
+        traits_type::assign(_Make_room(_Off, _Count, _Ch_count), _Ch_count, _Ch);
+        return *this;
+    }
+
+    template <class _Elem, size_t _Capacity>
+    static_string<_Elem, _Capacity>& static_string<_Elem, _Capacity>::replace(
+        const size_type _Off, size_type _Count, const string_view<_Elem> _Str) {
+        return replace(_Off, _Count, _Str.data(), _Str.size());
+    }
+
+    template <class _Elem, size_t _Capacity>
+    static_string<_Elem, _Capacity>& static_string<_Elem, _Capacity>::replace(
+        const const_iterator _First, const const_iterator _Last, const string_view<_Elem> _Str) {
+        return replace(
+            _Offset_of(_First), static_cast<size_type>(_Last._Myptr - _First._Myptr), _Str.data(), _Str.size());
+    }
+
+    template <class _Elem, size_t _Capacity>
+    typename static_string<_Elem, _Capacity>::size_type static_string<_Elem, _Capacity>::find(
+        const_pointer _Ptr, const size_type _Off, const size_type _Count) const noexcept {
+        return view().find(_Ptr, _Off, _Count);
+    }
+
+    template <class _Elem, size_t _Capacity>
+    typename static_string<_Elem, _Capacity>::size_type
+        static_string<_Elem, _Capacity>::find(const value_type _Ch, const size_type _Off) const noexcept {
+        return view().find(_Ch, _Off);
+    }
+
+    template <class _Elem, size_t _Capacity>
+    typename static_string<_Elem, _Capacity>::size_type
+        static_string<_Elem, _Capacity>::find(const string_view<_Elem> _Str, const size_type _Off) const noexcept {
+        return view().find(_Str, _Off);
+    }
+
+    template <class _Elem, size_t _Capacity>
+    typename static_string<_Elem, _Capacity>::size_type static_string<_Elem, _Capacity>::rfind(
+        const_pointer _Ptr, const size_type _Off, const size_type _Count) const noexcept {
+        return view().rfind(_Ptr, _Off, _Count);
+    }
+
+    template <class _Elem, size_t _Capacity>
+    typename static_string<_Elem, _Capacity>::size_type
+        static_string<_Elem, _Capacity>::rfind(const value_type _Ch, const size_type _Off) const noexcept {
+        return view().rfind(_Ch, _Off);
+    }
+
+    template <class _Elem, size_t _Capacity>
+    typename static_string<_Elem, _Capacity>::size_type
+        static_string<_Elem, _Capacity>::rfind(const string_view<_Elem> _Str, const size_type _Off) const noexcept {
+        return view().rfind(_Str, _Off);
+    }
+
+    template <class _Elem, size_t _Capacity>
+    int static_string<_Elem, _Capacity>::compare(const_pointer _Ptr, const size_type _Count) const noexcept {
+        return view().compare(_Ptr, _Count);
+    }
+
+    template <class _Elem, size_t _Capacity>
+    int static_string<_Elem, _Capacity>::compare(const_pointer _Ptr) const noexcept {
+        return view().compare(_Ptr);
+    }
+
+    template <class _Elem, size_t _Capacity>
+    int static_string<_Elem, _Capacity>::compare(const string_view<_Elem> _Str) const noexcept {
+        return view().compare(_Str);
+    }
+
+    template <class _Elem, size_t _Capacity>
+    bool static_string<_Elem, _Capacity>::starts_with(const string_view<_Elem> _Str) const noexcept {
+        return view().starts_with(_Str);
+    }
+
+    template <class _Elem, size_t _Capacity>
+    bool static_string<_Elem, _Capacity>::starts_with(const value_type _Ch) const noexcept {
+        return view().starts_with(_Ch);
+    }
+
+    template <class _Elem, size_t _Capacity>
+    bool static_string<_Elem, _Capacity>::ends_with(const string_view<_Elem> _Str) const noexcept {
+        return view().ends_with(_Str);
+    }
+
+    template <class _Elem, size_t _Capacity>
+    bool static_string<_Elem, _Capacity>::ends_with(const value_type _Ch) const noexcept {
+        return view().ends_with(_Ch);
+    }
+
+    template <class _Elem, size_t _Capacity>
+    bool static_string<_Elem, _Capacity>::contains(const string_view<_Elem> _Str) const noexcept {
+        return find(_Str) != npos;
+    }
+
+    template <class _Elem, size_t _Capacity>
+    bool static_string<_Elem, _Capacity>::contains(const value_type _Ch) const noexcept {
+        return find(_Ch) != npos;
+    }
+
+    template <class _Elem, size_t _Capacity>
+    static_string<_Elem, _Capacity>
+        static_string<_Elem, _Capacity>::substr(const size_type _Off, size_type _Count) const {
+        _Check_offset(_Off);
+        _Count = (::std::min)(_Count, _Mysize - _Off); // trim number of characters
+        return static_string{_Mybuf + _Off, _Count};
+    }
+
+    template <class _Elem, size_t _Capacity>
+    inline bool operator==(const static_string<_Elem, _Capacity>& _Left, const string_view<_Elem> _Right) noexcept {
+        return _Left.compare(_Right) == 0;
+    }
+
+    template <class _Elem, size_t _Capacity>
+    inline bool operator==(
+        const static_string<_Elem, _Capacity>& _Left, const static_string<_Elem, _Capacity>& _Right) noexcept {
+        return _Left.compare(_Right) == 0;
+    }
+
+    template <class _Elem, size_t _Capacity>
+    inline bool operator==(const static_string<_Elem, _Capacity>& _Left, const _Elem* const _Right) noexcept {
+        return _Left.compare(_Right) == 0;
+    }
+
+    template <class _Elem, size_t _Capacity>
+    inline ::std::strong_ordering operator<=>(
+        const static_string<_Elem, _Capacity>& _Left, const string_view<_Elem> _Right) noexcept {
+        return _Left.compare(_Right) <=> 0;
+    }
+
+    template <class _Elem, size_t _Capacity>
+    inline ::std::strong_ordering operator<=>(
+        const static_string<_Elem, _Capacity>& _Left, const static_string<_Elem, _Capacity>& _Right) noexcept {
+        return _Left.compare(_Right) <=> 0;
+    }
+
+    template <class _Elem, size_t _Capacity>
+    inline ::std::strong_ordering operator<=>(
+        const static_string<_Elem, _Capacity>& _Left, const _Elem* const _Right) noexcept {
+        return _Left.compare(_Right) <=> 0;
+    }
+} // namespace mjx
+
+#endif // _MJSTR_STATIC_STRING_HPP_
\ No newline at end of file
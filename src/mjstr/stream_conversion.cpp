@@ -0,0 +1,63 @@
+// stream_conversion.cpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <mjstr/impl/conversion.hpp>
+#include <mjstr/stream_conversion.hpp>
+
+namespace mjx {
+    utf8_decoder::utf8_decoder() noexcept : _Mypending(), _Mypending_size(0) {}
+
+    conversion_result utf8_decoder::feed(
+        const byte_string_view _Chunk, wchar_t* const _Dest, const size_t _Capacity) noexcept {
+        return mjstr_impl::_Decode_utf8_chunk(
+            _Mypending, _Mypending_size, _Chunk.data(), _Chunk.size(), _Dest, _Capacity);
+    }
+
+    conversion_result utf8_decoder::feed(
+        const utf8_string_view _Chunk, wchar_t* const _Dest, const size_t _Capacity) noexcept {
+        return mjstr_impl::_Decode_utf8_chunk(
+            _Mypending, _Mypending_size, _Chunk.data(), _Chunk.size(), _Dest, _Capacity);
+    }
+
+    bool utf8_decoder::pending() const noexcept {
+        return _Mypending_size > 0;
+    }
+
+    conversion_status utf8_decoder::finish() noexcept {
+        const bool _Incomplete = pending();
+        reset();
+        return _Incomplete ? conversion_status::invalid_input : conversion_status::ok;
+    }
+
+    void utf8_decoder::reset() noexcept {
+        _Mypending_size = 0;
+    }
+
+    utf8_encoder::utf8_encoder() noexcept : _Myhigh_surrogate(0) {}
+
+    conversion_result utf8_encoder::feed(
+        const unicode_string_view _Chunk, byte_t* const _Dest, const size_t _Capacity) noexcept {
+        return mjstr_impl::_Encode_utf8_chunk(_Myhigh_surrogate, _Chunk.data(), _Chunk.size(), _Dest, _Capacity);
+    }
+
+    conversion_result utf8_encoder::feed(
+        const unicode_string_view _Chunk, char* const _Dest, const size_t _Capacity) noexcept {
+        return mjstr_impl::_Encode_utf8_chunk(_Myhigh_surrogate, _Chunk.data(), _Chunk.size(), _Dest, _Capacity);
+    }
+
+    bool utf8_encoder::pending() const noexcept {
+        return _Myhigh_surrogate != 0;
+    }
+
+    conversion_status utf8_encoder::finish() noexcept {
+        const bool _Incomplete = pending();
+        reset();
+        return _Incomplete ? conversion_status::invalid_input : conversion_status::ok;
+    }
+
+    void utf8_encoder::reset() noexcept {
+        _Myhigh_surrogate = 0;
+    }
+} // namespace mjx
\ No newline at end of file
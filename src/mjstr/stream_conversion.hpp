@@ -0,0 +1,68 @@
+// stream_conversion.hpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#ifndef _MJSTR_STREAM_CONVERSION_HPP_
+#define _MJSTR_STREAM_CONVERSION_HPP_
+#include <cstddef>
+#include <mjstr/api.hpp>
+#include <mjstr/conversion.hpp>
+#include <mjstr/string_view.hpp>
+
+namespace mjx {
+    // Note: Both classes convert input that arrives in chunks. A character split between two chunks
+    //       is consumed with the first chunk and written when the next one completes it. If the destination
+    //       is full, the unread part of the chunk (after 'read' characters) must be passed again.
+    class _MJSTR_API utf8_decoder { // decodes UTF-8 chunks to Unicode
+    public:
+        utf8_decoder() noexcept;
+
+        utf8_decoder(const utf8_decoder&) noexcept            = default;
+        utf8_decoder& operator=(const utf8_decoder&) noexcept = default;
+
+        // decodes _Chunk into _Dest
+        conversion_result feed(const byte_string_view _Chunk, wchar_t* const _Dest, const size_t _Capacity) noexcept;
+        conversion_result feed(const utf8_string_view _Chunk, wchar_t* const _Dest, const size_t _Capacity) noexcept;
+
+        // checks whether a split sequence waits for the next chunk
+        bool pending() const noexcept;
+
+        // ends the input, fails if it ended in the middle of a sequence
+        conversion_status finish() noexcept;
+
+        // discards the split sequence, if any
+        void reset() noexcept;
+
+    private:
+        byte_t _Mypending[4]; // valid beginning of a sequence split between chunks
+        byte_t _Mypending_size;
+    };
+
+    class _MJSTR_API utf8_encoder { // encodes Unicode chunks to UTF-8
+    public:
+        utf8_encoder() noexcept;
+
+        utf8_encoder(const utf8_encoder&) noexcept            = default;
+        utf8_encoder& operator=(const utf8_encoder&) noexcept = default;
+
+        // encodes _Chunk into _Dest
+        conversion_result feed(const unicode_string_view _Chunk, byte_t* const _Dest, const size_t _Capacity) noexcept;
+        conversion_result feed(const unicode_string_view _Chunk, char* const _Dest, const size_t _Capacity) noexcept;
+
+        // checks whether a split surrogate pair waits for the next chunk (UTF-16 only)
+        bool pending() const noexcept;
+
+        // ends the input, fails if it ended in the middle of a surrogate pair
+        conversion_status finish() noexcept;
+
+        // discards the split surrogate pair, if any
+        void reset() noexcept;
+
+    private:
+        wchar_t _Myhigh_surrogate; // high surrogate split from its low surrogate, 0 if none
+    };
+} // namespace mjx
+
+#endif // _MJSTR_STREAM_CONVERSION_HPP_
\ No newline at end of file
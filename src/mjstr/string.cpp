@@ -4,816 +4,636 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <mjmem/exception.hpp>
 #include <mjmem/object_allocator.hpp>
+#include <mjstr/impl/string_inline.hpp>
 #include <mjstr/impl/utils.hpp>
 #include <mjstr/string.hpp>
 
 namespace mjx {
-    template <class _Elem>
-    string_const_iterator<_Elem>::string_const_iterator() noexcept
-#ifdef _DEBUG
-        : _Myptr(nullptr), _Mybegin(nullptr), _Myend(nullptr) {}
-#else // ^^^ _DEBUG ^^^ / vvv NDEBUG vvv
-        : _Myptr(nullptr) {}
-#endif // _DEBUG
-
-    template <class _Elem>
-    string_const_iterator<_Elem>::string_const_iterator(
-#ifdef _DEBUG
-        pointer _First, pointer _Last) noexcept : _Myptr(_First), _Mybegin(_First), _Myend(_Last) {
-        _INTERNAL_ASSERT(_First <= _Last, "invalid iterator bounds");
-    }
-#else // ^^^ _DEBUG ^^^ / vvv NDEBUG vvv
-        pointer _Ptr) noexcept : _Myptr(_Ptr) {}
-#endif // _DEBUG
-
-    template <class _Elem>
-    typename string_const_iterator<_Elem>::reference string_const_iterator<_Elem>::operator*() const noexcept {
-#ifdef _DEBUG
-        _INTERNAL_ASSERT(_Myptr != nullptr && _Myptr != _Myend, "attempt to dereference invalid iterator");
-#endif // _DEBUG
-        return *_Myptr;
-    }
-
-    template <class _Elem>
-    typename string_const_iterator<_Elem>::pointer string_const_iterator<_Elem>::operator->() const noexcept {
-#ifdef _DEBUG
-        _INTERNAL_ASSERT(_Myptr != nullptr && _Myptr != _Myend, "attempt to dereference invalid iterator");
-#endif // _DEBUG
-        return _Myptr;
-    }
-
-    template <class _Elem>
-    typename string_const_iterator<_Elem>::reference
-        string_const_iterator<_Elem>::operator[](const difference_type _Off) const noexcept {
-#ifdef _DEBUG
-        _INTERNAL_ASSERT(_Myptr != nullptr, "attempt to use invalid iterator");
-        _INTERNAL_ASSERT(_Myend - _Myptr >= _Off, "attempt to access non-existent element");
-#endif // _DEBUG
-        return _Myptr[_Off];
-    }
-
-    template <class _Elem>
-    string_const_iterator<_Elem>& string_const_iterator<_Elem>::operator++() noexcept {
-#ifdef _DEBUG
-        _INTERNAL_ASSERT(_Myptr != nullptr, "attempt to use invalid iterator");
-        _INTERNAL_ASSERT(_Myend - _Myptr > 0, "attempt to advance iterator that points to the end");
-#endif // _DEBUG
-        ++_Myptr;
-        return *this;
-    }
-
-    template <class _Elem>
-    string_const_iterator<_Elem> string_const_iterator<_Elem>::operator++(int) noexcept {
-        const string_const_iterator _Temp = *this;
-        ++*this;
-        return _Temp;
-    }
-
-    template <class _Elem>
-    string_const_iterator<_Elem>& string_const_iterator<_Elem>::operator--() noexcept {
-#ifdef _DEBUG
-        _INTERNAL_ASSERT(_Myptr != nullptr, "attempt to use invalid iterator");
-        _INTERNAL_ASSERT(_Myptr - _Mybegin > 0, "attempt to retreat iterator that points to the beginning");
-#endif // _DEBUG
-        --_Myptr;
-        return *this;
-    }
-
-    template <class _Elem>
-    string_const_iterator<_Elem> string_const_iterator<_Elem>::operator--(int) noexcept {
-        const string_const_iterator _Temp = *this;
-        --*this;
-        return _Temp;
-    }
-
-    template <class _Elem>
-    string_const_iterator<_Elem>&
-        string_const_iterator<_Elem>::operator+=(const difference_type _Off) noexcept {
-#ifdef _DEBUG
-        _INTERNAL_ASSERT(_Myptr != nullptr, "attempt to use invalid iterator");
-        _INTERNAL_ASSERT(_Myend - _Myptr >= _Off, "attempt to advance iterator beyond the end");
-#endif // _DEBUG
-        _Myptr += _Off;
-        return *this;
-    }
-
-    template <class _Elem>
-    string_const_iterator<_Elem>&
-        string_const_iterator<_Elem>::operator-=(const difference_type _Off) noexcept {
-#ifdef _DEBUG
-        _INTERNAL_ASSERT(_Myptr != nullptr, "attempt to use invalid iterator");
-        _INTERNAL_ASSERT(_Myptr - _Mybegin >= _Off, "attempt to retreat iterator beyond the beginning");
-#endif // _DEBUG
-        _Myptr -= _Off;
-        return *this;
-    }
-
-    template <class _Elem>
-    string_const_iterator<_Elem>
-        string_const_iterator<_Elem>::operator+(const difference_type _Off) const noexcept {
-        string_const_iterator _Temp = *this;
-        _Temp                      += _Off;
-        return _Temp;
-    }
-
-    template <class _Elem>
-    string_const_iterator<_Elem>
-        string_const_iterator<_Elem>::operator-(const difference_type _Off) const noexcept {
-        string_const_iterator _Temp = *this;
-        _Temp                      -= _Off;
-        return _Temp;
-    }
-
-    template <class _Elem>
-    bool string_const_iterator<_Elem>::operator==(const string_const_iterator& _Other) const noexcept {
-        return _Myptr == _Other._Myptr;
-    }
-
-    template <class _Elem>
-    ::std::strong_ordering
-        string_const_iterator<_Elem>::operator<=>(const string_const_iterator& _Other) const noexcept {
-        return _Myptr <=> _Other._Myptr;
-    }
+    namespace mjstr_impl {
+        template <class _Elem, size_t _InlineBytes>
+        constinit ::std::atomic<string_growth_policy> _String_growth_policy{string_growth_policy{}};
+    } // namespace mjstr_impl
 
     template class _MJSTR_API string_const_iterator<byte_t>;
     template class _MJSTR_API string_const_iterator<char>;
     template class _MJSTR_API string_const_iterator<wchar_t>;
 
-    template <class _Elem>
-    string_iterator<_Elem>::string_iterator() noexcept : _Mybase() {}
+    template class _MJSTR_API string_iterator<byte_t>;
+    template class _MJSTR_API string_iterator<char>;
+    template class _MJSTR_API string_iterator<wchar_t>;
 
-    template <class _Elem>
-    string_iterator<_Elem>::string_iterator(
-#ifdef _DEBUG
-        pointer _First, pointer _Last) noexcept : _Mybase(_First, _Last) {}
-#else // ^^^ _DEBUG ^^^ / vvv NDEBUG vvv
-        pointer _Ptr) noexcept : _Mybase(_Ptr) {}
-#endif // _DEBUG
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>::string() noexcept : _Mybuf() {}
 
-    template <class _Elem>
-    typename string_iterator<_Elem>::reference string_iterator<_Elem>::operator*() const noexcept {
-        return const_cast<reference>(_Mybase::operator*());
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>::string(const string& _Other) : _Mybuf() {
+        _Construct_from_ptr(_Other._Mybuf._Get(), _Other._Mybuf._Get_size());
     }
 
-    template <class _Elem>
-    typename string_iterator<_Elem>::pointer string_iterator<_Elem>::operator->() const noexcept {
-        return const_cast<pointer>(_Mybase::operator->());
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>::string(string&& _Other) noexcept : _Mybuf() {
+        _Take_contents(_Other);
     }
 
-    template <class _Elem>
-    typename string_iterator<_Elem>::reference
-        string_iterator<_Elem>::operator[](const difference_type _Off) const noexcept {
-        return const_cast<reference>(_Mybase::operator[](_Off));
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>::string(const size_type _Count, const value_type _Ch) : _Mybuf() {
+        _Construct_from_chars(_Count, _Ch);
     }
-
-    template <class _Elem>
-    string_iterator<_Elem>& string_iterator<_Elem>::operator++() noexcept {
-        _Mybase::operator++();
-        return *this;
+    
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>::string(const_pointer _Ptr, const size_type _Count) : _Mybuf() {
+        _Construct_from_ptr(_Ptr, _Count);
     }
 
-    template <class _Elem>
-    string_iterator<_Elem> string_iterator<_Elem>::operator++(int) noexcept {
-        string_iterator _Temp = *this;
-        _Mybase::operator++();
-        return _Temp;
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>::string(const_pointer _Ptr) : _Mybuf() {
+        _Construct_from_ptr(_Ptr, traits_type::length(_Ptr));
     }
 
-    template <class _Elem>
-    string_iterator<_Elem>& string_iterator<_Elem>::operator--() noexcept {
-        _Mybase::operator--();
-        return *this;
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>::string(const string_view<_Elem> _Str) : _Mybuf() {
+        _Construct_from_ptr(_Str.data(), _Str.size());
     }
 
-    template <class _Elem>
-    string_iterator<_Elem> string_iterator<_Elem>::operator--(int) noexcept {
-        string_iterator _Temp = *this;
-        _Mybase::operator--();
-        return _Temp;
-    }
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>::string(memory_resource* const _Resource, const size_type _Capacity) : _Mybuf() {
+        if (!_Resource || _Resource == global_memory_resource()) { // the default resource isn't stored
+            reserve(_Capacity); // may throw
+            return;
+        }
 
-    template <class _Elem>
-    string_iterator<_Elem>& string_iterator<_Elem>::operator+=(const difference_type _Off) noexcept {
-        _Mybase::operator+=(_Off);
-        return *this;
+        size_type _New_capacity = _Capacity;
+        pointer _New_ptr        = _Allocate_space_for_capacity(_New_capacity, _Resource); // may throw
+        *_New_ptr               = static_cast<value_type>(0);
+        _Mybuf._Set_large(_New_ptr, _New_capacity, 0, true);
     }
 
-    template <class _Elem>
-    string_iterator<_Elem>& string_iterator<_Elem>::operator-=(const difference_type _Off) noexcept {
-        _Mybase::operator-=(_Off);
-        return *this;
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>::string(const string_view<_Elem> _Str, memory_resource* const _Resource)
+        : string(_Resource, _Str.size()) {
+        append(_Str.data(), _Str.size()); // never reallocates
     }
 
-    template <class _Elem>
-    string_iterator<_Elem> string_iterator<_Elem>::operator+(const difference_type _Off) const noexcept {
-        string_iterator _Temp = *this;
-        _Temp                += _Off;
-        return _Temp;
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>::~string() noexcept {
+        _Tidy();
     }
 
-    template <class _Elem>
-    string_iterator<_Elem> string_iterator<_Elem>::operator-(const difference_type _Off) const noexcept {
-        string_iterator _Temp = *this;
-        _Temp                -= _Off;
-        return _Temp;
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>::_Internal_buffer::_Internal_buffer() noexcept : _Small{0} {
+        _Small[_Small_buffer_capacity] = static_cast<value_type>(_Small_buffer_capacity); // all characters unused
     }
 
-    template class _MJSTR_API string_iterator<byte_t>;
-    template class _MJSTR_API string_iterator<char>;
-    template class _MJSTR_API string_iterator<wchar_t>;
-
-    template <class _Elem>
-    string<_Elem>::string() noexcept : _Mybuf() {}
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>::_Internal_buffer::~_Internal_buffer() noexcept {}
 
-    template <class _Elem>
-    string<_Elem>::string(const string& _Other) : _Mybuf() {
-        _Construct_from_ptr(_Other._Mybuf._Get(), _Other._Mybuf._Size);
-    }
-
-    template <class _Elem>
-    string<_Elem>::string(string&& _Other) noexcept : _Mybuf() {
-        _Take_contents(_Other);
+    template <class _Elem, size_t _InlineBytes>
+    void string<_Elem, _InlineBytes>::_Internal_buffer::_Switch_to_small() noexcept {
+        // moves data to small buffer and deallocates large one, assumes the data fits in small buffer
+        const _Large_buffer _Old = _Large;
+        traits_type::copy(_Small, _Old._Ptr, _Old._Size);
+        _Small[_Old._Size]             = static_cast<value_type>(0);
+        _Small[_Small_buffer_capacity] = static_cast<value_type>(_Small_buffer_capacity - _Old._Size);
+        _Deallocate(_Old);
     }
 
-    template <class _Elem>
-    string<_Elem>::string(const size_type _Count, const value_type _Ch) : _Mybuf() {
-        _Construct_from_chars(_Count, _Ch);
-    }
-    
-    template <class _Elem>
-    string<_Elem>::string(const_pointer _Ptr, const size_type _Count) : _Mybuf() {
-        _Construct_from_ptr(_Ptr, _Count);
+    template <class _Elem, size_t _InlineBytes>
+    void string<_Elem, _InlineBytes>::_Internal_buffer::_Swap_small_with_large(_Internal_buffer& _Other) noexcept {
+        // copy the whole small buffer, it stores both the characters and the size
+        value_type _Temp[_Small_buffer_size];
+        traits_type::copy(_Temp, _Small, _Small_buffer_size);
+        _Set_large(_Other._Large._Ptr, _Other._Get_capacity(), _Other._Large._Size, _Other._Has_resource());
+        traits_type::copy(_Other._Small, _Temp, _Small_buffer_size);
     }
 
-    template <class _Elem>
-    string<_Elem>::string(const_pointer _Ptr) : _Mybuf() {
-        _Construct_from_ptr(_Ptr, traits_type::length(_Ptr));
+    template <class _Elem, size_t _InlineBytes>
+    void string<_Elem, _InlineBytes>::_Internal_buffer::_Deallocate_if_large() noexcept {
+        if (!_Is_small()) {
+            _Deallocate(_Large);
+            _Large._Ptr = nullptr;
+        }
     }
 
-    template <class _Elem>
-    string<_Elem>::string(const string_view<_Elem> _Str) : _Mybuf() {
-        _Construct_from_ptr(_Str.data(), _Str.size());
+    template <class _Elem, size_t _InlineBytes>
+    void string<_Elem, _InlineBytes>::_Internal_buffer::_Reset() noexcept {
+        _Small[0]                      = static_cast<value_type>(0);
+        _Small[_Small_buffer_capacity] = static_cast<value_type>(_Small_buffer_capacity);
     }
 
-    template <class _Elem>
-    string<_Elem>::~string() noexcept {
-        _Tidy();
+    template <class _Elem, size_t _InlineBytes>
+    bool string<_Elem, _InlineBytes>::_Internal_buffer::_Has_resource() const noexcept {
+        return !_Is_small() && (_Large._Capacity & _Resource_flag) != 0;
     }
 
-    template <class _Elem>
-    string<_Elem>::_Internal_buffer::_Internal_buffer() noexcept
-        : _Capacity(_Small_buffer_capacity), _Size(0), _Small{0} {}
-
-    template <class _Elem>
-    string<_Elem>::_Internal_buffer::~_Internal_buffer() noexcept {}
+    template <class _Elem, size_t _InlineBytes>
+    memory_resource* string<_Elem, _InlineBytes>::_Internal_buffer::_Get_resource() const noexcept {
+        if (!_Has_resource()) { // the global allocator is used
+            return nullptr;
+        }
 
-    template <class _Elem>
-    bool string<_Elem>::_Internal_buffer::_Is_small() const noexcept {
-        return _Capacity <= _Small_buffer_capacity;
+        return *reinterpret_cast<memory_resource* const*>(
+            reinterpret_cast<const unsigned char*>(_Large._Ptr) - _Resource_header_size);
     }
 
-    template <class _Elem>
-    typename string<_Elem>::pointer string<_Elem>::_Internal_buffer::_Get() noexcept {
-        return _Capacity <= _Small_buffer_capacity ? _Small : _Large;
+    template <class _Elem, size_t _InlineBytes>
+    void string<_Elem, _InlineBytes>::_Internal_buffer::_Set_large(
+        const pointer _Ptr, const size_type _Capacity, const size_type _Size) noexcept {
+        // the new buffer was allocated from the current resource
+        _Set_large(_Ptr, _Capacity, _Size, _Has_resource());
     }
 
-    template <class _Elem>
-    typename string<_Elem>::const_pointer string<_Elem>::_Internal_buffer::_Get() const noexcept {
-        return _Capacity <= _Small_buffer_capacity ? _Small : _Large;
+    template <class _Elem, size_t _InlineBytes>
+    void string<_Elem, _InlineBytes>::_Internal_buffer::_Set_large(
+        const pointer _Ptr, const size_type _Capacity, const size_type _Size, const bool _Resource) noexcept {
+        _Large._Ptr      = _Ptr;
+        _Large._Size     = _Size;
+        _Large._Capacity = _Capacity | _Large_flag | (_Resource ? _Resource_flag : 0);
+        if constexpr (sizeof(_Small) > sizeof(_Large_buffer)) { // the last element doesn't overlap the capacity
+            _Small[_Small_buffer_capacity] = static_cast<value_type>(_Large_marker);
+        }
     }
 
-    template <class _Elem>
-    void string<_Elem>::_Internal_buffer::_Switch_to_small() noexcept {
-        // moves data to small buffer and deallocates large one, assumes the data fits in small buffer
-        value_type _Temp[_Small_buffer_size];
-        traits_type::copy(_Temp, _Large, _Size);
-        ::mjx::delete_object_array(_Large, _Capacity + 1);
-        traits_type::copy(_Small, _Temp, _Size);
-        _Capacity     = _Small_buffer_capacity;
-        _Small[_Size] = static_cast<value_type>(0);
-    }
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::pointer string<_Elem, _InlineBytes>::_Internal_buffer::_Allocate(
+        memory_resource* const _Resource, const size_type _Count) {
+        if (!_Resource) { // use the global allocator directly
+            return ::mjx::allocate_object_array<_Elem>(_Count);
+        }
 
-    template <class _Elem>
-    void string<_Elem>::_Internal_buffer::_Swap_small_with_large(_Internal_buffer& _Other) noexcept {
-        value_type _Temp[_Small_buffer_size];
-        traits_type::copy(_Temp, _Small, _Size);
-        _Large = _Other._Large;
-        traits_type::copy(_Other._Small, _Temp, _Size);
+        // store the resource in front of the characters, it's needed to reallocate and free them
+        unsigned char* const _Raw =
+            static_cast<unsigned char*>(_Resource->allocate(_Resource_header_size + _Count * sizeof(value_type)));
+        *reinterpret_cast<memory_resource**>(_Raw) = _Resource;
+        return reinterpret_cast<pointer>(_Raw + _Resource_header_size);
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    void string<_Elem, _InlineBytes>::_Internal_buffer::_Deallocate(const _Large_buffer& _Buf) noexcept {
+        const size_type _Count = (_Buf._Capacity & _Capacity_mask) + 1;
+        if ((_Buf._Capacity & _Resource_flag) == 0) { // use the global allocator directly
+            ::mjx::delete_object_array(_Buf._Ptr, _Count);
+        } else {
+            unsigned char* const _Raw = reinterpret_cast<unsigned char*>(_Buf._Ptr) - _Resource_header_size;
+            (*reinterpret_cast<memory_resource**>(_Raw))
+                ->deallocate(_Raw, _Resource_header_size + _Count * sizeof(value_type));
+        }
     }
 
-    template <class _Elem>
-    void string<_Elem>::_Internal_buffer::_Deallocate_if_large() noexcept {
-        if (_Capacity > _Small_buffer_capacity) {
-            ::mjx::delete_object_array(_Large, _Capacity + 1);
-            _Large = nullptr;
-        }
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::pointer
+        string<_Elem, _InlineBytes>::_Allocate_space_for_capacity(size_type& _Count) const {
+        return _Allocate_space_for_capacity(_Count, _Mybuf._Get_resource());
     }
 
-    template <class _Elem>
-    typename string<_Elem>::pointer string<_Elem>::_Allocate_space_for_capacity(size_type& _Count) {
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::pointer string<_Elem, _InlineBytes>::_Allocate_space_for_capacity(
+        size_type& _Count, memory_resource* const _Resource) {
         // allocate _Count + 1 elements aligned to _Alloc_align boundary
         _Count |= _Alloc_mask;
         if (_Count > max_size() - 1) { // requested too much memory, break
             allocation_limit_exceeded::raise();
         }
 
-        return ::mjx::allocate_object_array<_Elem>(_Count + 1);
+        return _Internal_buffer::_Allocate(_Resource, _Count + 1);
     }
 
-    template <class _Elem>
-    void string<_Elem>::_Tidy() noexcept {
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::size_type
+        string<_Elem, _InlineBytes>::_Calculate_growth(const size_type _Required) const noexcept {
+        // Note: Growing the capacity geometrically keeps the amortized cost of appending characters
+        //       constant. Growing by the exact number of requested characters would reallocate
+        //       (and copy) the whole string on almost every append, making a loop of appends quadratic.
+        //       The capacity is capped below max_size(), which would exceed the limit once it's rounded up
+        //       by _Allocate_space_for_capacity().
+        const size_type _Max_capacity = (max_size() & ~_Alloc_mask) - 1;
+        return mjstr_impl::_String_growth_policy<_Elem, _InlineBytes>.load(::std::memory_order_relaxed)
+            .next_capacity(_Mybuf._Get_capacity(), _Required, _Max_capacity);
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    void string<_Elem, _InlineBytes>::_Tidy() noexcept {
         _Mybuf._Deallocate_if_large();
-        _Mybuf._Capacity = 0;
-        _Mybuf._Size     = 0;
+        _Mybuf._Reset();
     }
 
-    template <class _Elem>
-    void string<_Elem>::_Check_offset(const size_type _Off) const {
-        if (_Off >= _Mybuf._Size) { // must be within [0, _Mybuf._Size)
+    template <class _Elem, size_t _InlineBytes>
+    void string<_Elem, _InlineBytes>::_Check_offset(const size_type _Off) const {
+        if (_Off >= _Mybuf._Get_size()) { // must be within [0, size())
             resource_overrun::raise();
         }
     }
 
-    template <class _Elem>
-    void string<_Elem>::_Check_offset_for_insertion(const size_type _Off) const {
-        if (_Off > _Mybuf._Size) { // must be within [0, _Mybuf._Size]
+    template <class _Elem, size_t _InlineBytes>
+    void string<_Elem, _InlineBytes>::_Check_offset_for_insertion(const size_type _Off) const {
+        if (_Off > _Mybuf._Get_size()) { // must be within [0, size()]
             resource_overrun::raise();
         }
     }
 
-    template <class _Elem>
-    void string<_Elem>::_Take_contents(string& _Other) noexcept {
+    template <class _Elem, size_t _InlineBytes>
+    void string<_Elem, _InlineBytes>::_Take_contents(string& _Other) noexcept {
         _Tidy(); // destroy the current string
-        _Mybuf._Capacity = _Other._Mybuf._Capacity;
-        _Mybuf._Size     = _Other._Mybuf._Size;
-        if (_Other._Mybuf._Is_small()) { // take small buffer
-            // copy data and null-terminator
-            traits_type::copy(_Mybuf._Small, _Other._Mybuf._Small, _Other._Mybuf._Size + 1);
-            _Other._Mybuf._Small[0] = static_cast<value_type>(0);
-        } else { // take large buffer
-            _Mybuf._Large           = _Other._Mybuf._Large;
-            _Other._Mybuf._Large    = nullptr;
-            _Other._Mybuf._Small[0] = static_cast<value_type>(0); // start lifetime of small buffer
+        if (_Other._Mybuf._Is_small()) { // take small buffer, the size is stored in its last element
+            traits_type::copy(_Mybuf._Small, _Other._Mybuf._Small, _Small_buffer_size);
+        } else { // take large buffer, together with its resource
+            _Mybuf._Set_large(_Other._Mybuf._Large._Ptr, _Other._Mybuf._Get_capacity(), _Other._Mybuf._Large._Size,
+                _Other._Mybuf._Has_resource());
         }
 
-        _Other._Mybuf._Capacity = _Small_buffer_capacity;
-        _Other._Mybuf._Size     = 0;
+        _Other._Mybuf._Reset();
     }
 
-    template <class _Elem>
-    void string<_Elem>::_Construct_from_ptr(const_pointer _Ptr, const size_type _Count) {
+    template <class _Elem, size_t _InlineBytes>
+    void string<_Elem, _InlineBytes>::_Construct_from_ptr(const_pointer _Ptr, const size_type _Count) {
         if (_Count <= _Small_buffer_capacity) { // use small buffer
             traits_type::copy(_Mybuf._Small, _Ptr, _Count);
-            _Mybuf._Size                = _Count;
-            _Mybuf._Small[_Mybuf._Size] = static_cast<value_type>(0);
+            _Mybuf._Small[_Count] = static_cast<value_type>(0);
+            _Mybuf._Set_size(_Count);
         } else { // use large buffer
             size_type _New_capacity = _Count;
             pointer _New_ptr        = _Allocate_space_for_capacity(_New_capacity); // may throw
             traits_type::copy(_New_ptr, _Ptr, _Count);
-            _Mybuf._Capacity            = _New_capacity;
-            _Mybuf._Size                = _Count;
-            _Mybuf._Large               = _New_ptr;
-            _Mybuf._Large[_Mybuf._Size] = static_cast<value_type>(0);
+            _New_ptr[_Count] = static_cast<value_type>(0);
+            _Mybuf._Set_large(_New_ptr, _New_capacity, _Count);
         }
     }
 
-    template <class _Elem>
-    void string<_Elem>::_Construct_from_chars(const size_type _Count, const value_type _Ch) {
+    template <class _Elem, size_t _InlineBytes>
+    void string<_Elem, _InlineBytes>::_Construct_from_chars(const size_type _Count, const value_type _Ch) {
         if (_Count <= _Small_buffer_capacity) { // use small buffer
             traits_type::assign(_Mybuf._Small, _Count, _Ch);
-            _Mybuf._Size                = _Count;
-            _Mybuf._Small[_Mybuf._Size] = static_cast<value_type>(0);
+            _Mybuf._Small[_Count] = static_cast<value_type>(0);
+            _Mybuf._Set_size(_Count);
         } else { // use large buffer
             size_type _New_capacity = _Count;
             pointer _New_ptr        = _Allocate_space_for_capacity(_New_capacity); // may throw
             traits_type::assign(_New_ptr, _Count, _Ch);
-            _Mybuf._Capacity            = _New_capacity;
-            _Mybuf._Size                = _Count;
-            _Mybuf._Large               = _New_ptr;
-            _Mybuf._Large[_Mybuf._Size] = static_cast<value_type>(0);
+            _New_ptr[_Count] = static_cast<value_type>(0);
+            _Mybuf._Set_large(_New_ptr, _New_capacity, _Count);
         }
     }
 
-    template <class _Elem>
-    void string<_Elem>::_Reallocate_assign(const size_type _Count, const value_type _Ch) {
+    template <class _Elem, size_t _InlineBytes>
+    void string<_Elem, _InlineBytes>::_Reallocate_assign(const size_type _Count, const value_type _Ch) {
         size_type _New_capacity = _Count;
         pointer _New_ptr        = _Allocate_space_for_capacity(_New_capacity); // may throw
         _Mybuf._Deallocate_if_large();
         traits_type::assign(_New_ptr, _Count, _Ch);
-        _Mybuf._Capacity            = _New_capacity;
-        _Mybuf._Size                = _Count;
-        _Mybuf._Large               = _New_ptr;
-        _Mybuf._Large[_Mybuf._Size] = static_cast<value_type>(0);
+        _New_ptr[_Count] = static_cast<value_type>(0);
+        _Mybuf._Set_large(_New_ptr, _New_capacity, _Count);
     }
 
-    template <class _Elem>
-    void string<_Elem>::_Reallocate_assign(const_pointer _Ptr, const size_type _Count) {
+    template <class _Elem, size_t _InlineBytes>
+    void string<_Elem, _InlineBytes>::_Reallocate_assign(const_pointer _Ptr, const size_type _Count) {
         size_type _New_capacity = _Count;
         pointer _New_ptr        = _Allocate_space_for_capacity(_New_capacity); // may throw
         _Mybuf._Deallocate_if_large();
         traits_type::copy(_New_ptr, _Ptr, _Count);
-        _Mybuf._Capacity            = _New_capacity;
-        _Mybuf._Size                = _Count;
-        _Mybuf._Large               = _New_ptr;
-        _Mybuf._Large[_Mybuf._Size] = static_cast<value_type>(0);
+        _New_ptr[_Count] = static_cast<value_type>(0);
+        _Mybuf._Set_large(_New_ptr, _New_capacity, _Count);
     }
 
-    template <class _Elem>
-    void string<_Elem>::_Reallocate_insert_back(const size_type _Count, const value_type _Ch) {
-        const size_type _New_size = _Mybuf._Size + _Count;
-        size_type _New_capacity   = _Mybuf._Capacity + (_New_size - _Mybuf._Capacity);
+    template <class _Elem, size_t _InlineBytes>
+    void string<_Elem, _InlineBytes>::_Reallocate_insert_back(const size_type _Count, const value_type _Ch) {
+        const size_type _New_size = _Mybuf._Get_size() + _Count;
+        size_type _New_capacity   = _Calculate_growth(_New_size);
         pointer _New_ptr          = _Allocate_space_for_capacity(_New_capacity); // may throw
-        traits_type::copy(_New_ptr, _Mybuf._Get(), _Mybuf._Size);
-        traits_type::assign(_New_ptr + _Mybuf._Size, _Count, _Ch);
+        traits_type::copy(_New_ptr, _Mybuf._Get(), _Mybuf._Get_size());
+        traits_type::assign(_New_ptr + _Mybuf._Get_size(), _Count, _Ch);
         _Mybuf._Deallocate_if_large();
-        _Mybuf._Capacity            = _New_capacity;
-        _Mybuf._Size                = _New_size;
-        _Mybuf._Large               = _New_ptr;
-        _Mybuf._Large[_Mybuf._Size] = static_cast<value_type>(0);
+        _New_ptr[_New_size] = static_cast<value_type>(0);
+        _Mybuf._Set_large(_New_ptr, _New_capacity, _New_size);
     }
 
-    template <class _Elem>
-    void string<_Elem>::_Reallocate_insert_back(const_pointer _Ptr, const size_type _Count) {
-        const size_type _New_size = _Mybuf._Size + _Count;
-        size_type _New_capacity   = _Mybuf._Capacity + (_New_size - _Mybuf._Capacity);
+    template <class _Elem, size_t _InlineBytes>
+    void string<_Elem, _InlineBytes>::_Reallocate_insert_back(const_pointer _Ptr, const size_type _Count) {
+        const size_type _New_size = _Mybuf._Get_size() + _Count;
+        size_type _New_capacity   = _Calculate_growth(_New_size);
         pointer _New_ptr          = _Allocate_space_for_capacity(_New_capacity); // may throw
-        traits_type::copy(_New_ptr, _Mybuf._Get(), _Mybuf._Capacity);
-        traits_type::copy(_New_ptr + _Mybuf._Size, _Ptr, _Count);
+        traits_type::copy(_New_ptr, _Mybuf._Get(), _Mybuf._Get_size());
+        traits_type::copy(_New_ptr + _Mybuf._Get_size(), _Ptr, _Count);
         _Mybuf._Deallocate_if_large();
-        _Mybuf._Capacity            = _New_capacity;
-        _Mybuf._Size                = _New_size;
-        _Mybuf._Large               = _New_ptr;
-        _Mybuf._Large[_Mybuf._Size] = static_cast<value_type>(0);
+        _New_ptr[_New_size] = static_cast<value_type>(0);
+        _Mybuf._Set_large(_New_ptr, _New_capacity, _New_size);
     }
 
-    template <class _Elem>
-    void string<_Elem>::_Reallocate_insert_at(const size_type _Off, const size_type _Count, const value_type _Ch) {
-        const size_type _New_size = _Mybuf._Size + _Count;
-        size_type _New_capacity   = _Mybuf._Capacity + (_New_size - _Mybuf._Capacity);
+    template <class _Elem, size_t _InlineBytes>
+    void string<_Elem, _InlineBytes>::_Reallocate_insert_at(
+        const size_type _Off, const size_type _Count, const value_type _Ch) {
+        const size_type _New_size = _Mybuf._Get_size() + _Count;
+        size_type _New_capacity   = _Calculate_growth(_New_size);
         pointer _New_ptr          = _Allocate_space_for_capacity(_New_capacity); // may throw
         const_pointer _Old_ptr    = _Mybuf._Get();
         traits_type::copy(_New_ptr, _Old_ptr, _Off);
         traits_type::assign(_New_ptr + _Off, _Count, _Ch);
-        traits_type::copy(_New_ptr + _Off + _Count, _Old_ptr + _Off, _Mybuf._Size - _Off + 1);
+        traits_type::copy(_New_ptr + _Off + _Count, _Old_ptr + _Off, _Mybuf._Get_size() - _Off + 1);
         _Mybuf._Deallocate_if_large();
-        _Mybuf._Capacity = _New_capacity;
-        _Mybuf._Size     = _New_size;
-        _Mybuf._Large    = _New_ptr;
+        _Mybuf._Set_large(_New_ptr, _New_capacity, _New_size);
     }
 
-    template <class _Elem>
-    void string<_Elem>::_Reallocate_insert_at(const size_type _Off, const_pointer _Ptr, const size_type _Count) {
-        const size_type _New_size = _Mybuf._Size + _Count;
-        size_type _New_capacity   = _Mybuf._Capacity + (_New_size - _Mybuf._Capacity);
+    template <class _Elem, size_t _InlineBytes>
+    void string<_Elem, _InlineBytes>::_Reallocate_insert_at(
+        const size_type _Off, const_pointer _Ptr, const size_type _Count) {
+        const size_type _New_size = _Mybuf._Get_size() + _Count;
+        size_type _New_capacity   = _Calculate_growth(_New_size);
         pointer _New_ptr          = _Allocate_space_for_capacity(_New_capacity); // may throw
         const_pointer _Old_ptr    = _Mybuf._Get();
         traits_type::copy(_New_ptr, _Old_ptr, _Off);
         traits_type::copy(_New_ptr + _Off, _Ptr, _Count);
-        traits_type::copy(_New_ptr + _Off + _Count, _Old_ptr + _Off, _Mybuf._Size - _Off + 1);
+        traits_type::copy(_New_ptr + _Off + _Count, _Old_ptr + _Off, _Mybuf._Get_size() - _Off + 1);
         _Mybuf._Deallocate_if_large();
-        _Mybuf._Capacity = _New_capacity;
-        _Mybuf._Size     = _New_size;
-        _Mybuf._Large    = _New_ptr;
+        _Mybuf._Set_large(_New_ptr, _New_capacity, _New_size);
     }
 
-    template <class _Elem>
-    void string<_Elem>::_Reallocate_replace(
+    template <class _Elem, size_t _InlineBytes>
+    void string<_Elem, _InlineBytes>::_Reallocate_replace(
         const size_type _Off, const size_type _Count, const size_type _Ch_count, const value_type _Ch) {
-        const size_type _New_size = _Mybuf._Size + (_Ch_count - _Count);
-        size_type _New_capacity   = _Mybuf._Capacity + (_New_size - _Mybuf._Capacity);
+        const size_type _New_size = _Mybuf._Get_size() + (_Ch_count - _Count);
+        size_type _New_capacity   = _Calculate_growth(_New_size);
         pointer _New_ptr          = _Allocate_space_for_capacity(_New_capacity); // may throw
         const_pointer _Old_ptr    = _Mybuf._Get();
         traits_type::copy(_New_ptr, _Old_ptr, _Off);
         traits_type::assign(_New_ptr + _Off, _Ch_count, _Ch);
         traits_type::copy(
-            _New_ptr + _Off + _Ch_count, _Old_ptr + _Off + _Count, _Mybuf._Size - _Off - _Count + 1);
+            _New_ptr + _Off + _Ch_count, _Old_ptr + _Off + _Count, _Mybuf._Get_size() - _Off - _Count + 1);
         _Mybuf._Deallocate_if_large();
-        _Mybuf._Capacity = _New_capacity;
-        _Mybuf._Size     = _New_size;
-        _Mybuf._Large    = _New_ptr;
+        _Mybuf._Set_large(_New_ptr, _New_capacity, _New_size);
     }
 
-    template <class _Elem>
-    void string<_Elem>::_Reallocate_replace(
+    template <class _Elem, size_t _InlineBytes>
+    void string<_Elem, _InlineBytes>::_Reallocate_replace(
         const size_type _Off, const size_type _Count, const_pointer _Ptr, const size_type _Ptr_count) {
-        const size_type _New_size = _Mybuf._Size + (_Ptr_count - _Count);
-        size_type _New_capacity   = _Mybuf._Capacity + (_New_size - _Mybuf._Capacity);
+        const size_type _New_size = _Mybuf._Get_size() + (_Ptr_count - _Count);
+        size_type _New_capacity   = _Calculate_growth(_New_size);
         pointer _New_ptr          = _Allocate_space_for_capacity(_New_capacity); // may throw
         const_pointer _Old_ptr    = _Mybuf._Get();
         traits_type::copy(_New_ptr, _Old_ptr, _Off);
         traits_type::copy(_New_ptr + _Off, _Ptr, _Ptr_count);
         traits_type::copy(
-            _New_ptr + _Off + _Ptr_count, _Old_ptr + _Off + _Count, _Mybuf._Size - _Off - _Count + 1);
+            _New_ptr + _Off + _Ptr_count, _Old_ptr + _Off + _Count, _Mybuf._Get_size() - _Off - _Count + 1);
         _Mybuf._Deallocate_if_large();
-        _Mybuf._Capacity = _New_capacity;
-        _Mybuf._Size     = _New_size;
-        _Mybuf._Large    = _New_ptr;
-    }
-
-    template <class _Elem>
-    string<_Elem>::operator string_view<_Elem>() const noexcept {
-        return string_view<_Elem>{_Mybuf._Get(), _Mybuf._Size};
+        _Mybuf._Set_large(_New_ptr, _New_capacity, _New_size);
     }
 
-    template <class _Elem>
-    string<_Elem>& string<_Elem>::operator=(const string& _Str) {
-        return assign(_Str._Mybuf._Get(), _Str._Mybuf._Size);
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>& string<_Elem, _InlineBytes>::operator=(const string& _Str) {
+        return assign(_Str._Mybuf._Get(), _Str._Mybuf._Get_size());
     }
 
-    template <class _Elem>
-    string<_Elem>& string<_Elem>::operator=(string&& _Str) noexcept {
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>& string<_Elem, _InlineBytes>::operator=(string&& _Str) noexcept {
         return assign(::std::move(_Str));
     }
 
-    template <class _Elem>
-    string<_Elem>& string<_Elem>::operator=(const_pointer _Ptr) {
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>& string<_Elem, _InlineBytes>::operator=(const_pointer _Ptr) {
         return assign(_Ptr, traits_type::length(_Ptr));
     }
 
-    template <class _Elem>
-    string<_Elem>& string<_Elem>::operator=(const value_type _Ch) {
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>& string<_Elem, _InlineBytes>::operator=(const value_type _Ch) {
         return assign(1, _Ch);
     }
 
-    template <class _Elem>
-    string<_Elem>& string<_Elem>::operator=(const string_view<_Elem> _Str) {
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>& string<_Elem, _InlineBytes>::operator=(const string_view<_Elem> _Str) {
         return assign(_Str.data(), _Str.size());
     }
 
-    template <class _Elem>
-    string<_Elem>& string<_Elem>::operator+=(const string& _Str) {
-        return append(_Str._Mybuf._Get(), _Str._Mybuf._Size);
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>& string<_Elem, _InlineBytes>::operator+=(const string& _Str) {
+        return append(_Str._Mybuf._Get(), _Str._Mybuf._Get_size());
     }
 
-    template <class _Elem>
-    string<_Elem>& string<_Elem>::operator+=(const_pointer _Ptr) {
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>& string<_Elem, _InlineBytes>::operator+=(const_pointer _Ptr) {
         return append(_Ptr, traits_type::length(_Ptr));
     }
 
-    template <class _Elem>
-    string<_Elem>& string<_Elem>::operator+=(const value_type _Ch) {
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>& string<_Elem, _InlineBytes>::operator+=(const value_type _Ch) {
         push_back(_Ch);
         return *this;
     }
 
-    template <class _Elem>
-    string<_Elem>& string<_Elem>::operator+=(const string_view<_Elem> _Str) {
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>& string<_Elem, _InlineBytes>::operator+=(const string_view<_Elem> _Str) {
         return append(_Str.data(), _Str.size());
     }
 
-    template <class _Elem>
-    typename string<_Elem>::reference string<_Elem>::operator[](const size_type _Idx) noexcept {
-        // no bounds checking is performed, the behavior is undefined if _Idx >= size()
-        return _Mybuf._Get()[_Idx];
-    }
-
-    template <class _Elem>
-    typename string<_Elem>::const_reference string<_Elem>::operator[](const size_type _Idx) const noexcept {
-        // no bounds checking is performed, the behavior is undefined if _Idx >= size()
-        return _Mybuf._Get()[_Idx];
-    }
-
-    template <class _Elem>
-    typename string<_Elem>::iterator string<_Elem>::begin() noexcept {
-#ifdef _DEBUG
-        return iterator{_Mybuf._Get(), _Mybuf._Get() + _Mybuf._Size};
-#else // ^^^ _DEBUG ^^^ / vvv NDEBUG vvv
-        return iterator{_Mybuf._Get()};
-#endif // _DEBUG
-    }
-
-    template <class _Elem>
-    typename string<_Elem>::const_iterator string<_Elem>::begin() const noexcept {
-#ifdef _DEBUG
-        return const_iterator{_Mybuf._Get(), _Mybuf._Get() + _Mybuf._Size};
-#else // ^^^ _DEBUG ^^^ / vvv NDEBUG vvv
-        return const_iterator{_Mybuf._Get()};
-#endif // _DEBUG
-    }
-
-    template <class _Elem>
-    typename string<_Elem>::iterator string<_Elem>::end() noexcept {
-#ifdef _DEBUG
-        return iterator{_Mybuf._Get() + _Mybuf._Size, _Mybuf._Get() + _Mybuf._Size};
-#else // ^^^ _DEBUG ^^^ / vvv NDEBUG vvv
-        return iterator{_Mybuf._Get() + _Mybuf._Size};
-#endif // _DEBUG
-    }
-
-    template <class _Elem>
-    typename string<_Elem>::const_iterator string<_Elem>::end() const noexcept {
-#ifdef _DEBUG
-        return const_iterator{_Mybuf._Get() + _Mybuf._Size, _Mybuf._Get() + _Mybuf._Size};
-#else // ^^^ _DEBUG ^^^ / vvv NDEBUG vvv
-        return const_iterator{_Mybuf._Get() + _Mybuf._Size};
-#endif // _DEBUG
-    }
-
-    template <class _Elem>
-    typename string<_Elem>::reference string<_Elem>::at(const size_type _Idx) {
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::reference string<_Elem, _InlineBytes>::at(const size_type _Idx) {
         _Check_offset(_Idx);
         return _Mybuf._Get()[_Idx];
     }
 
-    template <class _Elem>
-    typename string<_Elem>::const_reference string<_Elem>::at(const size_type _Idx) const {
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::const_reference string<_Elem, _InlineBytes>::at(const size_type _Idx) const {
         _Check_offset(_Idx);
         return _Mybuf._Get()[_Idx];
     }
 
-    template <class _Elem>
-    typename string<_Elem>::reference string<_Elem>::front() noexcept {
-#ifdef _DEBUG
-        _INTERNAL_ASSERT(_Mybuf._Size > 0, "attempt to access non-existent element");
-#endif // _DEBUG
-        return *_Mybuf._Get();
-    }
-
-    template <class _Elem>
-    typename string<_Elem>::const_reference string<_Elem>::front() const noexcept {
-#ifdef _DEBUG
-        _INTERNAL_ASSERT(_Mybuf._Size > 0, "attempt to access non-existent element");
-#endif // _DEBUG
-        return *_Mybuf._Get();
-    }
-
-    template <class _Elem>
-    typename string<_Elem>::reference string<_Elem>::back() noexcept {
-#ifdef _DEBUG
-        _INTERNAL_ASSERT(_Mybuf._Size > 0, "attempt to access non-existent element");
-#endif // _DEBUG
-        return _Mybuf._Get()[_Mybuf._Size - 1];
-    }
-
-    template <class _Elem>
-    typename string<_Elem>::const_reference string<_Elem>::back() const noexcept {
-#ifdef _DEBUG
-        _INTERNAL_ASSERT(_Mybuf._Size > 0, "attempt to access non-existent element");
-#endif // _DEBUG
-        return _Mybuf._Get()[_Mybuf._Size - 1];
-    }
-
-    template <class _Elem>
-    typename string<_Elem>::pointer string<_Elem>::data() noexcept {
-        return _Mybuf._Get();
-    }
-
-    template <class _Elem>
-    typename string<_Elem>::const_pointer string<_Elem>::data() const noexcept {
-        return _Mybuf._Get();
-    }
-
-    template <class _Elem>
-    typename string<_Elem>::const_pointer string<_Elem>::c_str() const noexcept {
-        return _Mybuf._Get();
-    }
-
-    template <class _Elem>
-    bool string<_Elem>::empty() const noexcept {
-        return _Mybuf._Size == 0;
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::size_type string<_Elem, _InlineBytes>::max_size() noexcept {
+        // the two highest bits of the capacity are flags, the resource header must fit in size_t too
+        return (::std::min)(static_cast<size_type>(PTRDIFF_MAX),
+            static_cast<size_type>(-1) / sizeof(value_type)) / 2 - 1;
     }
 
-    template <class _Elem>
-    typename string<_Elem>::size_type string<_Elem>::capacity() const noexcept {
-        return _Mybuf._Capacity;
+    template <class _Elem, size_t _InlineBytes>
+    memory_resource* string<_Elem, _InlineBytes>::get_memory_resource() const noexcept {
+        memory_resource* const _Resource = _Mybuf._Get_resource();
+        return _Resource ? _Resource : global_memory_resource();
     }
 
-    template <class _Elem>
-    typename string<_Elem>::size_type string<_Elem>::size() const noexcept {
-        return _Mybuf._Size;
+    template <class _Elem, size_t _InlineBytes>
+    string_growth_policy string<_Elem, _InlineBytes>::growth_policy() noexcept {
+        return mjstr_impl::_String_growth_policy<_Elem, _InlineBytes>.load(::std::memory_order_relaxed);
     }
 
-    template <class _Elem>
-    typename string<_Elem>::size_type string<_Elem>::max_size() noexcept {
-        return (::std::min)(static_cast<size_type>(PTRDIFF_MAX),
-            static_cast<size_type>(-1) / sizeof(value_type)) - 1;
-    }
+    template <class _Elem, size_t _InlineBytes>
+    bool string<_Elem, _InlineBytes>::set_growth_policy(const string_growth_policy _Policy) noexcept {
+        if (!_Policy.is_geometric()) { // appends would become quadratic, keep the current policy
+            return false;
+        }
 
-    template <class _Elem>
-    string_view<_Elem> string<_Elem>::view() const noexcept {
-        return string_view<_Elem>{_Mybuf._Get(), _Mybuf._Size};
+        mjstr_impl::_String_growth_policy<_Elem, _InlineBytes>.store(_Policy, ::std::memory_order_relaxed);
+        return true;
     }
 
-    template <class _Elem>
-    void string<_Elem>::reserve(size_type _New_capacity) {
-        if (_Mybuf._Capacity >= _New_capacity || _New_capacity <= _Small_buffer_capacity) {
+    template <class _Elem, size_t _InlineBytes>
+    void string<_Elem, _InlineBytes>::reserve(size_type _New_capacity) {
+        if (_Mybuf._Get_capacity() >= _New_capacity || _New_capacity <= _Small_buffer_capacity) {
             // already reserved requested or more capacity, or fits in small buffer, do nothing
             return;
         }
 
         pointer _New_ptr = _Allocate_space_for_capacity(_New_capacity); // may throw
-        traits_type::copy(_New_ptr, _Mybuf._Get(), _Mybuf._Size + 1); // copy data and null-terminator
+        const size_type _Old_size = _Mybuf._Get_size();
+        traits_type::copy(_New_ptr, _Mybuf._Get(), _Old_size + 1); // copy data and null-terminator
         _Mybuf._Deallocate_if_large();
-        _Mybuf._Capacity = _New_capacity;
-        _Mybuf._Large    = _New_ptr;
+        _Mybuf._Set_large(_New_ptr, _New_capacity, _Old_size);
     }
 
-    template <class _Elem>
-    typename string<_Elem>::size_type
-        string<_Elem>::copy(pointer _Dest, size_type _Count, const size_type _Off) const {
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::size_type
+        string<_Elem, _InlineBytes>::copy(pointer _Dest, size_type _Count, const size_type _Off) const {
         return view().copy(_Dest, _Count, _Off);
     }
 
-    template <class _Elem>
-    void string<_Elem>::swap(string& _Other) noexcept {
+    template <class _Elem, size_t _InlineBytes>
+    void string<_Elem, _InlineBytes>::swap(string& _Other) noexcept {
         if (this != ::std::addressof(_Other)) {
             const bool _This_small  = _Mybuf._Is_small();
             const bool _Other_small = _Other._Mybuf._Is_small();
-            if (_This_small && _Other_small) { // swap two small buffers
-                // copy null-terminators to skip assigning them after copying
+            if (_This_small && _Other_small) { // swap two small buffers, sizes are stored in them
                 value_type _Temp[_Small_buffer_size];
-                traits_type::copy(_Temp, _Mybuf._Small, _Mybuf._Size + 1);
-                traits_type::copy(_Mybuf._Small, _Other._Mybuf._Small, _Other._Mybuf._Size + 1);
-                traits_type::copy(_Other._Mybuf._Small, _Temp, _Mybuf._Size + 1);
+                traits_type::copy(_Temp, _Mybuf._Small, _Small_buffer_size);
+                traits_type::copy(_Mybuf._Small, _Other._Mybuf._Small, _Small_buffer_size);
+                traits_type::copy(_Other._Mybuf._Small, _Temp, _Small_buffer_size);
             } else if (_This_small) { // swap small with large
                 _Mybuf._Swap_small_with_large(_Other._Mybuf);
             } else if (_Other_small) { // swap large with small
                 _Other._Mybuf._Swap_small_with_large(_Mybuf);
-            } else { // swap two large buffers
+            } else { // swap two large buffers, together with their resources
                 ::std::swap(_Mybuf._Large, _Other._Mybuf._Large);
             }
-
-            ::std::swap(_Mybuf._Size, _Other._Mybuf._Size);
-            ::std::swap(_Mybuf._Capacity, _Other._Mybuf._Capacity);
         }
     }
 
-    template <class _Elem>
-    void string<_Elem>::clear() noexcept {
-        if (_Mybuf._Size > 0) {
+    template <class _Elem, size_t _InlineBytes>
+    void string<_Elem, _InlineBytes>::clear() noexcept {
+        if (_Mybuf._Get_size() > 0) {
             *_Mybuf._Get() = static_cast<value_type>(0);
-            _Mybuf._Size   = 0;
+            _Mybuf._Set_size(0);
         }
     }
 
-    template <class _Elem>
-    void string<_Elem>::resize(const size_type _New_size, const value_type _Ch) {
-        if (_New_size <= _Mybuf._Size) { // decrease buffer size
-            _Mybuf._Size                = _New_size;
-            _Mybuf._Get()[_Mybuf._Size] = static_cast<value_type>(0);
+    template <class _Elem, size_t _InlineBytes>
+    void string<_Elem, _InlineBytes>::resize(const size_type _New_size, const value_type _Ch) {
+        if (_New_size <= _Mybuf._Get_size()) { // decrease buffer size
+            _Mybuf._Get()[_New_size] = static_cast<value_type>(0);
+            _Mybuf._Set_size(_New_size);
         } else { // increase buffer size
-            append(_New_size - _Mybuf._Size, _Ch);
+            append(_New_size - _Mybuf._Get_size(), _Ch);
+        }
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    void string<_Elem, _InlineBytes>::resize_uninitialized(const size_type _New_size) {
+        if (_New_size > _Mybuf._Get_capacity()) { // increase buffer capacity, keep the current characters
+            size_type _New_capacity = _Calculate_growth(_New_size);
+            pointer _New_ptr        = _Allocate_space_for_capacity(_New_capacity); // may throw
+            traits_type::copy(_New_ptr, _Mybuf._Get(), _Mybuf._Get_size());
+            _Mybuf._Deallocate_if_large();
+            _Mybuf._Set_large(_New_ptr, _New_capacity, _New_size);
+        }
+
+        _Mybuf._Get()[_New_size] = static_cast<value_type>(0);
+        _Mybuf._Set_size(_New_size);
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    void string<_Elem, _InlineBytes>::_Finish_overwrite(const size_type _Count, const size_type _New_size) {
+        if (_New_size > _Count) { // wrote more characters than requested, break
+            resource_overrun::raise();
+        }
+
+        _Mybuf._Get()[_New_size] = static_cast<value_type>(0);
+        _Mybuf._Set_size(_New_size);
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::pointer
+        string<_Elem, _InlineBytes>::append_uninitialized(const size_type _Count) {
+        const size_type _Old_size = _Mybuf._Get_size();
+        if (_Count > max_size() - _Old_size) { // the string would be too long, break
+            allocation_limit_exceeded::raise();
+        }
+
+        if (_Old_size + _Count > _Mybuf._Get_capacity()) { // increase buffer capacity, keep the size
+            size_type _New_capacity = _Calculate_growth(_Old_size + _Count);
+            pointer _New_ptr        = _Allocate_space_for_capacity(_New_capacity); // may throw
+            traits_type::copy(_New_ptr, _Mybuf._Get(), _Old_size + 1); // copy data and null-terminator
+            _Mybuf._Deallocate_if_large();
+            _Mybuf._Set_large(_New_ptr, _New_capacity, _Old_size);
+        }
+
+        return _Mybuf._Get() + _Old_size;
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    void string<_Elem, _InlineBytes>::commit(const size_type _Count) {
+        const size_type _Old_size = _Mybuf._Get_size();
+        if (_Count > _Mybuf._Get_capacity() - _Old_size) { // committed more than the available space, break
+            resource_overrun::raise();
         }
+
+        _Mybuf._Get()[_Old_size + _Count] = static_cast<value_type>(0);
+        _Mybuf._Set_size(_Old_size + _Count);
     }
 
-    template <class _Elem>
-    void string<_Elem>::expand(const size_type _Count, const value_type _Ch) {
+    template <class _Elem, size_t _InlineBytes>
+    void string<_Elem, _InlineBytes>::expand(const size_type _Count, const value_type _Ch) {
         if (_Count == 0) { // no expanding, do nothing
             return;
         }
 
-        if (_Mybuf._Size + _Count <= _Mybuf._Capacity) { // found enough space, don't reallocate memory
+        const size_type _Old_size = _Mybuf._Get_size();
+        if (_Old_size + _Count <= _Mybuf._Get_capacity()) { // found enough space, don't reallocate memory
             pointer _Old_ptr = _Mybuf._Get();
-            traits_type::assign(_Old_ptr + _Mybuf._Size, _Count, _Ch);
-            _Mybuf._Size          += _Count;
-            _Old_ptr[_Mybuf._Size] = static_cast<value_type>(0);
+            traits_type::assign(_Old_ptr + _Old_size, _Count, _Ch);
+            _Old_ptr[_Old_size + _Count] = static_cast<value_type>(0);
+            _Mybuf._Set_size(_Old_size + _Count);
             return;
         }
 
         _Reallocate_insert_back(_Count, _Ch);
     }
 
-    template <class _Elem>
-    void string<_Elem>::shrink(const size_type _Count) noexcept {
+    template <class _Elem, size_t _InlineBytes>
+    void string<_Elem, _InlineBytes>::shrink(const size_type _Count) noexcept {
         if (_Count == 0) { // no shrinking, do nothing
             return;
         }
 
-        _Mybuf._Size               -= (::std::min)(_Count, _Mybuf._Size);
-        _Mybuf._Get()[_Mybuf._Size] = static_cast<value_type>(0);
+        const size_type _New_size = _Mybuf._Get_size() - (::std::min)(_Count, _Mybuf._Get_size());
+        _Mybuf._Get()[_New_size]  = static_cast<value_type>(0);
+        _Mybuf._Set_size(_New_size);
     }
 
-    template <class _Elem>
-    void string<_Elem>::shrink_to_fit() {
+    template <class _Elem, size_t _InlineBytes>
+    void string<_Elem, _InlineBytes>::shrink_to_fit() {
         if (_Mybuf._Is_small()) { // small string is always considered as fit
             return;
         }
 
-        if (_Mybuf._Size <= _Small_buffer_capacity) { // switch to small buffer
+        if (_Mybuf._Get_size() <= _Small_buffer_capacity && !_Mybuf._Has_resource()) { // switch to small buffer
             _Mybuf._Switch_to_small();
             return;
         }
 
-        size_type _New_capacity = _Mybuf._Size | _Alloc_mask;
-        if (_New_capacity < _Mybuf._Capacity) { // worth shrinking, do it
+        size_type _New_capacity = _Mybuf._Get_size() | _Alloc_mask;
+        if (_New_capacity < _Mybuf._Get_capacity()) { // worth shrinking, do it
             pointer _New_ptr = _Allocate_space_for_capacity(_New_capacity); // may throw
-            traits_type::copy(_New_ptr, _Mybuf._Large, _Mybuf._Size + 1); // copy null-terminator too
+            const size_type _Old_size = _Mybuf._Get_size();
+            traits_type::copy(_New_ptr, _Mybuf._Large._Ptr, _Old_size + 1); // copy null-terminator too
             _Mybuf._Deallocate_if_large();
-            _Mybuf._Capacity = _New_capacity;
-            _Mybuf._Large    = _New_ptr;
+            _Mybuf._Set_large(_New_ptr, _New_capacity, _Old_size);
         }
     }
 
-    template <class _Elem>
-    string<_Elem>& string<_Elem>::assign(const size_type _Count, const value_type _Ch) {
-        if (_Count <= _Mybuf._Capacity) { // found enough space, don't reallocate memory
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>& string<_Elem, _InlineBytes>::assign(const size_type _Count, const value_type _Ch) {
+        if (_Count <= _Mybuf._Get_capacity()) { // found enough space, don't reallocate memory
             pointer _Old_ptr = _Mybuf._Get();
             traits_type::assign(_Old_ptr, _Count, _Ch);
-            _Mybuf._Size           = _Count;
-            _Old_ptr[_Mybuf._Size] = static_cast<value_type>(0);
+            _Old_ptr[_Count] = static_cast<value_type>(0);
+            _Mybuf._Set_size(_Count);
             return *this;
         }
 
@@ -821,17 +641,17 @@ namespace mjx {
         return *this;
     }
 
-    template <class _Elem>
-    string<_Elem>& string<_Elem>::assign(const string& _Str) {
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>& string<_Elem, _InlineBytes>::assign(const string& _Str) {
         if (this == ::std::addressof(_Str)) { // must not be this string
             return *this;
         }
 
-        return assign(_Str._Mybuf._Get(), _Str._Mybuf._Size);
+        return assign(_Str._Mybuf._Get(), _Str._Mybuf._Get_size());
     }
 
-    template <class _Elem>
-    string<_Elem>& string<_Elem>::assign(string&& _Str) noexcept {
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>& string<_Elem, _InlineBytes>::assign(string&& _Str) noexcept {
         if (this == ::std::addressof(_Str)) { // must not be this string
             return *this;
         }
@@ -840,13 +660,13 @@ namespace mjx {
         return *this;
     }
 
-    template <class _Elem>
-    string<_Elem>& string<_Elem>::assign(const_pointer _Ptr, const size_type _Count) {
-        if (_Count <= _Mybuf._Capacity) { // found enough space, don't reallocate memory
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>& string<_Elem, _InlineBytes>::assign(const_pointer _Ptr, const size_type _Count) {
+        if (_Count <= _Mybuf._Get_capacity()) { // found enough space, don't reallocate memory
             pointer _Old_ptr = _Mybuf._Get();
             traits_type::copy(_Old_ptr, _Ptr, _Count);
-            _Mybuf._Size           = _Count;
-            _Old_ptr[_Mybuf._Size] = static_cast<value_type>(0);
+            _Old_ptr[_Count] = static_cast<value_type>(0);
+            _Mybuf._Set_size(_Count);
             return *this;
         }
 
@@ -854,23 +674,24 @@ namespace mjx {
         return *this;
     }
 
-    template <class _Elem>
-    string<_Elem>& string<_Elem>::assign(const_pointer _Ptr) {
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>& string<_Elem, _InlineBytes>::assign(const_pointer _Ptr) {
         return assign(_Ptr, traits_type::length(_Ptr));
     }
 
-    template <class _Elem>
-    string<_Elem>& string<_Elem>::assign(const string_view<_Elem> _Str) {
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>& string<_Elem, _InlineBytes>::assign(const string_view<_Elem> _Str) {
         return assign(_Str.data(), _Str.size());
     }
 
-    template <class _Elem>
-    string<_Elem>& string<_Elem>::append(const size_type _Count, const value_type _Ch) {
-        if (_Mybuf._Size + _Count <= _Mybuf._Capacity) { // found enough space, don't reallocate memory
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>& string<_Elem, _InlineBytes>::append(const size_type _Count, const value_type _Ch) {
+        const size_type _Old_size = _Mybuf._Get_size();
+        if (_Old_size + _Count <= _Mybuf._Get_capacity()) { // found enough space, don't reallocate memory
             pointer _Old_ptr = _Mybuf._Get();
-            traits_type::assign(_Old_ptr + _Mybuf._Size, _Count, _Ch);
-            _Mybuf._Size          += _Count;
-            _Old_ptr[_Mybuf._Size] = static_cast<value_type>(0);
+            traits_type::assign(_Old_ptr + _Old_size, _Count, _Ch);
+            _Old_ptr[_Old_size + _Count] = static_cast<value_type>(0);
+            _Mybuf._Set_size(_Old_size + _Count);
             return *this;
         }
 
@@ -878,18 +699,19 @@ namespace mjx {
         return *this;
     }
 
-    template <class _Elem>
-    string<_Elem>& string<_Elem>::append(const string& _Str) {
-        return append(_Str._Mybuf._Get(), _Str._Mybuf._Size);
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>& string<_Elem, _InlineBytes>::append(const string& _Str) {
+        return append(_Str._Mybuf._Get(), _Str._Mybuf._Get_size());
     }
 
-    template <class _Elem>
-    string<_Elem>& string<_Elem>::append(const_pointer _Ptr, const size_type _Count) {
-        if (_Mybuf._Size + _Count <= _Mybuf._Capacity) { // found enough space, don't reallocate memory
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>& string<_Elem, _InlineBytes>::append(const_pointer _Ptr, const size_type _Count) {
+        const size_type _Old_size = _Mybuf._Get_size();
+        if (_Old_size + _Count <= _Mybuf._Get_capacity()) { // found enough space, don't reallocate memory
             pointer _Old_ptr = _Mybuf._Get();
-            traits_type::copy(_Old_ptr + _Mybuf._Size, _Ptr, _Count);
-            _Mybuf._Size          += _Count;
-            _Old_ptr[_Mybuf._Size] = static_cast<value_type>(0);
+            traits_type::copy(_Old_ptr + _Old_size, _Ptr, _Count);
+            _Old_ptr[_Old_size + _Count] = static_cast<value_type>(0);
+            _Mybuf._Set_size(_Old_size + _Count);
             return *this;
         }
 
@@ -897,73 +719,79 @@ namespace mjx {
         return *this;
     }
 
-    template <class _Elem>
-    string<_Elem>& string<_Elem>::append(const_pointer _Ptr) {
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>& string<_Elem, _InlineBytes>::append(const_pointer _Ptr) {
         return append(_Ptr, traits_type::length(_Ptr));
     }
 
-    template <class _Elem>
-    string<_Elem>& string<_Elem>::append(const string_view<_Elem> _Str) {
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>& string<_Elem, _InlineBytes>::append(const string_view<_Elem> _Str) {
         return append(_Str.data(), _Str.size());
     }
 
-    template <class _Elem>
-    void string<_Elem>::push_back(const value_type _Ch) {
-        if (_Mybuf._Size + 1 <= _Mybuf._Capacity) { // found enough space, don't reallocate memory
-            pointer _Old_ptr         = _Mybuf._Get();
-            _Old_ptr[_Mybuf._Size]   = _Ch;
-            _Old_ptr[++_Mybuf._Size] = static_cast<value_type>(0);
+    template <class _Elem, size_t _InlineBytes>
+    void string<_Elem, _InlineBytes>::push_back(const value_type _Ch) {
+        const size_type _Old_size = _Mybuf._Get_size();
+        if (_Old_size < _Mybuf._Get_capacity()) { // found enough space, don't reallocate memory
+            pointer _Old_ptr        = _Mybuf._Get();
+            _Old_ptr[_Old_size]     = _Ch;
+            _Old_ptr[_Old_size + 1] = static_cast<value_type>(0);
+            _Mybuf._Set_size(_Old_size + 1);
             return;
         }
 
         _Reallocate_insert_back(1, _Ch);
     }
 
-    template <class _Elem>
-    void string<_Elem>::pop_back() noexcept {
+    template <class _Elem, size_t _InlineBytes>
+    void string<_Elem, _InlineBytes>::pop_back() noexcept {
 #ifdef _DEBUG
-        _INTERNAL_ASSERT(_Mybuf._Size > 0, "pop_back() called on empty string")
+        _INTERNAL_ASSERT(_Mybuf._Get_size() > 0, "pop_back() called on empty string")
 #endif // _DEBUG
-        --_Mybuf._Size;
-        _Mybuf._Get()[_Mybuf._Size] = static_cast<value_type>(0);
+        const size_type _New_size = _Mybuf._Get_size() - 1;
+        _Mybuf._Get()[_New_size]  = static_cast<value_type>(0);
+        _Mybuf._Set_size(_New_size);
     }
 
-    template <class _Elem>
-    string<_Elem>& string<_Elem>::erase(const size_type _Off, size_type _Count) {
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>& string<_Elem, _InlineBytes>::erase(const size_type _Off, size_type _Count) {
         _Check_offset(_Off);
-        _Count = (::std::min)(_Count, _Mybuf._Size - _Off);
+        _Count = (::std::min)(_Count, _Mybuf._Get_size() - _Off);
         if (_Count > 0) { // remove some characters
             pointer _Old_ptr          = _Mybuf._Get() + _Off;
-            const size_type _New_size = _Mybuf._Size - _Count;
+            const size_type _New_size = _Mybuf._Get_size() - _Count;
             traits_type::move(_Old_ptr, _Old_ptr + _Count, _New_size - _Off + 1); // move null-terminator too
-            _Mybuf._Size = _New_size;
+            _Mybuf._Set_size(_New_size);
         }
 
         return *this;
     }
 
-    template <class _Elem>
-    typename string<_Elem>::iterator string<_Elem>::erase(const const_iterator _Where) {
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::iterator string<_Elem, _InlineBytes>::erase(const const_iterator _Where) {
         const size_type _Off = static_cast<size_type>(_Where._Myptr - _Mybuf._Get());
         erase(_Off, 1);
         return begin() + static_cast<difference_type>(_Off);
     }
 
-    template <class _Elem>
-    typename string<_Elem>::iterator string<_Elem>::erase(const const_iterator _First, const const_iterator _Last) {
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::iterator
+        string<_Elem, _InlineBytes>::erase(const const_iterator _First, const const_iterator _Last) {
         const size_type _Off = static_cast<size_type>(_First._Myptr - _Mybuf._Get());
         erase(_Off, static_cast<size_type>(_Last._Myptr - _First._Myptr));
         return begin() + static_cast<difference_type>(_Off);
     }
 
-    template <class _Elem>
-    string<_Elem>& string<_Elem>::insert(const size_type _Off, const size_type _Count, const value_type _Ch) {
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>& string<_Elem, _InlineBytes>::insert(
+        const size_type _Off, const size_type _Count, const value_type _Ch) {
         _Check_offset_for_insertion(_Off);
-        if (_Mybuf._Size + _Count <= _Mybuf._Capacity) { // found enough space, don't reallocate memory
+        const size_type _Old_size = _Mybuf._Get_size();
+        if (_Old_size + _Count <= _Mybuf._Get_capacity()) { // found enough space, don't reallocate memory
             pointer _Old_ptr = _Mybuf._Get() + _Off;
-            traits_type::move(_Old_ptr + _Count, _Old_ptr, _Mybuf._Size - _Off + 1); // move null-terminator too
+            traits_type::move(_Old_ptr + _Count, _Old_ptr, _Old_size - _Off + 1); // move null-terminator too
             traits_type::assign(_Old_ptr, _Count, _Ch);
-            _Mybuf._Size += _Count;
+            _Mybuf._Set_size(_Old_size + _Count);
             return *this;
         }
 
@@ -971,19 +799,21 @@ namespace mjx {
         return *this;
     }
 
-    template <class _Elem>
-    string<_Elem>& string<_Elem>::insert(const size_type _Off, const_pointer _Ptr) {
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>& string<_Elem, _InlineBytes>::insert(const size_type _Off, const_pointer _Ptr) {
         return insert(_Off, _Ptr, traits_type::length(_Ptr));
     }
 
-    template <class _Elem>
-    string<_Elem>& string<_Elem>::insert(const size_type _Off, const_pointer _Ptr, const size_type _Count) {
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>& string<_Elem, _InlineBytes>::insert(
+        const size_type _Off, const_pointer _Ptr, const size_type _Count) {
         _Check_offset_for_insertion(_Off);
-        if (_Mybuf._Size + _Count <= _Mybuf._Capacity) { // found enough space, don't reallocate memory
+        const size_type _Old_size = _Mybuf._Get_size();
+        if (_Old_size + _Count <= _Mybuf._Get_capacity()) { // found enough space, don't reallocate memory
             pointer _Old_ptr = _Mybuf._Get() + _Off;
-            traits_type::move(_Old_ptr + _Count, _Old_ptr, _Mybuf._Size - _Off + 1); // move null-terminator too
+            traits_type::move(_Old_ptr + _Count, _Old_ptr, _Old_size - _Off + 1); // move null-terminator too
             traits_type::copy(_Old_ptr, _Ptr, _Count);
-            _Mybuf._Size += _Count;
+            _Mybuf._Set_size(_Old_size + _Count);
             return *this;
         }
 
@@ -991,58 +821,62 @@ namespace mjx {
         return *this;
     }
 
-    template <class _Elem>
-    string<_Elem>& string<_Elem>::insert(const size_type _Off, const string& _Str) {
-        return insert(_Off, _Str._Mybuf._Get(), _Str._Mybuf._Size);
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>& string<_Elem, _InlineBytes>::insert(const size_type _Off, const string& _Str) {
+        return insert(_Off, _Str._Mybuf._Get(), _Str._Mybuf._Get_size());
     }
 
-    template <class _Elem>
-    typename string<_Elem>::iterator string<_Elem>::insert(const const_iterator _Where, const value_type _Ch) {
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::iterator
+        string<_Elem, _InlineBytes>::insert(const const_iterator _Where, const value_type _Ch) {
         const size_type _Off = static_cast<size_type>(_Where._Myptr - _Mybuf._Get());
         insert(_Off, 1, _Ch);
         return begin() + static_cast<difference_type>(_Off);
     }
 
-    template <class _Elem>
-    string<_Elem>& string<_Elem>::insert(const size_type _Off, const string_view<_Elem> _Str) {
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>& string<_Elem, _InlineBytes>::insert(
+        const size_type _Off, const string_view<_Elem> _Str) {
         return insert(_Off, _Str.data(), _Str.size());
     }
 
-    template <class _Elem>
-    string<_Elem>& string<_Elem>::replace(const size_type _Off, size_type _Count, const string& _Str) {
-        return replace(_Off, _Count, _Str._Mybuf._Get(), _Str._Mybuf._Size);
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>& string<_Elem, _InlineBytes>::replace(
+        const size_type _Off, size_type _Count, const string& _Str) {
+        return replace(_Off, _Count, _Str._Mybuf._Get(), _Str._Mybuf._Get_size());
     }
 
-    template <class _Elem>
-    string<_Elem>& string<_Elem>::replace(
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>& string<_Elem, _InlineBytes>::replace(
         const const_iterator _First, const const_iterator _Last, const string& _Str) {
         return replace(static_cast<size_type>(_First._Myptr - _Mybuf._Get()),
-            static_cast<size_type>(_Last._Myptr - _First._Myptr), _Str._Mybuf._Get(), _Str._Mybuf._Size);
+            static_cast<size_type>(_Last._Myptr - _First._Myptr), _Str._Mybuf._Get(), _Str._Mybuf._Get_size());
     }
     
-    template <class _Elem>
-    string<_Elem>& string<_Elem>::replace(
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>& string<_Elem, _InlineBytes>::replace(
         const size_type _Off, size_type _Count, const_pointer _Ptr, const size_type _Ptr_count) {
         _Check_offset(_Off);
-        _Count = (::std::min)(_Count, _Mybuf._Size - _Off);
+        _Count = (::std::min)(_Count, _Mybuf._Get_size() - _Off);
         if (_Count >= _Ptr_count) { // size will either remain the same or become smaller
             const size_type _Reduction = _Count - _Ptr_count;
             pointer _Old_ptr           = _Mybuf._Get() + _Off;
             traits_type::copy(_Old_ptr, _Ptr, _Ptr_count);
             if (_Reduction > 0) { // become smaller
-                traits_type::move(_Old_ptr + _Ptr_count, _Old_ptr + _Count, _Mybuf._Size - _Off - _Count + 1);
-                _Mybuf._Size -= _Reduction;
+                traits_type::move(_Old_ptr + _Ptr_count, _Old_ptr + _Count, _Mybuf._Get_size() - _Off - _Count + 1);
+                _Mybuf._Set_size(_Mybuf._Get_size() - _Reduction);
             }
 
             return *this;
         }
 
         const size_type _Growth = _Ptr_count - _Count;
-        if (_Mybuf._Size + _Growth <= _Mybuf._Capacity) { // found enough space, don't reallocate memory
+        const size_type _Old_size = _Mybuf._Get_size();
+        if (_Old_size + _Growth <= _Mybuf._Get_capacity()) { // found enough space, don't reallocate memory
             pointer _Old_ptr = _Mybuf._Get() + _Off;
-            traits_type::move(_Old_ptr + _Ptr_count, _Old_ptr + _Count, _Mybuf._Size - _Off - _Count + 1);
+            traits_type::move(_Old_ptr + _Ptr_count, _Old_ptr + _Count, _Old_size - _Off - _Count + 1);
             traits_type::copy(_Old_ptr, _Ptr, _Ptr_count);
-            _Mybuf._Size += _Growth;
+            _Mybuf._Set_size(_Old_size + _Growth);
             return *this;
         }
 
@@ -1050,43 +884,44 @@ namespace mjx {
         return *this;
     }
 
-    template <class _Elem>
-    string<_Elem>& string<_Elem>::replace(
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>& string<_Elem, _InlineBytes>::replace(
         const const_iterator _First, const const_iterator _Last, const_pointer _Ptr, const size_type _Count) {
         return replace(static_cast<size_type>(_First._Myptr - _Mybuf._Get()),
             static_cast<size_type>(_Last._Myptr - _First._Myptr), _Ptr, _Count);
     }
 
-    template <class _Elem>
-    string<_Elem>& string<_Elem>::replace(
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>& string<_Elem, _InlineBytes>::replace(
         const const_iterator _First, const const_iterator _Last, const_pointer _Ptr) {
         return replace(static_cast<size_type>(_First._Myptr - _Mybuf._Get()),
             static_cast<size_type>(_Last._Myptr - _First._Myptr), _Ptr, traits_type::length(_Ptr));
     }
 
-    template <class _Elem>
-    string<_Elem>& string<_Elem>::replace(
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>& string<_Elem, _InlineBytes>::replace(
         const size_type _Off, size_type _Count, const size_type _Ch_count, const value_type _Ch) {
         _Check_offset(_Off);
-        _Count = (::std::min)(_Count, _Mybuf._Size);
+        _Count = (::std::min)(_Count, _Mybuf._Get_size());
         if (_Count >= _Ch_count) { // size will either remain the same or become smaller
             const size_type _Reduction = _Count - _Ch_count;
             pointer _Old_ptr           = _Mybuf._Get() + _Off;
             traits_type::assign(_Old_ptr, _Ch_count, _Ch);
             if (_Reduction > 0) { // become smaller
-                traits_type::move(_Old_ptr + _Ch_count, _Old_ptr + _Count, _Mybuf._Size - _Off - _Count + 1);
-                _Mybuf._Size -= _Reduction;
+                traits_type::move(_Old_ptr + _Ch_count, _Old_ptr + _Count, _Mybuf._Get_size() - _Off - _Count + 1);
+                _Mybuf._Set_size(_Mybuf._Get_size() - _Reduction);
             }
         
             return *this;
         }
 
         const size_type _Growth = _Ch_count - _Count;
-        if (_Mybuf._Size + _Growth <= _Mybuf._Capacity) { // found enough space, don't reallocate memory
+        const size_type _Old_size = _Mybuf._Get_size();
+        if (_Old_size + _Growth <= _Mybuf._Get_capacity()) { // found enough space, don't reallocate memory
             pointer _Old_ptr = _Mybuf._Get() + _Off;
-            traits_type::move(_Old_ptr + _Ch_count, _Old_ptr + _Count, _Mybuf._Size - _Off - _Count + 1);
+            traits_type::move(_Old_ptr + _Ch_count, _Old_ptr + _Count, _Old_size - _Off - _Count + 1);
             traits_type::assign(_Old_ptr, _Ch_count, _Ch);
-            _Mybuf._Size += _Growth;
+            _Mybuf._Set_size(_Old_size + _Growth);
             return *this;
         }
 
@@ -1094,155 +929,287 @@ namespace mjx {
         return *this;
     }
 
-    template <class _Elem>
-    string<_Elem>& string<_Elem>::replace(const size_type _Off, size_type _Count, const_pointer _Ptr) {
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>& string<_Elem, _InlineBytes>::replace(
+        const size_type _Off, size_type _Count, const_pointer _Ptr) {
         return replace(_Off, _Count, _Ptr, traits_type::length(_Ptr));
     }
 
-    template <class _Elem>
-    string<_Elem>& string<_Elem>::replace(
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>& string<_Elem, _InlineBytes>::replace(
         const const_iterator _First, const const_iterator _Last, const size_type _Count, const value_type _Ch) {
         return replace(static_cast<size_type>(_First._Myptr - _Mybuf._Get()),
             static_cast<size_type>(_Last._Myptr - _First._Myptr), _Count, _Ch);
     }
 
-    template <class _Elem>
-    string<_Elem>& string<_Elem>::replace(const size_type _Off, size_type _Count, const string_view<_Elem> _Str) {
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>& string<_Elem, _InlineBytes>::replace(
+        const size_type _Off, size_type _Count, const string_view<_Elem> _Str) {
         return replace(_Off, _Count, _Str.data(), _Str.size());
     }
 
-    template <class _Elem>
-    string<_Elem>& string<_Elem>::replace(
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes>& string<_Elem, _InlineBytes>::replace(
         const const_iterator _First, const const_iterator _Last, const string_view<_Elem> _Str) {
         return replace(static_cast<size_type>(_First._Myptr - _Mybuf._Get()),
             static_cast<size_type>(_Last._Myptr - _First._Myptr), _Str.data(), _Str.size());
     }
 
-    template <class _Elem>
-    typename string<_Elem>::size_type string<_Elem>::find(const string& _Str, const size_type _Off) const {
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::size_type
+        string<_Elem, _InlineBytes>::find(const string& _Str, const size_type _Off) const {
         return view().find(_Str.view(), _Off);
     }
 
-    template <class _Elem>
-    typename string<_Elem>::size_type string<_Elem>::find(
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::size_type string<_Elem, _InlineBytes>::find(
         const_pointer _Ptr, const size_type _Off, const size_type _Count) const noexcept {
         return view().find(_Ptr, _Off, _Count);
     }
 
-    template <class _Elem>
-    typename string<_Elem>::size_type
-        string<_Elem>::find(const value_type _Ch, const size_type _Off) const noexcept {
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::size_type
+        string<_Elem, _InlineBytes>::find(const value_type _Ch, const size_type _Off) const noexcept {
         return view().find(_Ch, _Off);
     }
 
-    template <class _Elem>
-    typename string<_Elem>::size_type
-        string<_Elem>::find(const string_view<_Elem> _Str, const size_type _Off) const noexcept {
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::size_type
+        string<_Elem, _InlineBytes>::find(const string_view<_Elem> _Str, const size_type _Off) const noexcept {
         return view().find(_Str, _Off);
     }
 
-    template <class _Elem>
-    typename string<_Elem>::size_type string<_Elem>::rfind(const string& _Str, const size_type _Off) const {
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::size_type
+        string<_Elem, _InlineBytes>::rfind(const string& _Str, const size_type _Off) const {
         return view().rfind(_Str.view(), _Off);
     }
 
-    template <class _Elem>
-    typename string<_Elem>::size_type string<_Elem>::rfind(
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::size_type string<_Elem, _InlineBytes>::rfind(
         const_pointer _Ptr, const size_type _Off, const size_type _Count) const noexcept {
         return view().rfind(_Ptr, _Off, _Count);
     }
 
-    template <class _Elem>
-    typename string<_Elem>::size_type
-        string<_Elem>::rfind(const_pointer _Ptr, const size_type _Off) const noexcept {
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::size_type
+        string<_Elem, _InlineBytes>::rfind(const_pointer _Ptr, const size_type _Off) const noexcept {
         return view().rfind(_Ptr, _Off);
     }
 
-    template <class _Elem>
-    typename string<_Elem>::size_type
-        string<_Elem>::rfind(const value_type _Ch, const size_type _Off) const noexcept {
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::size_type
+        string<_Elem, _InlineBytes>::rfind(const value_type _Ch, const size_type _Off) const noexcept {
         return view().rfind(_Ch, _Off);
     }
 
-    template <class _Elem>
-    typename string<_Elem>::size_type
-        string<_Elem>::rfind(const string_view<_Elem> _Str, const size_type _Off) const noexcept {
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::size_type
+        string<_Elem, _InlineBytes>::rfind(const string_view<_Elem> _Str, const size_type _Off) const noexcept {
         return view().rfind(_Str, _Off);
     }
 
-    template <class _Elem>
-    int string<_Elem>::compare(const string& _Str) const {
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::size_type
+        string<_Elem, _InlineBytes>::find_first_of(const string& _Str, const size_type _Off) const {
+        return view().find_first_of(_Str.view(), _Off);
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::size_type string<_Elem, _InlineBytes>::find_first_of(
+        const_pointer _Ptr, const size_type _Off, const size_type _Count) const noexcept {
+        return view().find_first_of(_Ptr, _Off, _Count);
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::size_type
+        string<_Elem, _InlineBytes>::find_first_of(const_pointer _Ptr, const size_type _Off) const noexcept {
+        return view().find_first_of(_Ptr, _Off);
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::size_type
+        string<_Elem, _InlineBytes>::find_first_of(const value_type _Ch, const size_type _Off) const noexcept {
+        return view().find_first_of(_Ch, _Off);
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::size_type
+        string<_Elem, _InlineBytes>::find_first_of(const string_view<_Elem> _Str, const size_type _Off) const noexcept {
+        return view().find_first_of(_Str, _Off);
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::size_type
+        string<_Elem, _InlineBytes>::find_last_of(const string& _Str, const size_type _Off) const {
+        return view().find_last_of(_Str.view(), _Off);
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::size_type string<_Elem, _InlineBytes>::find_last_of(
+        const_pointer _Ptr, const size_type _Off, const size_type _Count) const noexcept {
+        return view().find_last_of(_Ptr, _Off, _Count);
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::size_type
+        string<_Elem, _InlineBytes>::find_last_of(const_pointer _Ptr, const size_type _Off) const noexcept {
+        return view().find_last_of(_Ptr, _Off);
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::size_type
+        string<_Elem, _InlineBytes>::find_last_of(const value_type _Ch, const size_type _Off) const noexcept {
+        return view().find_last_of(_Ch, _Off);
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::size_type
+        string<_Elem, _InlineBytes>::find_last_of(const string_view<_Elem> _Str, const size_type _Off) const noexcept {
+        return view().find_last_of(_Str, _Off);
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::size_type
+        string<_Elem, _InlineBytes>::find_first_not_of(const string& _Str, const size_type _Off) const {
+        return view().find_first_not_of(_Str.view(), _Off);
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::size_type string<_Elem, _InlineBytes>::find_first_not_of(
+        const_pointer _Ptr, const size_type _Off, const size_type _Count) const noexcept {
+        return view().find_first_not_of(_Ptr, _Off, _Count);
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::size_type
+        string<_Elem, _InlineBytes>::find_first_not_of(const_pointer _Ptr, const size_type _Off) const noexcept {
+        return view().find_first_not_of(_Ptr, _Off);
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::size_type
+        string<_Elem, _InlineBytes>::find_first_not_of(const value_type _Ch, const size_type _Off) const noexcept {
+        return view().find_first_not_of(_Ch, _Off);
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::size_type string<_Elem, _InlineBytes>::find_first_not_of(
+        const string_view<_Elem> _Str, const size_type _Off) const noexcept {
+        return view().find_first_not_of(_Str, _Off);
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::size_type
+        string<_Elem, _InlineBytes>::find_last_not_of(const string& _Str, const size_type _Off) const {
+        return view().find_last_not_of(_Str.view(), _Off);
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::size_type string<_Elem, _InlineBytes>::find_last_not_of(
+        const_pointer _Ptr, const size_type _Off, const size_type _Count) const noexcept {
+        return view().find_last_not_of(_Ptr, _Off, _Count);
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::size_type
+        string<_Elem, _InlineBytes>::find_last_not_of(const_pointer _Ptr, const size_type _Off) const noexcept {
+        return view().find_last_not_of(_Ptr, _Off);
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::size_type
+        string<_Elem, _InlineBytes>::find_last_not_of(const value_type _Ch, const size_type _Off) const noexcept {
+        return view().find_last_not_of(_Ch, _Off);
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    typename string<_Elem, _InlineBytes>::size_type string<_Elem, _InlineBytes>::find_last_not_of(
+        const string_view<_Elem> _Str, const size_type _Off) const noexcept {
+        return view().find_last_not_of(_Str, _Off);
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    int string<_Elem, _InlineBytes>::compare(const string& _Str) const {
         return view().compare(_Str.view());
     }
 
-    template <class _Elem>
-    int string<_Elem>::compare(const_pointer _Ptr, const size_type _Count) const noexcept {
+    template <class _Elem, size_t _InlineBytes>
+    int string<_Elem, _InlineBytes>::compare(const_pointer _Ptr, const size_type _Count) const noexcept {
         return view().compare(_Ptr, _Count);
     }
 
-    template <class _Elem>
-    int string<_Elem>::compare(const_pointer _Ptr) const noexcept {
+    template <class _Elem, size_t _InlineBytes>
+    int string<_Elem, _InlineBytes>::compare(const_pointer _Ptr) const noexcept {
         return view().compare(_Ptr);
     }
 
-    template <class _Elem>
-    int string<_Elem>::compare(const string_view<_Elem> _Str) const noexcept {
+    template <class _Elem, size_t _InlineBytes>
+    int string<_Elem, _InlineBytes>::compare(const string_view<_Elem> _Str) const noexcept {
         return view().compare(_Str);
     }
 
-    template <class _Elem>
-    bool string<_Elem>::starts_with(const string_view<_Elem> _Str) const noexcept {
+    template <class _Elem, size_t _InlineBytes>
+    bool string<_Elem, _InlineBytes>::starts_with(const string_view<_Elem> _Str) const noexcept {
         return view().starts_with(_Str);
     }
 
-    template <class _Elem>
-    bool string<_Elem>::starts_with(const value_type _Ch) const noexcept {
+    template <class _Elem, size_t _InlineBytes>
+    bool string<_Elem, _InlineBytes>::starts_with(const value_type _Ch) const noexcept {
         return view().starts_with(_Ch);
     }
 
-    template <class _Elem>
-    bool string<_Elem>::starts_with(const_pointer _Ptr) const noexcept {
+    template <class _Elem, size_t _InlineBytes>
+    bool string<_Elem, _InlineBytes>::starts_with(const_pointer _Ptr) const noexcept {
         return view().starts_with(_Ptr);
     }
 
-    template <class _Elem>
-    bool string<_Elem>::ends_with(const string_view<_Elem> _Str) const noexcept {
+    template <class _Elem, size_t _InlineBytes>
+    bool string<_Elem, _InlineBytes>::ends_with(const string_view<_Elem> _Str) const noexcept {
         return view().ends_with(_Str);
     }
 
-    template <class _Elem>
-    bool string<_Elem>::ends_with(const value_type _Ch) const noexcept {
+    template <class _Elem, size_t _InlineBytes>
+    bool string<_Elem, _InlineBytes>::ends_with(const value_type _Ch) const noexcept {
         return view().ends_with(_Ch);
     }
 
-    template <class _Elem>
-    bool string<_Elem>::ends_with(const_pointer _Ptr) const noexcept {
+    template <class _Elem, size_t _InlineBytes>
+    bool string<_Elem, _InlineBytes>::ends_with(const_pointer _Ptr) const noexcept {
         return view().ends_with(_Ptr);
     }
 
-    template <class _Elem>
-    bool string<_Elem>::contains(const string_view<_Elem> _Str) const noexcept {
+    template <class _Elem, size_t _InlineBytes>
+    bool string<_Elem, _InlineBytes>::contains(const string_view<_Elem> _Str) const noexcept {
         return find(_Str) != npos;
     }
 
-    template <class _Elem>
-    bool string<_Elem>::contains(const value_type _Ch) const noexcept {
+    template <class _Elem, size_t _InlineBytes>
+    bool string<_Elem, _InlineBytes>::contains(const value_type _Ch) const noexcept {
         return find(_Ch) != npos;
     }
 
-    template <class _Elem>
-    bool string<_Elem>::contains(const_pointer _Ptr) const noexcept {
+    template <class _Elem, size_t _InlineBytes>
+    bool string<_Elem, _InlineBytes>::contains(const_pointer _Ptr) const noexcept {
         return find(string_view<_Elem>{_Ptr, traits_type::length(_Ptr)}) != npos;
     }
 
-    template <class _Elem>
-    string<_Elem> string<_Elem>::substr(const size_type _Off, size_type _Count) const {
+    template <class _Elem, size_t _InlineBytes>
+    string<_Elem, _InlineBytes> string<_Elem, _InlineBytes>::substr(const size_type _Off, size_type _Count) const {
         _Check_offset(_Off);
-        _Count = (::std::min)(_Count, _Mybuf._Size - _Off); // trim number of characters
+        _Count = (::std::min)(_Count, _Mybuf._Get_size() - _Off); // trim number of characters
         return string{_Mybuf._Get() + _Off, _Count};
     }
 
     template class _MJSTR_API string<byte_t>;
     template class _MJSTR_API string<char>;
     template class _MJSTR_API string<wchar_t>;
+
+    template class _MJSTR_API string<byte_t, 64>;
+    template class _MJSTR_API string<char, 64>;
+    template class _MJSTR_API string<wchar_t, 64>;
+
+    template class _MJSTR_API string<byte_t, 128>;
+    template class _MJSTR_API string<char, 128>;
+    template class _MJSTR_API string<wchar_t, 128>;
 } // namespace mjx
\ No newline at end of file
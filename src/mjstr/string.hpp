@@ -6,14 +6,27 @@
 #pragma once
 #ifndef _MJSTR_STRING_HPP_
 #define _MJSTR_STRING_HPP_
+#include <bit>
 #include <compare>
+#include <concepts>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <iterator>
+#include <mjmem/exception.hpp>
 #include <mjstr/api.hpp>
 #include <mjstr/char_traits.hpp>
+#include <mjstr/memory_resource.hpp>
 #include <mjstr/string_view.hpp>
+#include <type_traits>
+#include <utility>
 
 namespace mjx {
+    // Note: _InlineBytes is the size of the small buffer. It can't be smaller than the large buffer it overlaps
+    //       (pointer, size and capacity), smaller values select that minimum.
+    template <class _Elem, size_t _InlineBytes = 3 * sizeof(void*)>
+    class string;
+
     template <class _Elem>
     class _MJSTR_API string_const_iterator { // random access constant iterator for string<CharT, Traits>
     public:
@@ -23,55 +36,57 @@ namespace mjx {
         using reference         = const _Elem&;
         using iterator_category = ::std::random_access_iterator_tag;
 
-        string_const_iterator() noexcept;
+        _MJSTR_CONSTEXPR string_const_iterator() noexcept;
 #ifdef _DEBUG
-        string_const_iterator(pointer _First, pointer _Last) noexcept;
+        _MJSTR_CONSTEXPR string_const_iterator(pointer _First, pointer _Last) noexcept;
 #else // ^^^ _DEBUG ^^^ / vvv NDEBUG vvv
-        explicit string_const_iterator(pointer _Ptr) noexcept;
+        _MJSTR_CONSTEXPR explicit string_const_iterator(pointer _Ptr) noexcept;
 #endif // _DEBUG
 
         // returns the first character of the current substring
-        reference operator*() const noexcept;
+        _MJSTR_CONSTEXPR reference operator*() const noexcept;
 
         // returns the current substring
-        pointer operator->() const noexcept;
+        _MJSTR_CONSTEXPR pointer operator->() const noexcept;
 
         // returns the element at specified offset
-        reference operator[](const difference_type _Off) const noexcept;
+        _MJSTR_CONSTEXPR reference operator[](const difference_type _Off) const noexcept;
 
         // advances the iterator to the next element
-        string_const_iterator& operator++() noexcept;
+        _MJSTR_CONSTEXPR string_const_iterator& operator++() noexcept;
 
         // advances the iterator to the next element (performs post-incrementation)
-        string_const_iterator operator++(int) noexcept;
+        _MJSTR_CONSTEXPR string_const_iterator operator++(int) noexcept;
 
         // retreats the iterator to the previous element
-        string_const_iterator& operator--() noexcept;
+        _MJSTR_CONSTEXPR string_const_iterator& operator--() noexcept;
 
         // retreats the iterator to the previous element (performs post-decrementation)
-        string_const_iterator operator--(int) noexcept;
+        _MJSTR_CONSTEXPR string_const_iterator operator--(int) noexcept;
 
         // advances the iterator by _Off elements
-        string_const_iterator& operator+=(const difference_type _Off) noexcept;
+        _MJSTR_CONSTEXPR string_const_iterator& operator+=(const difference_type _Off) noexcept;
 
         // retreats the iterator by _Off elements
-        string_const_iterator& operator-=(const difference_type _Off) noexcept;
+        _MJSTR_CONSTEXPR string_const_iterator& operator-=(const difference_type _Off) noexcept;
 
         // returns a new iterator that is _Off elements ahead the current one
-        string_const_iterator operator+(const difference_type _Off) const noexcept;
+        _MJSTR_CONSTEXPR string_const_iterator operator+(const difference_type _Off) const noexcept;
 
         // returns a new iterator that is _Off elements behind the current one
-        string_const_iterator operator-(const difference_type _Off) const noexcept;
+        _MJSTR_CONSTEXPR string_const_iterator operator-(const difference_type _Off) const noexcept;
 
         // checks if two iterators are equal
-        bool operator==(const string_const_iterator& _Other) const noexcept;
+        _MJSTR_CONSTEXPR bool operator==(const string_const_iterator& _Other) const noexcept;
 
         // performs three-way comparison between two iterators
-        ::std::strong_ordering operator<=>(const string_const_iterator& _Other) const noexcept;
+        _MJSTR_CONSTEXPR ::std::strong_ordering operator<=>(const string_const_iterator& _Other) const noexcept;
 
     private:
-        template <class>
+        template <class, size_t>
         friend class string;
+        template <class, size_t>
+        friend class static_string;
 
         pointer _Myptr;
 #ifdef _DEBUG
@@ -97,52 +112,79 @@ namespace mjx {
         using reference         = _Elem&;
         using iterator_category = ::std::random_access_iterator_tag;
     
-        string_iterator() noexcept;
+        _MJSTR_CONSTEXPR string_iterator() noexcept;
 #ifdef _DEBUG
-        string_iterator(pointer _First, pointer _Last) noexcept;
+        _MJSTR_CONSTEXPR string_iterator(pointer _First, pointer _Last) noexcept;
 #else // ^^^ _DEBUG ^^^ / vvv NDEBUG vvv
-        explicit string_iterator(pointer _Ptr) noexcept;
+        _MJSTR_CONSTEXPR explicit string_iterator(pointer _Ptr) noexcept;
 #endif // _DEBUG
 
         // returns the first character of the current substring
-        reference operator*() const noexcept;
+        _MJSTR_CONSTEXPR reference operator*() const noexcept;
 
         // returns the current substring
-        pointer operator->() const noexcept;
+        _MJSTR_CONSTEXPR pointer operator->() const noexcept;
 
         // returns the element at specified offset
-        reference operator[](const difference_type _Off) const noexcept;
+        _MJSTR_CONSTEXPR reference operator[](const difference_type _Off) const noexcept;
 
         // advances the iterator to the next element
-        string_iterator& operator++() noexcept;
+        _MJSTR_CONSTEXPR string_iterator& operator++() noexcept;
 
         // advances the iterator to the next element (performs post-incrementation)
-        string_iterator operator++(int) noexcept;
+        _MJSTR_CONSTEXPR string_iterator operator++(int) noexcept;
 
         // retreats the iterator to the previous element
-        string_iterator& operator--() noexcept;
+        _MJSTR_CONSTEXPR string_iterator& operator--() noexcept;
 
         // retreats the iterator to the previous element (performs post-decrementation)
-        string_iterator operator--(int) noexcept;
+        _MJSTR_CONSTEXPR string_iterator operator--(int) noexcept;
 
         // advances the iterator by _Off elements
-        string_iterator& operator+=(const difference_type _Off) noexcept;
+        _MJSTR_CONSTEXPR string_iterator& operator+=(const difference_type _Off) noexcept;
 
         // retreats the iterator by _Off elements
-        string_iterator& operator-=(const difference_type _Off) noexcept;
+        _MJSTR_CONSTEXPR string_iterator& operator-=(const difference_type _Off) noexcept;
 
         // returns a new iterator that is _Off elements ahead the current one
-        string_iterator operator+(const difference_type _Off) const noexcept;
+        _MJSTR_CONSTEXPR string_iterator operator+(const difference_type _Off) const noexcept;
 
         // returns a new iterator that is _Off elements behind the current one
-        string_iterator operator-(const difference_type _Off) const noexcept;
+        _MJSTR_CONSTEXPR string_iterator operator-(const difference_type _Off) const noexcept;
     };
 
     using byte_string_iterator    = string_iterator<byte_t>;
     using utf8_string_iterator    = string_iterator<char>;
     using unicode_string_iterator = string_iterator<wchar_t>;
 
-    template <class _Elem>
+    struct string_growth_policy { // capacity growth policy for string<CharT, InlineBytes>
+        // the capacity grows geometrically by numerator / denominator, the factor must be greater than 1
+        uint32_t numerator   = 3;
+        uint32_t denominator = 2;
+
+        // checks whether the factor is greater than 1, a smaller one would make a loop of appends quadratic
+        constexpr bool is_geometric() const noexcept {
+            return denominator > 0 && numerator > denominator;
+        }
+
+        // returns the new capacity that can store at least _Required characters
+        constexpr size_t next_capacity(
+            const size_t _Old_capacity, const size_t _Required, const size_t _Max_capacity) const noexcept {
+            if (!is_geometric()) { // no geometric growth, use the exact capacity
+                return _Required;
+            }
+
+            if (_Old_capacity > _Max_capacity / numerator * denominator) {
+                // geometric growth would exceed the maximum capacity, cap the capacity instead
+                return _Required > _Max_capacity ? _Required : _Max_capacity;
+            }
+
+            const size_t _Geometric = _Old_capacity / denominator * numerator;
+            return _Geometric < _Required ? _Required : _Geometric;
+        }
+    };
+
+    template <class _Elem, size_t _InlineBytes>
     class _MJSTR_API string {
     public:
         static_assert(compatible_element<_Elem>, "invalid element type for string<CharT, Traits>");
@@ -171,6 +213,13 @@ namespace mjx {
         string(const_pointer _Ptr);
         string(const string_view<_Elem> _Str);
 
+        // Note: The resource must outlive the string. It's propagated by moves and swaps (together with
+        //       the memory allocated from it), but not by copies. nullptr selects the global allocator.
+        //       Any other resource is stored in front of the allocated characters instead of the string
+        //       itself, so such a string always allocates, at least _Capacity characters up front.
+        explicit string(memory_resource* const _Resource, const size_type _Capacity = 0);
+        string(const string_view<_Elem> _Str, memory_resource* const _Resource);
+
         string(::std::nullptr_t)            = delete;
         string& operator=(::std::nullptr_t) = delete;
 
@@ -232,6 +281,18 @@ namespace mjx {
 
         // returns the maximum number of characters
         static size_type max_size() noexcept;
+
+        // returns the resource used to allocate memory
+        memory_resource* get_memory_resource() const noexcept;
+
+        // returns the capacity growth policy of all strings of this type
+        static string_growth_policy growth_policy() noexcept;
+
+        // Note: The string algorithms are compiled into the library, so the policy can't be a template
+        //       argument. It's shared by all strings of this type (every element type and inline size has its own)
+        //       and read whenever a string grows, so it can be changed while other threads use such strings.
+        //       A policy that doesn't grow geometrically is rejected, false is returned and nothing changes.
+        static bool set_growth_policy(const string_growth_policy _Policy) noexcept;
         
         // returns the string as a view
         string_view<_Elem> view() const noexcept;
@@ -251,6 +312,21 @@ namespace mjx {
         // changes the number of characters stored
         void resize(const size_type _New_size, const value_type _Ch = value_type{});
 
+        // changes the number of characters stored, new characters are left uninitialized
+        void resize_uninitialized(const size_type _New_size);
+
+        // Note: _Op(data(), _Count) writes the characters directly into the string and returns their number,
+        //       which can't exceed _Count. Characters past the old size are uninitialized when _Op is called.
+        template <class _Operation>
+        void resize_and_overwrite(const size_type _Count, _Operation _Op);
+
+        // Note: Returns a pointer to space for _Count characters after the end. They become a part of the string
+        //       once they're written and committed with commit(), until then the string isn't null-terminated.
+        pointer append_uninitialized(const size_type _Count);
+
+        // appends _Count characters written after the end, see append_uninitialized()
+        void commit(const size_type _Count);
+
         // increases the number of characters stored
         void expand(const size_type _Count, const value_type _Ch = value_type{});
 
@@ -321,6 +397,34 @@ namespace mjx {
         size_type rfind(const value_type _Ch, const size_type _Off = npos) const noexcept;
         size_type rfind(const string_view<_Elem> _Str, const size_type _Off = npos) const noexcept;
 
+        // finds the first character equal to one of the given characters
+        size_type find_first_of(const string& _Str, const size_type _Off = 0) const;
+        size_type find_first_of(const_pointer _Ptr, const size_type _Off, const size_type _Count) const noexcept;
+        size_type find_first_of(const_pointer _Ptr, const size_type _Off = 0) const noexcept;
+        size_type find_first_of(const value_type _Ch, const size_type _Off = 0) const noexcept;
+        size_type find_first_of(const string_view<_Elem> _Str, const size_type _Off = 0) const noexcept;
+
+        // finds the last character equal to one of the given characters
+        size_type find_last_of(const string& _Str, const size_type _Off = npos) const;
+        size_type find_last_of(const_pointer _Ptr, const size_type _Off, const size_type _Count) const noexcept;
+        size_type find_last_of(const_pointer _Ptr, const size_type _Off = npos) const noexcept;
+        size_type find_last_of(const value_type _Ch, const size_type _Off = npos) const noexcept;
+        size_type find_last_of(const string_view<_Elem> _Str, const size_type _Off = npos) const noexcept;
+
+        // finds the first character equal to none of the given characters
+        size_type find_first_not_of(const string& _Str, const size_type _Off = 0) const;
+        size_type find_first_not_of(const_pointer _Ptr, const size_type _Off, const size_type _Count) const noexcept;
+        size_type find_first_not_of(const_pointer _Ptr, const size_type _Off = 0) const noexcept;
+        size_type find_first_not_of(const value_type _Ch, const size_type _Off = 0) const noexcept;
+        size_type find_first_not_of(const string_view<_Elem> _Str, const size_type _Off = 0) const noexcept;
+
+        // finds the last character equal to none of the given characters
+        size_type find_last_not_of(const string& _Str, const size_type _Off = npos) const;
+        size_type find_last_not_of(const_pointer _Ptr, const size_type _Off, const size_type _Count) const noexcept;
+        size_type find_last_not_of(const_pointer _Ptr, const size_type _Off = npos) const noexcept;
+        size_type find_last_not_of(const value_type _Ch, const size_type _Off = npos) const noexcept;
+        size_type find_last_not_of(const string_view<_Elem> _Str, const size_type _Off = npos) const noexcept;
+
         // compares two strings
         int compare(const string& _Str) const;
         int compare(const_pointer _Ptr, const size_type _Count) const noexcept;
@@ -347,7 +451,11 @@ namespace mjx {
 
     private:
         // allocates memory for the string capacity
-        static pointer _Allocate_space_for_capacity(size_type& _Count);
+        pointer _Allocate_space_for_capacity(size_type& _Count) const;
+        static pointer _Allocate_space_for_capacity(size_type& _Count, memory_resource* const _Resource);
+
+        // calculates the new capacity for at least _Required characters according to the growth policy
+        size_type _Calculate_growth(const size_type _Required) const noexcept;
 
         // destroys the string
         void _Tidy() noexcept;
@@ -361,6 +469,9 @@ namespace mjx {
         // steals the contents of another string
         void _Take_contents(string& _Other) noexcept;
 
+        // sets the size after resize_and_overwrite() wrote _New_size out of _Count characters
+        void _Finish_overwrite(const size_type _Count, const size_type _New_size);
+
         // constructs the string from a pointer
         void _Construct_from_ptr(const_pointer _Ptr, const size_type _Count);
 
@@ -388,8 +499,33 @@ namespace mjx {
         static constexpr size_type _Alloc_align = (2 * sizeof(void*)) / sizeof(value_type);
         static constexpr size_type _Alloc_mask  = _Alloc_align - 1;
 
-        static constexpr size_type _Small_buffer_size     = 16 / sizeof(value_type);
+        struct _Large_buffer {
+            pointer _Ptr;
+            size_type _Size; // number of characters currently stored in the string
+            size_type _Capacity; // number of characters that can be stored, the two highest bits are flags
+        };
+
+        // Note: The small buffer overlaps the whole large buffer. Its last element stores the number of unused
+        //       characters, so it becomes the null-terminator once the small buffer is full. The highest bit
+        //       of that element marks the large buffer. If both buffers have the same size, that element
+        //       holds the highest byte of _Large_buffer::_Capacity on little-endian targets, so setting
+        //       the highest capacity bit is enough to tell both buffers apart.
+        static_assert(::std::endian::native == ::std::endian::little, "the string layout requires little-endian");
+
+        static constexpr size_type _Small_buffer_size =
+            (_InlineBytes > sizeof(_Large_buffer) ? _InlineBytes : sizeof(_Large_buffer)) / sizeof(value_type);
         static constexpr size_type _Small_buffer_capacity = _Small_buffer_size - 1;
+        static constexpr size_type _Large_flag            = ~(static_cast<size_type>(-1) >> 1);
+        static constexpr size_type _Resource_flag         = _Large_flag >> 1; // the resource is stored
+        static constexpr size_type _Capacity_mask         = ~(_Large_flag | _Resource_flag);
+        static constexpr size_type _Large_marker          = size_type{1} << (sizeof(value_type) * 8 - 1);
+
+        // Note: A string that uses a resource other than the global one always uses the large buffer.
+        //       The resource is stored in a header in front of the characters, so it doesn't take any space
+        //       in the string itself. The header keeps the characters aligned to memory_resource::alignment.
+        static constexpr size_t _Resource_header_size = memory_resource::alignment;
+
+        static_assert(_Small_buffer_capacity < _Large_marker, "too many inline bytes to encode the small size");
 
         struct _Internal_buffer { // stores small or large buffer
             _Internal_buffer() noexcept;
@@ -402,6 +538,29 @@ namespace mjx {
             pointer _Get() noexcept;
             const_pointer _Get() const noexcept;
 
+            // returns the number of stored characters
+            size_type _Get_size() const noexcept;
+
+            // returns the number of characters that can be stored without reallocating memory
+            size_type _Get_capacity() const noexcept;
+
+            // changes the number of stored characters, doesn't write the null-terminator
+            void _Set_size(const size_type _New_size) noexcept;
+
+            // switches to an empty small buffer, doesn't deallocate the large one
+            void _Reset() noexcept;
+
+            // checks whether the large buffer is allocated from a stored resource
+            bool _Has_resource() const noexcept;
+
+            // returns the stored resource, nullptr if the global allocator is used
+            memory_resource* _Get_resource() const noexcept;
+
+            // switches to the specified large buffer, doesn't deallocate the previous one
+            void _Set_large(const pointer _Ptr, const size_type _Capacity, const size_type _Size) noexcept;
+            void _Set_large(const pointer _Ptr, const size_type _Capacity, const size_type _Size,
+                const bool _Resource) noexcept;
+
             // switchs from large to small buffer
             void _Switch_to_small() noexcept;
 
@@ -411,11 +570,15 @@ namespace mjx {
             // deallocates large buffer
             void _Deallocate_if_large() noexcept;
 
-            size_type _Capacity; // number of characters that can be stored without reallocating memory
-            size_type _Size; // number of characters currently stored in the string
+            // allocates _Count elements from _Resource (the global allocator if nullptr)
+            static pointer _Allocate(memory_resource* const _Resource, const size_type _Count);
+
+            // deallocates the specified large buffer
+            static void _Deallocate(const _Large_buffer& _Buf) noexcept;
+
             union {
+                _Large_buffer _Large;
                 value_type _Small[_Small_buffer_size];
-                pointer _Large;
             };
         };
 
@@ -423,142 +586,272 @@ namespace mjx {
         _Internal_buffer _Mybuf;
     };
 
+    template <class _Elem, size_t _InlineBytes>
+    template <class _Operation>
+    inline void string<_Elem, _InlineBytes>::resize_and_overwrite(const size_type _Count, _Operation _Op) {
+        resize_uninitialized(_Count); // may throw
+        const size_type _New_size = static_cast<size_type>(::std::move(_Op)(data(), _Count));
+        _Finish_overwrite(_Count, _New_size);
+    }
+
     using byte_string    = string<byte_t>;
     using utf8_string    = string<char>;
     using unicode_string = string<wchar_t>;
 
-    template <class _Elem>
-    inline bool operator==(const string<_Elem>& _Left, const string<_Elem>& _Right) {
+    // the default strings are as large as three pointers, 3 * sizeof(void*) - 1 bytes are stored inline
+    static_assert(sizeof(byte_string) == 3 * sizeof(void*), "byte_string must be as large as three pointers");
+    static_assert(sizeof(utf8_string) == 3 * sizeof(void*), "utf8_string must be as large as three pointers");
+    static_assert(sizeof(unicode_string) == 3 * sizeof(void*), "unicode_string must be as large as three pointers");
+
+    // Note: The string algorithms are compiled into the library, so only the default size and
+    //       small strings with 64 and 128 inline bytes are available.
+    template <class _Elem, size_t _InlineBytes>
+    using basic_small_string = string<_Elem, _InlineBytes>;
+
+    template <size_t _InlineBytes>
+    using small_byte_string = basic_small_string<byte_t, _InlineBytes>;
+    template <size_t _InlineBytes>
+    using small_utf8_string = basic_small_string<char, _InlineBytes>;
+    template <size_t _InlineBytes>
+    using small_unicode_string = basic_small_string<wchar_t, _InlineBytes>;
+
+    template <class _Elem, size_t _InlineBytes>
+    inline bool operator==(const string<_Elem, _InlineBytes>& _Left, const string<_Elem, _InlineBytes>& _Right) {
         return _Left.compare(_Right) == 0;
     }
 
-    template <class _Elem>
-    inline bool operator==(const string<_Elem>& _Left, const string_view<_Elem> _Right) {
+    template <class _Elem, size_t _InlineBytes>
+    inline bool operator==(const string<_Elem, _InlineBytes>& _Left, const string_view<_Elem> _Right) {
         return _Left.compare(_Right) == 0;
     }
 
-    template <class _Elem>
-    inline bool operator==(const string<_Elem>& _Left, const _Elem* const _Right) {
+    template <class _Elem, size_t _InlineBytes>
+    inline bool operator==(const string<_Elem, _InlineBytes>& _Left, const _Elem* const _Right) {
         return _Left.compare(_Right) == 0;
     }
 
-    template <class _Elem>
-    inline ::std::strong_ordering operator<=>(const string<_Elem>& _Left, const string<_Elem>& _Right) {
+    template <class _Elem, size_t _InlineBytes>
+    inline ::std::strong_ordering operator<=>(
+        const string<_Elem, _InlineBytes>& _Left, const string<_Elem, _InlineBytes>& _Right) {
         return _Left.compare(_Right) <=> 0;
     }
 
-    template <class _Elem>
-    inline ::std::strong_ordering operator<=>(const string<_Elem>& _Left, const string_view<_Elem> _Right) {
+    template <class _Elem, size_t _InlineBytes>
+    inline ::std::strong_ordering operator<=>(
+        const string<_Elem, _InlineBytes>& _Left, const string_view<_Elem> _Right) {
         return _Left.compare(_Right) <=> 0;
     }
 
-    template <class _Elem>
-    inline ::std::strong_ordering operator<=>(const string<_Elem>& _Left, const _Elem* const _Right) {
+    template <class _Elem, size_t _InlineBytes>
+    inline ::std::strong_ordering operator<=>(const string<_Elem, _InlineBytes>& _Left, const _Elem* const _Right) {
         return _Left.compare(_Right) <=> 0;
     }
 
-    template <class _Elem>
-    inline string<_Elem> operator+(const string<_Elem>& _Left, const string<_Elem>& _Right) {
-        string<_Elem> _Str(_Left);
-        _Str.append(_Right);
-        return ::std::move(_Str);
+    namespace mjstr_impl {
+        template <class _Elem>
+        inline bool _Overlaps(const string_view<_Elem> _Str, const _Elem* const _First, const size_t _Count) noexcept {
+            // checks whether _Str views any of the _Count characters starting at _First
+            const ::std::less<const _Elem*> _Less;
+            return _Less(_Str.data(), _First + _Count) && _Less(_First, _Str.data() + _Str.size());
+        }
+
+        template <class _Elem, size_t _InlineBytes>
+        inline string<_Elem, _InlineBytes> _Concat(const string_view<_Elem> _Left, const string_view<_Elem> _Right) {
+            string<_Elem, _InlineBytes> _Str;
+            _Str.reserve(_Left.size() + _Right.size()); // the only allocation, may throw
+            _Str.append(_Left);
+            _Str.append(_Right);
+            return _Str;
+        }
+
+        template <class _Elem, size_t _InlineBytes>
+        inline string<_Elem, _InlineBytes> _Concat(
+            const string_view<_Elem> _Left, string<_Elem, _InlineBytes>&& _Right) {
+            // reuse the buffer of _Right if it's large enough, otherwise allocate once
+            if (_Right.capacity() - _Right.size() >= _Left.size()
+                && !_Overlaps(_Left, _Right.data(), _Right.size())) {
+                _Right.insert(0, _Left);
+                return ::std::move(_Right);
+            }
+
+            return _Concat<_Elem, _InlineBytes>(_Left, _Right.view());
+        }
+    } // namespace mjstr_impl
+
+    // Note: operator+ computes the total length and allocates the result once. An rvalue string operand
+    //       gives its buffer to the result, if it's large enough. A chain like a + b + c appends to the
+    //       intermediate result, which may grow again, use concat() to allocate the whole chain once.
+    template <class _Elem, size_t _InlineBytes>
+    inline string<_Elem, _InlineBytes> operator+(
+        const string<_Elem, _InlineBytes>& _Left, const string<_Elem, _InlineBytes>& _Right) {
+        return mjstr_impl::_Concat<_Elem, _InlineBytes>(_Left.view(), _Right.view());
     }
 
-    template <class _Elem>
-    inline string<_Elem> operator+(const string<_Elem>& _Left, const _Elem* const _Right) {
-        string<_Elem> _Str(_Left);
-        _Str.append(_Right);
-        return ::std::move(_Str);
+    template <class _Elem, size_t _InlineBytes>
+    inline string<_Elem, _InlineBytes> operator+(const string<_Elem, _InlineBytes>& _Left, const _Elem* const _Right) {
+        return mjstr_impl::_Concat<_Elem, _InlineBytes>(_Left.view(), string_view<_Elem>{_Right});
     }
 
-    template <class _Elem>
-    inline string<_Elem> operator+(const string<_Elem>& _Left, const _Elem _Right) {
-        string<_Elem> _Str(_Left);
-        _Str.push_back(_Right);
-        return ::std::move(_Str);
+    template <class _Elem, size_t _InlineBytes>
+    inline string<_Elem, _InlineBytes> operator+(const string<_Elem, _InlineBytes>& _Left, const _Elem _Right) {
+        return mjstr_impl::_Concat<_Elem, _InlineBytes>(_Left.view(), string_view<_Elem>{&_Right, 1});
     }
 
-    template <class _Elem>
-    inline string<_Elem> operator+(const string<_Elem>& _Left, const string_view<_Elem> _Right) {
-        string<_Elem> _Str(_Left);
-        _Str.append(_Right);
-        return ::std::move(_Str);
+    template <class _Elem, size_t _InlineBytes>
+    inline string<_Elem, _InlineBytes> operator+(
+        const string<_Elem, _InlineBytes>& _Left, const string_view<_Elem> _Right) {
+        return mjstr_impl::_Concat<_Elem, _InlineBytes>(_Left.view(), _Right);
     }
 
-    template <class _Elem>
-    inline string<_Elem> operator+(const _Elem* const _Left, const string<_Elem>& _Right) {
-        string<_Elem> _Str(_Right);
-        _Str.append(_Left);
-        return ::std::move(_Str);
+    template <class _Elem, size_t _InlineBytes>
+    inline string<_Elem, _InlineBytes> operator+(const _Elem* const _Left, const string<_Elem, _InlineBytes>& _Right) {
+        return mjstr_impl::_Concat<_Elem, _InlineBytes>(string_view<_Elem>{_Left}, _Right.view());
     }
 
-    template <class _Elem>
-    inline string<_Elem> operator+(const _Elem _Left, const string<_Elem>& _Right) {
-        string<_Elem> _Str(_Right);
-        _Str.insert(0, 1, _Left);
-        return ::std::move(_Str);
+    template <class _Elem, size_t _InlineBytes>
+    inline string<_Elem, _InlineBytes> operator+(const _Elem _Left, const string<_Elem, _InlineBytes>& _Right) {
+        return mjstr_impl::_Concat<_Elem, _InlineBytes>(string_view<_Elem>{&_Left, 1}, _Right.view());
     }
 
-    template <class _Elem>
-    inline string<_Elem> operator+(const string_view<_Elem> _Left, const string<_Elem>& _Right) {
-        string<_Elem> _Str(_Left);
-        _Str.append(_Right);
-        return ::std::move(_Str);
+    template <class _Elem, size_t _InlineBytes>
+    inline string<_Elem, _InlineBytes> operator+(
+        const string_view<_Elem> _Left, const string<_Elem, _InlineBytes>& _Right) {
+        return mjstr_impl::_Concat<_Elem, _InlineBytes>(_Left, _Right.view());
     }
 
     template <class _Elem>
-    inline string<_Elem> operator+(string<_Elem>&& _Left, string<_Elem>&& _Right) {
-        _Left.append(::std::move(_Right));
+    inline string<_Elem> operator+(const string_view<_Elem> _Left, const string_view<_Elem> _Right) {
+        return mjstr_impl::_Concat<_Elem, 3 * sizeof(void*)>(_Left, _Right);
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    inline string<_Elem, _InlineBytes> operator+(
+        string<_Elem, _InlineBytes>&& _Left, string<_Elem, _InlineBytes>&& _Right) {
+        _Left.append(_Right);
         return ::std::move(_Left);
     }
 
-    template <class _Elem>
-    inline string<_Elem> operator+(string<_Elem>&& _Left, const string<_Elem>& _Right) {
+    template <class _Elem, size_t _InlineBytes>
+    inline string<_Elem, _InlineBytes> operator+(
+        string<_Elem, _InlineBytes>&& _Left, const string<_Elem, _InlineBytes>& _Right) {
         _Left.append(_Right);
         return ::std::move(_Left);
     }
 
-    template <class _Elem>
-    inline string<_Elem> operator+(string<_Elem>&& _Left, const _Elem* const _Right) {
+    template <class _Elem, size_t _InlineBytes>
+    inline string<_Elem, _InlineBytes> operator+(string<_Elem, _InlineBytes>&& _Left, const _Elem* const _Right) {
         _Left.append(_Right);
         return ::std::move(_Left);
     }
 
-    template <class _Elem>
-    inline string<_Elem> operator+(string<_Elem>&& _Left, const _Elem _Right) {
+    template <class _Elem, size_t _InlineBytes>
+    inline string<_Elem, _InlineBytes> operator+(string<_Elem, _InlineBytes>&& _Left, const _Elem _Right) {
         _Left.push_back(_Right);
         return ::std::move(_Left);
     }
 
-    template <class _Elem>
-    inline string<_Elem> operator+(string<_Elem>&& _Left, const string_view<_Elem> _Right) {
+    template <class _Elem, size_t _InlineBytes>
+    inline string<_Elem, _InlineBytes> operator+(string<_Elem, _InlineBytes>&& _Left, const string_view<_Elem> _Right) {
         _Left.append(_Right);
         return ::std::move(_Left);
     }
 
-    template <class _Elem>
-    inline string<_Elem> operator+(const string<_Elem>& _Left, string<_Elem>&& _Right) {
-        _Right.append(_Left);
-        return ::std::move(_Right);
+    template <class _Elem, size_t _InlineBytes>
+    inline string<_Elem, _InlineBytes> operator+(
+        const string<_Elem, _InlineBytes>& _Left, string<_Elem, _InlineBytes>&& _Right) {
+        return mjstr_impl::_Concat(_Left.view(), ::std::move(_Right));
     }
 
-    template <class _Elem>
-    inline string<_Elem> operator+(const _Elem* const _Left, string<_Elem>&& _Right) {
-        _Right.append(_Left);
-        return ::std::move(_Right);
+    template <class _Elem, size_t _InlineBytes>
+    inline string<_Elem, _InlineBytes> operator+(const _Elem* const _Left, string<_Elem, _InlineBytes>&& _Right) {
+        return mjstr_impl::_Concat(string_view<_Elem>{_Left}, ::std::move(_Right));
     }
 
-    template <class _Elem>
-    inline string<_Elem> operator+(const _Elem _Left, string<_Elem>&& _Right) {
-        _Right.push_back(_Left);
-        return ::std::move(_Right);
+    template <class _Elem, size_t _InlineBytes>
+    inline string<_Elem, _InlineBytes> operator+(const _Elem _Left, string<_Elem, _InlineBytes>&& _Right) {
+        return mjstr_impl::_Concat(string_view<_Elem>{&_Left, 1}, ::std::move(_Right));
     }
 
-    template <class _Elem>
-    inline string<_Elem> operator+(const string_view<_Elem> _Left, string<_Elem>&& _Right) {
-        _Right.append(_Left);
-        return ::std::move(_Right);
+    template <class _Elem, size_t _InlineBytes>
+    inline string<_Elem, _InlineBytes> operator+(const string_view<_Elem> _Left, string<_Elem, _InlineBytes>&& _Right) {
+        return mjstr_impl::_Concat(_Left, ::std::move(_Right));
+    }
+
+    namespace mjstr_impl {
+        template <class _Ty>
+        struct _Concat_elem {}; // the element type of a concat() operand
+
+        template <class _Elem, size_t _InlineBytes>
+        struct _Concat_elem<string<_Elem, _InlineBytes>> {
+            using type = _Elem;
+        };
+
+        template <class _Elem>
+        struct _Concat_elem<string_view<_Elem>> {
+            using type = _Elem;
+        };
+
+        template <class _Elem>
+        struct _Concat_elem<const _Elem*> {
+            using type = _Elem;
+        };
+
+        template <class _Elem>
+        struct _Concat_elem<_Elem*> {
+            using type = _Elem;
+        };
+
+        template <compatible_element _Elem>
+        struct _Concat_elem<_Elem> {
+            using type = _Elem;
+        };
+
+        template <class _Ty>
+        using _Concat_elem_t = typename _Concat_elem<::std::decay_t<_Ty>>::type;
+
+        template <class _Ty, class _Elem>
+        concept _Concat_operand = ::std::same_as<::std::remove_cvref_t<_Ty>, _Elem>
+                               || ::std::convertible_to<const _Ty&, string_view<_Elem>>;
+
+        template <class _Elem, class _Ty>
+        inline string_view<_Elem> _Concat_view(const _Ty& _Arg) noexcept {
+            if constexpr (::std::is_same_v<_Ty, _Elem>) { // single character
+                return string_view<_Elem>{&_Arg, 1};
+            } else {
+                return string_view<_Elem>{_Arg};
+            }
+        }
+    } // namespace mjstr_impl
+
+    // returns the concatenation of all operands (strings, views, C-strings or characters), the element type
+    // is taken from the first one, the result is allocated once
+    template <class _First, class... _Rest>
+        requires (mjstr_impl::_Concat_operand<_First, mjstr_impl::_Concat_elem_t<_First>>
+                  && (mjstr_impl::_Concat_operand<_Rest, mjstr_impl::_Concat_elem_t<_First>> && ...))
+    inline string<mjstr_impl::_Concat_elem_t<_First>> concat(const _First& _Arg, const _Rest&... _Args) {
+        using _Elem                       = mjstr_impl::_Concat_elem_t<_First>;
+        const string_view<_Elem> _Views[] = {
+            mjstr_impl::_Concat_view<_Elem>(_Arg), mjstr_impl::_Concat_view<_Elem>(_Args)...};
+        size_t _Total = 0;
+        for (const string_view<_Elem> _View : _Views) {
+            if (_View.size() > static_cast<size_t>(-1) - _Total) { // requested too much memory, break
+                allocation_limit_exceeded::raise();
+            }
+
+            _Total += _View.size();
+        }
+
+        string<_Elem> _Result;
+        _Result.reserve(_Total); // the only allocation, may throw
+        for (const string_view<_Elem> _View : _Views) {
+            _Result.append(_View);
+        }
+
+        return _Result;
     }
 } // namespace mjx
 
+#ifdef _MJSTR_INLINE_ACCESSORS
+#include <mjstr/impl/string_inline.hpp>
+#endif // _MJSTR_INLINE_ACCESSORS
 #endif // _MJSTR_STRING_HPP_
\ No newline at end of file
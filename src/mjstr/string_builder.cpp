@@ -0,0 +1,250 @@
+// string_builder.cpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <mjmem/exception.hpp>
+#include <mjstr/string_builder.hpp>
+#include <utility>
+
+namespace mjx {
+    template <class _Elem>
+    string_builder<_Elem>::string_builder() noexcept : string_builder(nullptr) {}
+
+    template <class _Elem>
+    string_builder<_Elem>::string_builder(memory_resource* const _Resource) noexcept
+        : _Myresource(_Resource ? _Resource : global_memory_resource()), _Myfirst(nullptr), _Mylast(nullptr),
+          _Mynext(nullptr), _Myend(nullptr), _Mysealed(0), _Mycount(0) {}
+
+    template <class _Elem>
+    string_builder<_Elem>::string_builder(string_builder&& _Other) noexcept
+        : _Myresource(_Other._Myresource), _Myfirst(_Other._Myfirst), _Mylast(_Other._Mylast),
+          _Mynext(_Other._Mynext), _Myend(_Other._Myend), _Mysealed(_Other._Mysealed), _Mycount(_Other._Mycount) {
+        _Other._Myfirst  = nullptr;
+        _Other._Mylast   = nullptr;
+        _Other._Mynext   = nullptr;
+        _Other._Myend    = nullptr;
+        _Other._Mysealed = 0;
+        _Other._Mycount  = 0;
+    }
+
+    template <class _Elem>
+    string_builder<_Elem>::~string_builder() noexcept {
+        clear();
+    }
+
+    template <class _Elem>
+    string_builder<_Elem>& string_builder<_Elem>::operator=(string_builder&& _Other) noexcept {
+        if (this != ::std::addressof(_Other)) {
+            clear();
+            swap(_Other);
+        }
+
+        return *this;
+    }
+
+    template <class _Elem>
+    typename string_builder<_Elem>::pointer string_builder<_Elem>::_Chunk_data(_Chunk* const _Target) noexcept {
+        return reinterpret_cast<pointer>(reinterpret_cast<byte_t*>(_Target) + _Header_size);
+    }
+
+    template <class _Elem>
+    typename string_builder<_Elem>::const_pointer
+        string_builder<_Elem>::_Chunk_data(const _Chunk* const _Target) noexcept {
+        return reinterpret_cast<const_pointer>(reinterpret_cast<const byte_t*>(_Target) + _Header_size);
+    }
+
+    template <class _Elem>
+    typename string_builder<_Elem>::size_type
+        string_builder<_Elem>::_Chunk_size(const _Chunk* const _Target) const noexcept {
+        return _Target == _Mylast ? static_cast<size_type>(_Mynext - _Chunk_data(_Target)) : _Target->_Size;
+    }
+
+    template <class _Elem>
+    typename string_builder<_Elem>::_Chunk*
+        string_builder<_Elem>::_Allocate_chunk(const size_type _Required) const {
+        // Note: Every chunk is twice as large as the previous one (up to max_chunk_capacity), so the number
+        //       of chunks grows logarithmically. A larger request gets a chunk that fits it entirely.
+        constexpr size_type _Max_capacity = (static_cast<size_type>(-1) - _Header_size) / sizeof(_Elem);
+        if (_Required > _Max_capacity) { // requested too much memory, break
+            allocation_limit_exceeded::raise();
+        }
+
+        size_type _Capacity = _Mylast ? (::std::min)(_Mylast->_Capacity * 2, max_chunk_capacity) : min_chunk_capacity;
+        if (_Capacity < _Required) {
+            _Capacity = _Required;
+        }
+
+        const size_type _Bytes = _Header_size + _Capacity * sizeof(_Elem);
+        _Chunk* const _New     = static_cast<_Chunk*>(_Myresource->allocate(_Bytes)); // may throw
+        _New->_Next            = nullptr;
+        _New->_Size            = 0;
+        _New->_Capacity        = _Capacity;
+        return _New;
+    }
+
+    template <class _Elem>
+    void string_builder<_Elem>::_Push_chunk(_Chunk* const _New_chunk) noexcept {
+        if (_Mylast) { // seal the last chunk, its size won't change anymore
+            _Mylast->_Size = static_cast<size_type>(_Mynext - _Chunk_data(_Mylast));
+            _Mysealed     += _Mylast->_Size;
+            _Mylast->_Next = _New_chunk;
+        } else {
+            _Myfirst = _New_chunk;
+        }
+
+        _Mylast  = _New_chunk;
+        _Mynext  = _Chunk_data(_New_chunk);
+        _Myend   = _Mynext + _New_chunk->_Capacity;
+        ++_Mycount;
+    }
+
+    template <class _Elem>
+    bool string_builder<_Elem>::empty() const noexcept {
+        return size() == 0;
+    }
+
+    template <class _Elem>
+    typename string_builder<_Elem>::size_type string_builder<_Elem>::size() const noexcept {
+        return _Mylast ? _Mysealed + static_cast<size_type>(_Mynext - _Chunk_data(_Mylast)) : 0;
+    }
+
+    template <class _Elem>
+    typename string_builder<_Elem>::size_type string_builder<_Elem>::chunk_count() const noexcept {
+        return _Mycount;
+    }
+
+    template <class _Elem>
+    memory_resource* string_builder<_Elem>::get_memory_resource() const noexcept {
+        return _Myresource;
+    }
+
+    template <class _Elem>
+    string_builder<_Elem>& string_builder<_Elem>::append(const_pointer _Ptr, const size_type _Count) {
+        const size_type _Free = static_cast<size_type>(_Myend - _Mynext);
+        if (_Count <= _Free) { // found enough space, don't allocate a new chunk
+            if (_Count != 0) { // _Mynext is null until the first chunk is allocated
+                traits_type::copy(_Mynext, _Ptr, _Count);
+                _Mynext += _Count;
+            }
+
+            return *this;
+        }
+
+        // fill the last chunk and put the rest in a new one, allocate first to keep the builder intact on failure
+        _Chunk* const _New_chunk = _Allocate_chunk(_Count - _Free); // may throw
+        if (_Free != 0) { // same as above
+            traits_type::copy(_Mynext, _Ptr, _Free);
+            _Mynext += _Free;
+        }
+
+        _Push_chunk(_New_chunk);
+        traits_type::copy(_Mynext, _Ptr + _Free, _Count - _Free);
+        _Mynext += _Count - _Free;
+        return *this;
+    }
+
+    template <class _Elem>
+    string_builder<_Elem>& string_builder<_Elem>::append(const string_view<_Elem> _Str) {
+        return append(_Str.data(), _Str.size());
+    }
+
+    template <class _Elem>
+    string_builder<_Elem>& string_builder<_Elem>::append(const size_type _Count, const value_type _Ch) {
+        const size_type _Free = static_cast<size_type>(_Myend - _Mynext);
+        if (_Count <= _Free) { // found enough space, don't allocate a new chunk
+            if (_Count != 0) { // _Mynext is null until the first chunk is allocated
+                traits_type::assign(_Mynext, _Count, _Ch);
+                _Mynext += _Count;
+            }
+
+            return *this;
+        }
+
+        _Chunk* const _New_chunk = _Allocate_chunk(_Count - _Free); // may throw
+        if (_Free != 0) { // same as above
+            traits_type::assign(_Mynext, _Free, _Ch);
+            _Mynext += _Free;
+        }
+
+        _Push_chunk(_New_chunk);
+        traits_type::assign(_Mynext, _Count - _Free, _Ch);
+        _Mynext += _Count - _Free;
+        return *this;
+    }
+
+    template <class _Elem>
+    void string_builder<_Elem>::push_back(const value_type _Ch) {
+        if (_Mynext == _Myend) { // the last chunk is full (or there are no chunks), allocate a new one
+            _Push_chunk(_Allocate_chunk(1));
+        }
+
+        *_Mynext++ = _Ch;
+    }
+
+    template <class _Elem>
+    typename string_builder<_Elem>::size_type string_builder<_Elem>::chunks(
+        string_view<_Elem>* const _Dest, const size_type _Count, const size_type _First) const noexcept {
+        const _Chunk* _Current = _Myfirst;
+        for (size_type _Skipped = 0; _Current && _Skipped < _First; ++_Skipped) {
+            _Current = _Current->_Next;
+        }
+
+        size_type _Stored = 0;
+        for (; _Current && _Stored < _Count; _Current = _Current->_Next) {
+            _Dest[_Stored++] = string_view<_Elem>{_Chunk_data(_Current), _Chunk_size(_Current)};
+        }
+
+        return _Stored;
+    }
+
+    template <class _Elem>
+    void string_builder<_Elem>::copy(pointer _Dest) const noexcept {
+        for (const _Chunk* _Current = _Myfirst; _Current; _Current = _Current->_Next) {
+            const size_type _Size = _Chunk_size(_Current);
+            traits_type::copy(_Dest, _Chunk_data(_Current), _Size);
+            _Dest += _Size;
+        }
+    }
+
+    template <class _Elem>
+    string<_Elem> string_builder<_Elem>::finalize() {
+        const size_type _Size = size();
+        string<_Elem> _Result(_Myresource, _Size); // the only allocation, may throw
+        _Result.resize_uninitialized(_Size);
+        copy(_Result.data());
+        clear();
+        return _Result;
+    }
+
+    template <class _Elem>
+    void string_builder<_Elem>::clear() noexcept {
+        while (_Myfirst) {
+            _Chunk* const _Next = _Myfirst->_Next;
+            _Myresource->deallocate(_Myfirst, _Header_size + _Myfirst->_Capacity * sizeof(_Elem));
+            _Myfirst = _Next;
+        }
+
+        _Mylast   = nullptr;
+        _Mynext   = nullptr;
+        _Myend    = nullptr;
+        _Mysealed = 0;
+        _Mycount  = 0;
+    }
+
+    template <class _Elem>
+    void string_builder<_Elem>::swap(string_builder& _Other) noexcept {
+        ::std::swap(_Myresource, _Other._Myresource);
+        ::std::swap(_Myfirst, _Other._Myfirst);
+        ::std::swap(_Mylast, _Other._Mylast);
+        ::std::swap(_Mynext, _Other._Mynext);
+        ::std::swap(_Myend, _Other._Myend);
+        ::std::swap(_Mysealed, _Other._Mysealed);
+        ::std::swap(_Mycount, _Other._Mycount);
+    }
+
+    template class _MJSTR_API string_builder<byte_t>;
+    template class _MJSTR_API string_builder<char>;
+    template class _MJSTR_API string_builder<wchar_t>;
+} // namespace mjx
\ No newline at end of file
@@ -0,0 +1,118 @@
+// string_builder.hpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#ifndef _MJSTR_STRING_BUILDER_HPP_
+#define _MJSTR_STRING_BUILDER_HPP_
+#include <cstddef>
+#include <mjstr/api.hpp>
+#include <mjstr/char_traits.hpp>
+#include <mjstr/memory_resource.hpp>
+#include <mjstr/string.hpp>
+#include <mjstr/string_view.hpp>
+
+namespace mjx {
+    template <class _Elem>
+    class _MJSTR_API string_builder { // appends into a chain of growing chunks, never moves written characters
+    public:
+        static_assert(compatible_element<_Elem>, "invalid element type for string_builder<CharT>");
+
+        using value_type    = _Elem;
+        using size_type     = size_t;
+        using pointer       = _Elem*;
+        using const_pointer = const _Elem*;
+        using traits_type   = char_traits<_Elem>;
+
+        // the number of characters in the first chunk and the limit of the geometric chunk growth
+        static constexpr size_type min_chunk_capacity = 256;
+        static constexpr size_type max_chunk_capacity = size_type{1} << 20;
+
+        // Note: The chunks are allocated from _Resource (the global allocator if nullptr), so is the string
+        //       returned by finalize().
+        string_builder() noexcept;
+        explicit string_builder(memory_resource* const _Resource) noexcept;
+        string_builder(string_builder&& _Other) noexcept;
+        ~string_builder() noexcept;
+
+        string_builder& operator=(string_builder&& _Other) noexcept;
+
+        string_builder(const string_builder&)            = delete;
+        string_builder& operator=(const string_builder&) = delete;
+
+        // checks whether the builder is empty
+        bool empty() const noexcept;
+
+        // returns the number of appended characters
+        size_type size() const noexcept;
+
+        // returns the number of chunks that store the characters
+        size_type chunk_count() const noexcept;
+
+        // returns the resource used to allocate the chunks
+        memory_resource* get_memory_resource() const noexcept;
+
+        // appends characters
+        string_builder& append(const_pointer _Ptr, const size_type _Count);
+        string_builder& append(const string_view<_Elem> _Str);
+        string_builder& append(const size_type _Count, const value_type _Ch);
+
+        // appends a character
+        void push_back(const value_type _Ch);
+
+        // stores up to _Count chunks, starting from the _First one, returns the number of stored chunks
+        // (e.g. to pass them to a scatter-gather write without finalizing the builder)
+        size_type chunks(
+            string_view<_Elem>* const _Dest, const size_type _Count, const size_type _First = 0) const noexcept;
+
+        // copies all characters to _Dest, which must have space for size() characters
+        void copy(pointer _Dest) const noexcept;
+
+        // returns all characters in a string allocated once and clears the builder
+        string<_Elem> finalize();
+
+        // removes all characters and frees all chunks
+        void clear() noexcept;
+
+        // swaps two builders
+        void swap(string_builder& _Other) noexcept;
+
+    private:
+        struct _Chunk { // stored at the beginning of every chunk, followed by its characters
+            _Chunk* _Next;
+            size_type _Size; // up to date only if the chunk isn't the last one
+            size_type _Capacity;
+        };
+
+        static constexpr size_type _Header_size =
+            (sizeof(_Chunk) + memory_resource::alignment - 1) & ~(memory_resource::alignment - 1);
+
+        // returns the characters of the chunk
+        static pointer _Chunk_data(_Chunk* const _Target) noexcept;
+        static const_pointer _Chunk_data(const _Chunk* const _Target) noexcept;
+
+        // returns the number of characters stored in the chunk
+        size_type _Chunk_size(const _Chunk* const _Target) const noexcept;
+
+        // allocates a chunk for at least _Required characters, the builder isn't modified
+        _Chunk* _Allocate_chunk(const size_type _Required) const;
+
+        // seals the last chunk and links the new one
+        void _Push_chunk(_Chunk* const _New_chunk) noexcept;
+
+        memory_resource* _Myresource;
+        _Chunk* _Myfirst;
+        _Chunk* _Mylast;
+        pointer _Mynext; // the first free character in the last chunk
+        pointer _Myend; // the end of the last chunk
+        size_type _Mysealed; // the number of characters in all chunks but the last one
+        size_type _Mycount;
+    };
+
+    using byte_string_builder    = string_builder<byte_t>;
+    using utf8_string_builder    = string_builder<char>;
+    using unicode_string_builder = string_builder<wchar_t>;
+} // namespace mjx
+
+#endif // _MJSTR_STRING_BUILDER_HPP_
\ No newline at end of file
@@ -0,0 +1,670 @@
+// string_flat_map.hpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#ifndef _MJSTR_STRING_FLAT_MAP_HPP_
+#define _MJSTR_STRING_FLAT_MAP_HPP_
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <mjmem/exception.hpp>
+#include <mjstr/char_traits.hpp>
+#include <mjstr/impl/flat_map.hpp>
+#include <mjstr/impl/hash.hpp>
+#include <mjstr/memory_resource.hpp>
+#include <mjstr/string_view.hpp>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace mjx {
+    template <class _Elem, class _Value>
+    class string_flat_map { // open addressing hash map, the entries are stored in a single buffer
+    public:
+        static_assert(compatible_element<_Elem>, "invalid element type for string_flat_map<CharT, T>");
+        static_assert(::std::is_nothrow_move_constructible_v<_Value>,
+            "string_flat_map<CharT, T> requires nothrow move constructible T");
+        static_assert(alignof(_Value) <= memory_resource::alignment,
+            "string_flat_map<CharT, T> doesn't support over-aligned T");
+
+        using key_type    = string_view<_Elem>;
+        using mapped_type = _Value;
+        using size_type   = size_t;
+        using traits_type = char_traits<_Elem>;
+
+        template <bool _Const>
+        class _Iterator { // forward iterator over the entries, yields (key, value) pairs
+        public:
+            using iterator_category = ::std::forward_iterator_tag;
+            using difference_type   = ptrdiff_t;
+            using value_type        = ::std::pair<key_type, ::std::conditional_t<_Const, const _Value&, _Value&>>;
+            using reference         = value_type;
+
+            _Iterator() noexcept : _Mymap(nullptr), _Myidx(0) {}
+
+            operator _Iterator<true>() const noexcept requires (!_Const) {
+                return _Iterator<true>{_Mymap, _Myidx};
+            }
+
+            // returns the key, valid until the entry is erased or the map is modified
+            key_type key() const noexcept {
+                const byte_t* const _Entry = _Mymap->_Entry_at(_Myidx);
+                return key_type{_Entry_chars(_Entry), _Entry_size(_Entry)};
+            }
+
+            // returns the value
+            ::std::conditional_t<_Const, const _Value&, _Value&> value() const noexcept {
+                return _Entry_value(_Mymap->_Entry_at(_Myidx));
+            }
+
+            reference operator*() const noexcept {
+                return reference{key(), value()};
+            }
+
+            _Iterator& operator++() noexcept {
+                ++_Myidx;
+                _Skip_free();
+                return *this;
+            }
+
+            _Iterator operator++(int) noexcept {
+                _Iterator _Temp = *this;
+                ++*this;
+                return _Temp;
+            }
+
+            friend bool operator==(const _Iterator& _Left, const _Iterator& _Right) noexcept {
+                return _Left._Myidx == _Right._Myidx;
+            }
+
+        private:
+            friend string_flat_map;
+            friend _Iterator<!_Const>;
+
+            using _Map_ptr = ::std::conditional_t<_Const, const string_flat_map*, string_flat_map*>;
+
+            _Iterator(const _Map_ptr _Map, const size_type _Idx) noexcept : _Mymap(_Map), _Myidx(_Idx) {}
+
+            void _Skip_free() noexcept {
+                while (_Myidx < _Mymap->_Mycapacity && _Mymap->_Ctrl_at(_Myidx) < 0) {
+                    ++_Myidx;
+                }
+            }
+
+            _Map_ptr _Mymap;
+            size_type _Myidx; // the slot of the entry
+        };
+
+        using iterator       = _Iterator<false>;
+        using const_iterator = _Iterator<true>;
+
+        // Note: Every entry (the key size, the value and the key characters) is stored in a single buffer,
+        //       so an insertion allocates only when the table or the buffer must grow. Every group of 16
+        //       control bytes is followed by the positions of the entries, so a lookup usually touches only
+        //       the group and the matching entry. Any insertion may invalidate the iterators, erasure
+        //       invalidates only the iterators to the erased entries.
+        //       The memory is taken from _Resource (the global allocator if nullptr).
+        string_flat_map() noexcept : string_flat_map(nullptr) {}
+
+        explicit string_flat_map(memory_resource* const _Resource) noexcept
+            : _Myresource(_Resource ? _Resource : global_memory_resource()), _Mygroups(nullptr), _Mycapacity(0),
+              _Mysize(0), _Mygrowth_left(0), _Myentries(nullptr), _Myentries_size(0), _Myentries_capacity(0),
+              _Mygarbage(0) {}
+
+        string_flat_map(string_flat_map&& _Other) noexcept
+            : _Myresource(_Other._Myresource), _Mygroups(_Other._Mygroups), _Mycapacity(_Other._Mycapacity),
+              _Mysize(_Other._Mysize), _Mygrowth_left(_Other._Mygrowth_left), _Myentries(_Other._Myentries),
+              _Myentries_size(_Other._Myentries_size), _Myentries_capacity(_Other._Myentries_capacity),
+              _Mygarbage(_Other._Mygarbage) {
+            _Other._Release();
+        }
+
+        ~string_flat_map() noexcept {
+            _Tidy();
+        }
+
+        string_flat_map& operator=(string_flat_map&& _Other) noexcept {
+            if (this != ::std::addressof(_Other)) {
+                _Tidy();
+                swap(_Other);
+            }
+
+            return *this;
+        }
+
+        string_flat_map(const string_flat_map&)            = delete;
+        string_flat_map& operator=(const string_flat_map&) = delete;
+
+        // returns an iterator to the first entry
+        iterator begin() noexcept {
+            iterator _First{this, 0};
+            _First._Skip_free();
+            return _First;
+        }
+
+        const_iterator begin() const noexcept {
+            const_iterator _First{this, 0};
+            _First._Skip_free();
+            return _First;
+        }
+
+        // returns an iterator past the last entry
+        iterator end() noexcept {
+            return iterator{this, _Mycapacity};
+        }
+
+        const_iterator end() const noexcept {
+            return const_iterator{this, _Mycapacity};
+        }
+
+        // checks whether the map is empty
+        bool empty() const noexcept {
+            return _Mysize == 0;
+        }
+
+        // returns the number of entries
+        size_type size() const noexcept {
+            return _Mysize;
+        }
+
+        // returns the number of slots (the map rehashes when 7/8 of them are used)
+        size_type capacity() const noexcept {
+            return _Mycapacity;
+        }
+
+        // returns the resource used to allocate the memory
+        memory_resource* get_memory_resource() const noexcept {
+            return _Myresource;
+        }
+
+        // reserves space for at least _Count entries without rehashing
+        void reserve(const size_type _Count) {
+            if (_Count <= _Mysize) { // already enough space
+                return;
+            }
+
+            size_type _New_capacity = _Mycapacity > 0 ? _Mycapacity : mjstr_impl::_Ctrl_group_size;
+            while (_Max_load(_New_capacity) < _Count) {
+                if (_New_capacity > _Max_capacity / 2) { // requested too much memory, break
+                    allocation_limit_exceeded::raise();
+                }
+
+                _New_capacity *= 2;
+            }
+
+            if (_New_capacity > _Mycapacity || _Mygrowth_left < _Count - _Mysize) { // rehash to make space
+                _Rehash(_New_capacity);
+            }
+        }
+
+        // inserts a value constructed from _Args if _Key is not in the map yet, returns an iterator to the entry
+        // and true if the value was inserted
+        template <class... _Types>
+        ::std::pair<iterator, bool> try_emplace(const key_type _Key, _Types&&... _Args) {
+            const _Elem* const _Ptr = _Key.data();
+            const size_type _Size   = _Key.size();
+            const uint64_t _Hash    = _Hash_key(_Ptr, _Size);
+            const size_type _Found  = _Find_slot(_Ptr, _Size, _Hash);
+            if (_Found != _Not_found) { // the key is already in the map
+                return {iterator{this, _Found}, false};
+            }
+
+            const uintptr_t _Address = reinterpret_cast<uintptr_t>(_Ptr);
+            if (_Address >= reinterpret_cast<uintptr_t>(_Myentries)
+                && _Address < reinterpret_cast<uintptr_t>(_Myentries + _Myentries_size)) {
+                // Note: The key points into the entry buffer (e.g. a part of another key), which may move
+                //       while the map grows, so it must be copied first.
+                _Key_copy _Copy(_Ptr, _Size, _Myresource); // may throw
+                return {iterator{this, _Insert(_Copy._Ptr, _Size, _Hash, ::std::forward<_Types>(_Args)...)}, true};
+            }
+
+            return {iterator{this, _Insert(_Ptr, _Size, _Hash, ::std::forward<_Types>(_Args)...)}, true};
+        }
+
+        // inserts a copy of _Val if _Key is not in the map yet
+        ::std::pair<iterator, bool> insert(const key_type _Key, const _Value& _Val) {
+            return try_emplace(_Key, _Val);
+        }
+
+        ::std::pair<iterator, bool> insert(const key_type _Key, _Value&& _Val) {
+            return try_emplace(_Key, ::std::move(_Val));
+        }
+
+        // inserts _Val, or assigns it if _Key is already in the map
+        template <class _Ty>
+        ::std::pair<iterator, bool> insert_or_assign(const key_type _Key, _Ty&& _Val) {
+            ::std::pair<iterator, bool> _Result = try_emplace(_Key, ::std::forward<_Ty>(_Val));
+            if (!_Result.second) { // the key is already in the map, assign the value
+                _Result.first.value() = ::std::forward<_Ty>(_Val);
+            }
+
+            return _Result;
+        }
+
+        // returns the value mapped to _Key, inserts a value-initialized one if _Key is not in the map yet
+        _Value& operator[](const key_type _Key) {
+            return try_emplace(_Key).first.value();
+        }
+
+        // returns an iterator to the entry with _Key, or end() if _Key is not in the map
+        iterator find(const key_type _Key) noexcept {
+            const size_type _Found = _Find_slot(_Key.data(), _Key.size(), _Hash_key(_Key.data(), _Key.size()));
+            return iterator{this, _Found != _Not_found ? _Found : _Mycapacity};
+        }
+
+        const_iterator find(const key_type _Key) const noexcept {
+            const size_type _Found = _Find_slot(_Key.data(), _Key.size(), _Hash_key(_Key.data(), _Key.size()));
+            return const_iterator{this, _Found != _Not_found ? _Found : _Mycapacity};
+        }
+
+        // checks whether _Key is in the map
+        bool contains(const key_type _Key) const noexcept {
+            return _Find_slot(_Key.data(), _Key.size(), _Hash_key(_Key.data(), _Key.size())) != _Not_found;
+        }
+
+        // erases the entry with _Key, returns the number of erased entries (0 or 1)
+        size_type erase(const key_type _Key) noexcept {
+            const size_type _Found = _Find_slot(_Key.data(), _Key.size(), _Hash_key(_Key.data(), _Key.size()));
+            if (_Found == _Not_found) { // the key is not in the map
+                return 0;
+            }
+
+            _Erase_slot(_Found);
+            return 1;
+        }
+
+        // erases the entry at _Where, returns an iterator to the next entry
+        iterator erase(const const_iterator _Where) noexcept {
+            _Erase_slot(_Where._Myidx);
+            iterator _Next{this, _Where._Myidx + 1};
+            _Next._Skip_free();
+            return _Next;
+        }
+
+        // erases all entries, keeps the memory
+        void clear() noexcept {
+            _Destroy_values();
+            for (size_type _Idx = 0; _Idx < _Mycapacity / mjstr_impl::_Ctrl_group_size; ++_Idx) {
+                ::memset(_Mygroups[_Idx]._Ctrl, mjstr_impl::_Ctrl_empty, mjstr_impl::_Ctrl_group_size);
+            }
+
+            _Mysize         = 0;
+            _Mygrowth_left  = _Max_load(_Mycapacity);
+            _Myentries_size = 0;
+            _Mygarbage      = 0;
+        }
+
+        // swaps two maps
+        void swap(string_flat_map& _Other) noexcept {
+            ::std::swap(_Myresource, _Other._Myresource);
+            ::std::swap(_Mygroups, _Other._Mygroups);
+            ::std::swap(_Mycapacity, _Other._Mycapacity);
+            ::std::swap(_Mysize, _Other._Mysize);
+            ::std::swap(_Mygrowth_left, _Other._Mygrowth_left);
+            ::std::swap(_Myentries, _Other._Myentries);
+            ::std::swap(_Myentries_size, _Other._Myentries_size);
+            ::std::swap(_Myentries_capacity, _Other._Myentries_capacity);
+            ::std::swap(_Mygarbage, _Other._Mygarbage);
+        }
+
+    private:
+        using _Group = mjstr_impl::_Ctrl_group;
+
+        static constexpr size_type _Not_found = static_cast<size_type>(-1);
+
+        // Note: An entry consists of the key size, the value and the key characters. The entries are aligned
+        //       and their positions are stored in 32-bit units of _Entry_align bytes.
+        static constexpr size_type _Entry_align  = (::std::max)(alignof(size_t), alignof(_Value));
+        static constexpr size_type _Value_offset = (sizeof(size_t) + alignof(_Value) - 1) & ~(alignof(_Value) - 1);
+        static constexpr size_type _Chars_offset =
+            (_Value_offset + sizeof(_Value) + alignof(_Elem) - 1) & ~(alignof(_Elem) - 1);
+        static constexpr size_type _Max_entries_size = (::std::min)(
+            static_cast<size_type>(-1) & ~(_Entry_align - 1), static_cast<size_type>(UINT32_MAX) * _Entry_align);
+
+        // the largest capacity whose table size can be computed without overflow
+        static constexpr size_type _Max_capacity =
+            ::std::bit_floor(static_cast<size_type>(-1) / sizeof(_Group) * mjstr_impl::_Ctrl_group_size / 2);
+
+        struct _Key_copy { // temporary copy of a key that points into the entry buffer
+            _Key_copy(const _Elem* const _Src, const size_type _Size, memory_resource* const _Resource)
+                : _Ptr(static_cast<_Elem*>(_Resource->allocate(_Size * sizeof(_Elem)))), _Size(_Size),
+                  _Resource(_Resource) {
+                traits_type::copy(_Ptr, _Src, _Size);
+            }
+
+            ~_Key_copy() noexcept {
+                _Resource->deallocate(_Ptr, _Size * sizeof(_Elem));
+            }
+
+            _Key_copy(const _Key_copy&)            = delete;
+            _Key_copy& operator=(const _Key_copy&) = delete;
+
+            _Elem* _Ptr;
+            size_type _Size;
+            memory_resource* _Resource;
+        };
+
+        static constexpr size_type _Max_load(const size_type _Capacity) noexcept {
+            return _Capacity - _Capacity / 8;
+        }
+
+        static constexpr size_type _Entry_bytes(const size_type _Size) noexcept {
+            return (_Chars_offset + _Size * sizeof(_Elem) + _Entry_align - 1) & ~(_Entry_align - 1);
+        }
+
+        static size_type _Entry_size(const byte_t* const _Entry) noexcept {
+            size_type _Size;
+            ::memcpy(&_Size, _Entry, sizeof(size_type));
+            return _Size;
+        }
+
+        static _Value& _Entry_value(byte_t* const _Entry) noexcept {
+            return *::std::launder(reinterpret_cast<_Value*>(_Entry + _Value_offset));
+        }
+
+        static const _Value& _Entry_value(const byte_t* const _Entry) noexcept {
+            return *::std::launder(reinterpret_cast<const _Value*>(_Entry + _Value_offset));
+        }
+
+        static const _Elem* _Entry_chars(const byte_t* const _Entry) noexcept {
+            return reinterpret_cast<const _Elem*>(_Entry + _Chars_offset);
+        }
+
+        static uint64_t _Hash_key(const _Elem* const _Ptr, const size_type _Size) noexcept {
+            return mjstr_impl::_Hash_bytes_inline(_Ptr, _Size * sizeof(_Elem), 0);
+        }
+
+        static int8_t _Fingerprint(const uint64_t _Hash) noexcept {
+            return static_cast<int8_t>(_Hash & 0x7F);
+        }
+
+        int8_t& _Ctrl_at(const size_type _Idx) const noexcept {
+            return _Mygroups[_Idx / mjstr_impl::_Ctrl_group_size]._Ctrl[_Idx % mjstr_impl::_Ctrl_group_size];
+        }
+
+        uint32_t& _Offset_at(const size_type _Idx) const noexcept {
+            return _Mygroups[_Idx / mjstr_impl::_Ctrl_group_size]._Offsets[_Idx % mjstr_impl::_Ctrl_group_size];
+        }
+
+        byte_t* _Entry_at(const size_type _Idx) const noexcept {
+            return _Myentries + static_cast<size_type>(_Offset_at(_Idx)) * _Entry_align;
+        }
+
+        size_type _Find_slot(const _Elem* const _Ptr, const size_type _Size, const uint64_t _Hash) const noexcept {
+            // Note: The groups are probed in a triangular sequence, which visits every group once,
+            //       since the number of groups is a power of two. The probe stops at the first group
+            //       with an empty slot, the key would have been stored there or before.
+            if (_Mycapacity == 0) { // nothing stored yet
+                return _Not_found;
+            }
+
+            const int8_t _Fp      = _Fingerprint(_Hash);
+            const size_type _Mask = _Mycapacity / mjstr_impl::_Ctrl_group_size - 1;
+            size_type _Group_idx  = static_cast<size_type>(_Hash >> 7) & _Mask;
+            for (size_type _Step = 1;; ++_Step) {
+                const _Group& _Current = _Mygroups[_Group_idx];
+                mjstr_impl::_Prefetch_offsets(_Current);
+                for (uint32_t _Match = mjstr_impl::_Match_fingerprint(_Current, _Fp); _Match != 0;
+                     _Match &= _Match - 1) {
+                    const size_type _Bit = static_cast<size_type>(::std::countr_zero(_Match));
+                    const byte_t* const _Entry =
+                        _Myentries + static_cast<size_type>(_Current._Offsets[_Bit]) * _Entry_align;
+                    if (_Entry_size(_Entry) == _Size
+                        && traits_type::compare(_Entry_chars(_Entry), _Ptr, _Size) == 0) {
+                        return _Group_idx * mjstr_impl::_Ctrl_group_size + _Bit;
+                    }
+                }
+
+                if (mjstr_impl::_Match_empty(_Current) != 0) { // the key is not in the map
+                    return _Not_found;
+                }
+
+                _Group_idx = (_Group_idx + _Step) & _Mask;
+            }
+        }
+
+        static size_type _Find_free_slot(
+            const _Group* const _Groups, const size_type _Capacity, const uint64_t _Hash) noexcept {
+            // returns the first empty or deleted slot in the probe sequence
+            const size_type _Mask = _Capacity / mjstr_impl::_Ctrl_group_size - 1;
+            size_type _Group_idx  = static_cast<size_type>(_Hash >> 7) & _Mask;
+            for (size_type _Step = 1;; ++_Step) {
+                const uint32_t _Free = mjstr_impl::_Match_free(_Groups[_Group_idx]);
+                if (_Free != 0) {
+                    return _Group_idx * mjstr_impl::_Ctrl_group_size
+                         + static_cast<size_type>(::std::countr_zero(_Free));
+                }
+
+                _Group_idx = (_Group_idx + _Step) & _Mask;
+            }
+        }
+
+        template <class... _Types>
+        size_type _Insert(const _Elem* const _Ptr, const size_type _Size, const uint64_t _Hash, _Types&&... _Args) {
+            // inserts a key that is not in the map, the map is unchanged if an exception is thrown
+            if (_Size > (_Max_entries_size - _Chars_offset) / sizeof(_Elem)) { // requested too much memory, break
+                allocation_limit_exceeded::raise();
+            }
+
+            const size_type _Bytes = _Entry_bytes(_Size);
+            if (_Bytes > _Myentries_capacity - _Myentries_size) { // the entry buffer will be reallocated
+                // Note: The arguments may refer to a value stored in the entry buffer (e.g. another entry's
+                //       value), which is freed when the buffer grows. The value is constructed first
+                //       and then moved to the new buffer.
+                _Value _Val(::std::forward<_Types>(_Args)...); // may throw
+                return _Insert_entry(_Ptr, _Size, _Hash, _Bytes, ::std::move(_Val));
+            }
+
+            return _Insert_entry(_Ptr, _Size, _Hash, _Bytes, ::std::forward<_Types>(_Args)...);
+        }
+
+        template <class... _Types>
+        size_type _Insert_entry(const _Elem* const _Ptr, const size_type _Size, const uint64_t _Hash,
+            const size_type _Bytes, _Types&&... _Args) {
+            // stores the entry of _Bytes bytes at the end of the entry buffer
+            _Reserve_entries(_Bytes); // may throw
+            if (_Mygrowth_left == 0) { // no empty slots left, rehash first
+                // Note: If at least half of the used slots are deleted, the table is only cleaned up.
+                if (_Mycapacity > 0 && _Mysize <= _Max_load(_Mycapacity) / 2) {
+                    _Rehash(_Mycapacity); // may throw
+                } else {
+                    if (_Mycapacity > _Max_capacity / 2) { // requested too much memory, break
+                        allocation_limit_exceeded::raise();
+                    }
+
+                    _Rehash(_Mycapacity > 0 ? _Mycapacity * 2 : mjstr_impl::_Ctrl_group_size); // may throw
+                }
+            }
+
+            byte_t* const _Entry = _Myentries + _Myentries_size;
+            ::new (static_cast<void*>(_Entry + _Value_offset)) _Value(::std::forward<_Types>(_Args)...); // may throw
+            ::memcpy(_Entry, &_Size, sizeof(size_type));
+            traits_type::copy(reinterpret_cast<_Elem*>(_Entry + _Chars_offset), _Ptr, _Size);
+
+            const size_type _Idx = _Find_free_slot(_Mygroups, _Mycapacity, _Hash);
+            int8_t& _Ctrl        = _Ctrl_at(_Idx);
+            if (_Ctrl == mjstr_impl::_Ctrl_empty) { // deleted slots are already excluded from the growth
+                --_Mygrowth_left;
+            }
+
+            _Ctrl            = _Fingerprint(_Hash);
+            _Offset_at(_Idx) = static_cast<uint32_t>(_Myentries_size / _Entry_align);
+            _Myentries_size += _Bytes;
+            ++_Mysize;
+            return _Idx;
+        }
+
+        void _Erase_slot(const size_type _Idx) noexcept {
+            // Note: A probe stops at the first group with an empty slot. If the group already has one,
+            //       no probe passes through it, so the slot may become empty as well.
+            //       Otherwise the slot is marked as deleted to keep the probe sequences intact.
+            byte_t* const _Entry = _Entry_at(_Idx);
+            _Mygarbage          += _Entry_bytes(_Entry_size(_Entry));
+            _Entry_value(_Entry).~_Value();
+            --_Mysize;
+            if (mjstr_impl::_Match_empty(_Mygroups[_Idx / mjstr_impl::_Ctrl_group_size]) != 0) {
+                _Ctrl_at(_Idx) = mjstr_impl::_Ctrl_empty;
+                ++_Mygrowth_left;
+            } else {
+                _Ctrl_at(_Idx) = mjstr_impl::_Ctrl_deleted;
+            }
+        }
+
+        void _Reserve_entries(const size_type _Bytes) {
+            // ensures that the entry buffer has space for _Bytes more bytes
+            if (_Bytes <= _Myentries_capacity - _Myentries_size) { // enough space, do nothing
+                return;
+            }
+
+            // Note: The erased entries are dropped only when the buffer is full. If they take at least half
+            //       of it, the buffer is reallocated with the same capacity, otherwise it grows geometrically.
+            const size_type _Live = _Myentries_size - _Mygarbage;
+            if (_Bytes > _Max_entries_size - _Live) { // requested too much memory, break
+                allocation_limit_exceeded::raise();
+            }
+
+            size_type _New_capacity = _Myentries_capacity;
+            if (_Live + _Bytes > _Myentries_capacity / 2) {
+                _New_capacity =
+                    _Myentries_capacity < _Max_entries_size / 2 ? _Myentries_capacity * 2 : _Max_entries_size;
+                if (_New_capacity < _Live + _Bytes) {
+                    _New_capacity = _Live + _Bytes;
+                }
+
+                if (_New_capacity < 256) { // avoid tiny buffers
+                    _New_capacity = 256;
+                }
+            }
+
+            byte_t* const _New_entries = static_cast<byte_t*>(_Myresource->allocate(_New_capacity)); // may throw
+            _Move_entries(_New_entries);
+            if (_Myentries_capacity > 0) {
+                _Myresource->deallocate(_Myentries, _Myentries_capacity);
+            }
+
+            _Myentries          = _New_entries;
+            _Myentries_capacity = _New_capacity;
+        }
+
+        void _Move_entries(byte_t* const _New_entries) noexcept {
+            // moves all entries to _New_entries (without the erased ones) and updates their positions
+            if constexpr (::std::is_trivially_copyable_v<_Value>) {
+                if (_Mygarbage == 0) { // no erased entries, copy the whole buffer
+                    if (_Myentries_size > 0) {
+                        ::memcpy(_New_entries, _Myentries, _Myentries_size);
+                    }
+
+                    return;
+                }
+            }
+
+            size_type _Offset = 0;
+            for (size_type _Idx = 0; _Idx < _Mycapacity; ++_Idx) {
+                if (_Ctrl_at(_Idx) >= 0) { // the slot is full
+                    byte_t* const _Entry   = _Entry_at(_Idx);
+                    byte_t* const _Target  = _New_entries + _Offset;
+                    const size_type _Bytes = _Entry_bytes(_Entry_size(_Entry));
+                    ::new (static_cast<void*>(_Target + _Value_offset)) _Value(::std::move(_Entry_value(_Entry)));
+                    _Entry_value(_Entry).~_Value();
+                    ::memcpy(_Target, _Entry, sizeof(size_type));
+                    ::memcpy(_Target + _Chars_offset, _Entry + _Chars_offset, _Bytes - _Chars_offset);
+                    _Offset_at(_Idx) = static_cast<uint32_t>(_Offset / _Entry_align);
+                    _Offset         += _Bytes;
+                }
+            }
+
+            _Myentries_size = _Offset;
+            _Mygarbage      = 0;
+        }
+
+        void _Rehash(const size_type _New_capacity) {
+            // moves all slots to a new table of _New_capacity slots, the entries stay in place
+            const size_type _Group_count = _New_capacity / mjstr_impl::_Ctrl_group_size;
+            _Group* const _New_groups =
+                static_cast<_Group*>(_Myresource->allocate(_Group_count * sizeof(_Group))); // may throw
+            for (size_type _Idx = 0; _Idx < _Group_count; ++_Idx) {
+                ::memset(_New_groups[_Idx]._Ctrl, mjstr_impl::_Ctrl_empty, mjstr_impl::_Ctrl_group_size);
+            }
+
+            for (size_type _Idx = 0; _Idx < _Mycapacity; ++_Idx) {
+                if (_Ctrl_at(_Idx) >= 0) { // the slot is full, move it to the new table
+                    const byte_t* const _Entry = _Entry_at(_Idx);
+                    const uint64_t _Hash       = _Hash_key(_Entry_chars(_Entry), _Entry_size(_Entry));
+                    const size_type _New       = _Find_free_slot(_New_groups, _New_capacity, _Hash);
+                    const size_type _Bit       = _New % mjstr_impl::_Ctrl_group_size;
+                    _Group& _Target            = _New_groups[_New / mjstr_impl::_Ctrl_group_size];
+                    _Target._Ctrl[_Bit]        = _Fingerprint(_Hash);
+                    _Target._Offsets[_Bit]     = _Offset_at(_Idx);
+                }
+            }
+
+            if (_Mycapacity > 0) {
+                _Myresource->deallocate(_Mygroups, _Mycapacity / mjstr_impl::_Ctrl_group_size * sizeof(_Group));
+            }
+
+            _Mygroups      = _New_groups;
+            _Mycapacity    = _New_capacity;
+            _Mygrowth_left = _Max_load(_New_capacity) - _Mysize;
+        }
+
+        void _Destroy_values() noexcept {
+            if constexpr (!::std::is_trivially_destructible_v<_Value>) {
+                for (size_type _Idx = 0; _Idx < _Mycapacity; ++_Idx) {
+                    if (_Ctrl_at(_Idx) >= 0) { // the slot is full
+                        _Entry_value(_Entry_at(_Idx)).~_Value();
+                    }
+                }
+            }
+        }
+
+        void _Tidy() noexcept {
+            // destroys all entries and frees all memory
+            _Destroy_values();
+            if (_Mycapacity > 0) {
+                _Myresource->deallocate(_Mygroups, _Mycapacity / mjstr_impl::_Ctrl_group_size * sizeof(_Group));
+            }
+
+            if (_Myentries_capacity > 0) {
+                _Myresource->deallocate(_Myentries, _Myentries_capacity);
+            }
+
+            _Release();
+        }
+
+        void _Release() noexcept {
+            // forgets the memory without freeing it, the resource is kept
+            _Mygroups           = nullptr;
+            _Mycapacity         = 0;
+            _Mysize             = 0;
+            _Mygrowth_left      = 0;
+            _Myentries          = nullptr;
+            _Myentries_size     = 0;
+            _Myentries_capacity = 0;
+            _Mygarbage          = 0;
+        }
+
+        memory_resource* _Myresource;
+        _Group* _Mygroups;
+        size_type _Mycapacity; // the number of slots, zero or a power of two (at least one group)
+        size_type _Mysize;
+        size_type _Mygrowth_left; // the number of empty slots that can be used before rehashing
+        byte_t* _Myentries; // all entries, including the erased ones
+        size_type _Myentries_size; // in bytes
+        size_type _Myentries_capacity; // in bytes
+        size_type _Mygarbage; // the number of bytes taken by the erased entries
+    };
+
+    template <class _Value>
+    using byte_string_flat_map = string_flat_map<byte_t, _Value>;
+    template <class _Value>
+    using utf8_string_flat_map = string_flat_map<char, _Value>;
+    template <class _Value>
+    using unicode_string_flat_map = string_flat_map<wchar_t, _Value>;
+} // namespace mjx
+
+#endif // _MJSTR_STRING_FLAT_MAP_HPP_
\ No newline at end of file
@@ -5,155 +5,15 @@
 
 #include <algorithm>
 #include <mjmem/exception.hpp>
+#include <mjstr/impl/string_view_inline.hpp>
 #include <mjstr/impl/utils.hpp>
 #include <mjstr/string_view.hpp>
 
 namespace mjx {
-    template <class _Elem>
-    string_view_iterator<_Elem>::string_view_iterator() noexcept
-#ifdef _DEBUG
-        : _Myptr(nullptr), _Mybegin(nullptr), _Myend(nullptr) {}
-#else // ^^^ _DEBUG ^^^ / vvv NDEBUG vvv
-        : _Myptr(nullptr) {}
-#endif // _DEBUG
-
-    template <class _Elem>
-    string_view_iterator<_Elem>::string_view_iterator(
-#ifdef _DEBUG
-        pointer _First, pointer _Last) noexcept : _Myptr(_First), _Mybegin(_First), _Myend(_Last) {
-        _INTERNAL_ASSERT(_First <= _Last, "invalid iterator bounds");
-    }
-#else // ^^^ _DEBUG ^^^ / vvv NDEBUG vvv
-        pointer _Ptr) noexcept : _Myptr(_Ptr) {}
-#endif // _DEBUG
-
-    template <class _Elem>
-    typename string_view_iterator<_Elem>::reference string_view_iterator<_Elem>::operator*() const noexcept {
-#ifdef _DEBUG
-        _INTERNAL_ASSERT(_Myptr != nullptr && _Myptr != _Myend, "attempt to dereference invalid iterator");
-#endif // _DEBUG
-        return *_Myptr;
-    }
-
-    template <class _Elem>
-    typename string_view_iterator<_Elem>::pointer string_view_iterator<_Elem>::operator->() const noexcept {
-#ifdef _DEBUG
-        _INTERNAL_ASSERT(_Myptr != nullptr && _Myptr != _Myend, "attempt to dereference invalid iterator");
-#endif // _DEBUG
-        return _Myptr;
-    }
-
-    template <class _Elem>
-    typename string_view_iterator<_Elem>::reference
-        string_view_iterator<_Elem>::operator[](const difference_type _Off) const noexcept {
-#ifdef _DEBUG
-        _INTERNAL_ASSERT(_Myptr != nullptr, "attempt to use invalid iterator");
-        _INTERNAL_ASSERT(_Myend - _Myptr >= _Off, "attempt to access non-existent element");
-#endif // _DEBUG
-        return _Myptr[_Off];
-    }
-
-    template <class _Elem>
-    string_view_iterator<_Elem>& string_view_iterator<_Elem>::operator++() noexcept {
-#ifdef _DEBUG
-        _INTERNAL_ASSERT(_Myptr != nullptr, "attempt to use invalid iterator");
-        _INTERNAL_ASSERT(_Myend - _Myptr > 0, "attempt to advance iterator that points to the end");
-#endif // _DEBUG
-        ++_Myptr;
-        return *this;
-    }
-
-    template <class _Elem>
-    string_view_iterator<_Elem> string_view_iterator<_Elem>::operator++(int) noexcept {
-        const string_view_iterator _Temp = *this;
-        ++*this;
-        return _Temp;
-    }
-
-    template <class _Elem>
-    string_view_iterator<_Elem>& string_view_iterator<_Elem>::operator--() noexcept {
-#ifdef _DEBUG
-        _INTERNAL_ASSERT(_Myptr != nullptr, "attempt to use invalid iterator");
-        _INTERNAL_ASSERT(_Myptr - _Mybegin > 0, "attempt to retreat iterator that points to the beginning");
-#endif // _DEBUG
-        --_Myptr;
-        return *this;
-    }
-
-    template <class _Elem>
-    string_view_iterator<_Elem> string_view_iterator<_Elem>::operator--(int) noexcept {
-        const string_view_iterator _Temp = *this;
-        --*this;
-        return _Temp;
-    }
-
-    template <class _Elem>
-    string_view_iterator<_Elem>& string_view_iterator<_Elem>::operator+=(const difference_type _Off) noexcept {
-#ifdef _DEBUG
-        _INTERNAL_ASSERT(_Myptr != nullptr, "attempt to use invalid iterator");
-        _INTERNAL_ASSERT(_Myend - _Myptr >= _Off, "attempt to advance iterator beyond the end");
-#endif // _DEBUG
-        _Myptr += _Off;
-        return *this;
-    }
-
-    template <class _Elem>
-    string_view_iterator<_Elem>& string_view_iterator<_Elem>::operator-=(const difference_type _Off) noexcept {
-#ifdef _DEBUG
-        _INTERNAL_ASSERT(_Myptr != nullptr, "attempt to use invalid iterator");
-        _INTERNAL_ASSERT(_Myptr - _Mybegin >= _Off, "attempt to retreat iterator beyond the beginning");
-#endif // _DEBUG
-        _Myptr -= _Off;
-        return *this;
-    }
-
-    template <class _Elem>
-    string_view_iterator<_Elem> string_view_iterator<_Elem>::operator+(const difference_type _Off) const noexcept {
-        string_view_iterator _Temp = *this;
-        _Temp                     += _Off;
-        return _Temp;
-    }
-
-    template <class _Elem>
-    string_view_iterator<_Elem> string_view_iterator<_Elem>::operator-(const difference_type _Off) const noexcept {
-        string_view_iterator _Temp = *this;
-        _Temp                     -= _Off;
-        return _Temp;
-    }
-
-    template <class _Elem>
-    bool string_view_iterator<_Elem>::operator==(const string_view_iterator& _Other) const noexcept {
-        return _Myptr == _Other._Myptr;
-    }
-
-    template <class _Elem>
-    ::std::strong_ordering
-        string_view_iterator<_Elem>::operator<=>(const string_view_iterator& _Other) const noexcept {
-        return _Myptr <=> _Other._Myptr;
-    }
-
     template class _MJSTR_API string_view_iterator<byte_t>;
     template class _MJSTR_API string_view_iterator<char>;
     template class _MJSTR_API string_view_iterator<wchar_t>;
 
-    template <class _Elem>
-    string_view<_Elem>::string_view() noexcept : _Mydata(nullptr), _Mysize(0) {}
-
-    template <class _Elem>
-    string_view<_Elem>::string_view(const_pointer _Ptr, const size_type _Count) noexcept
-        : _Mydata(_Ptr), _Mysize(_Count) {}
-
-    template <class _Elem>
-    string_view<_Elem>::string_view(const_pointer _Ptr) noexcept
-        : _Mydata(_Ptr), _Mysize(traits_type::length(_Ptr)) {}
-
-    template <class _Elem>
-    typename string_view<_Elem>::const_reference
-        string_view<_Elem>::operator[](const size_type _Idx) const noexcept {
-        // no bounds checking is performed, the behavior is undefined if _Idx >= size()
-        return _Mydata[_Idx];
-    }
-
     template <class _Elem>
     void string_view<_Elem>::_Check_offset(const size_type _Off) const {
         if (_Off >= _Mysize) {
@@ -161,85 +21,12 @@ namespace mjx {
         }
     }
 
-    template <class _Elem>
-    typename string_view<_Elem>::const_iterator string_view<_Elem>::begin() const noexcept {
-#ifdef _DEBUG
-        return const_iterator{_Mydata, _Mydata + _Mysize};
-#else // ^^^ _DEBUG ^^^ / vvv NDEBUG vvv
-        return const_iterator{_Mydata};
-#endif // _DEBUG
-    }
-
-    template <class _Elem>
-    typename string_view<_Elem>::const_iterator string_view<_Elem>::end() const noexcept {
-#ifdef _DEBUG
-        return const_iterator{_Mydata + _Mysize, _Mydata + _Mysize};
-#else // ^^^ _DEBUG ^^^ / vvv NDEBUG vvv
-        return const_iterator{_Mydata + _Mysize};
-#endif // _DEBUG
-    }
-
     template <class _Elem>
     typename string_view<_Elem>::const_reference string_view<_Elem>::at(const size_type _Idx) const {
         _Check_offset(_Idx);
         return _Mydata[_Idx];
     }
 
-    template <class _Elem>
-    typename string_view<_Elem>::const_reference string_view<_Elem>::front() const noexcept {
-#ifdef _DEBUG
-        _INTERNAL_ASSERT(_Mysize > 0, "attempt to access non-existent element");
-#endif // _DEBUG
-        return _Mydata[0];
-    }
-
-    template <class _Elem>
-    typename string_view<_Elem>::const_reference string_view<_Elem>::back() const noexcept {
-#ifdef _DEBUG
-        _INTERNAL_ASSERT(_Mysize > 0, "attempt to access non-existent element");
-#endif // _DEBUG
-        return _Mydata[_Mysize - 1];
-    }
-
-    template <class _Elem>
-    typename string_view<_Elem>::const_pointer string_view<_Elem>::data() const noexcept {
-        return _Mydata;
-    }
-
-    template <class _Elem>
-    typename string_view<_Elem>::size_type string_view<_Elem>::size() const noexcept {
-        return _Mysize;
-    }
-
-    template <class _Elem>
-    bool string_view<_Elem>::empty() const noexcept {
-        return _Mysize == 0;
-    }
-
-    template <class _Elem>
-    void string_view<_Elem>::remove_prefix(const size_type _Count) noexcept {
-#ifdef _DEBUG
-        _INTERNAL_ASSERT(_Count <= _Mysize, "attempt to remove prefix longer than total string size");
-#endif // _DEBUG
-        _Mydata += _Count;
-        _Mysize -= _Count;
-    }
-
-    template <class _Elem>
-    void string_view<_Elem>::remove_suffix(const size_type _Count) noexcept {
-#ifdef _DEBUG
-        _INTERNAL_ASSERT(_Count <= _Mysize, "attempt to remove suffix longer than total string size");
-#endif // _DEBUG
-        _Mysize -= _Count;
-    }
-
-    template <class _Elem>
-    void string_view<_Elem>::swap(string_view& _Other) noexcept {
-        const string_view _Temp = *this;
-        *this                   = _Other;
-        _Other                  = _Temp;
-    }
-
     template <class _Elem>
     typename string_view<_Elem>::size_type
         string_view<_Elem>::copy(pointer _Dest, size_type _Count, const size_type _Off) const {
@@ -403,8 +190,9 @@ namespace mjx {
             return (::std::min)(_Off, _Mysize - 1);
         }
 
+        // search only the characters that can contain an occurrence starting at or before _Off
         return traits_type::rfind(
-            _Mydata, (::std::min)(_Off, _Mysize - _Str._Mysize), _Str._Mydata, _Str._Mysize);
+            _Mydata, (::std::min)(_Off, _Mysize - _Str._Mysize) + _Str._Mysize, _Str._Mydata, _Str._Mysize);
     }
 
     template <class _Elem>
@@ -414,7 +202,7 @@ namespace mjx {
             return npos;
         }
 
-        return traits_type::rfind(_Mydata, (::std::min)(_Off, _Mysize - 1), _Ch);
+        return traits_type::rfind(_Mydata, (::std::min)(_Off, _Mysize - 1) + 1, _Ch);
     }
 
     template <class _Elem>
@@ -429,6 +217,122 @@ namespace mjx {
         return rfind(string_view{_Ptr}, _Off);
     }
 
+    template <class _Elem>
+    typename string_view<_Elem>::size_type
+        string_view<_Elem>::find_first_of(const string_view _Str, const size_type _Off) const noexcept {
+        return find_first_of(_Str._Mydata, _Off, _Str._Mysize);
+    }
+
+    template <class _Elem>
+    typename string_view<_Elem>::size_type
+        string_view<_Elem>::find_first_of(const value_type _Ch, const size_type _Off) const noexcept {
+        return find(_Ch, _Off); // a single character, use the faster search
+    }
+
+    template <class _Elem>
+    typename string_view<_Elem>::size_type string_view<_Elem>::find_first_of(
+        const_pointer _Ptr, const size_type _Off, const size_type _Count) const noexcept {
+        if (_Off >= _Mysize) {
+            return npos;
+        }
+
+        const size_type _Idx = traits_type::find_first_of(_Mydata + _Off, _Mysize - _Off, _Ptr, _Count);
+        return _Idx != npos ? _Idx + _Off : npos;
+    }
+
+    template <class _Elem>
+    typename string_view<_Elem>::size_type
+        string_view<_Elem>::find_first_of(const_pointer _Ptr, const size_type _Off) const noexcept {
+        return find_first_of(string_view{_Ptr}, _Off);
+    }
+
+    template <class _Elem>
+    typename string_view<_Elem>::size_type
+        string_view<_Elem>::find_last_of(const string_view _Str, const size_type _Off) const noexcept {
+        return find_last_of(_Str._Mydata, _Off, _Str._Mysize);
+    }
+
+    template <class _Elem>
+    typename string_view<_Elem>::size_type
+        string_view<_Elem>::find_last_of(const value_type _Ch, const size_type _Off) const noexcept {
+        return rfind(_Ch, _Off);
+    }
+
+    template <class _Elem>
+    typename string_view<_Elem>::size_type string_view<_Elem>::find_last_of(
+        const_pointer _Ptr, const size_type _Off, const size_type _Count) const noexcept {
+        if (_Mysize == 0) {
+            return npos;
+        }
+
+        // search only the characters at or before _Off
+        return traits_type::find_last_of(_Mydata, (::std::min)(_Off, _Mysize - 1) + 1, _Ptr, _Count);
+    }
+
+    template <class _Elem>
+    typename string_view<_Elem>::size_type
+        string_view<_Elem>::find_last_of(const_pointer _Ptr, const size_type _Off) const noexcept {
+        return find_last_of(string_view{_Ptr}, _Off);
+    }
+
+    template <class _Elem>
+    typename string_view<_Elem>::size_type
+        string_view<_Elem>::find_first_not_of(const string_view _Str, const size_type _Off) const noexcept {
+        return find_first_not_of(_Str._Mydata, _Off, _Str._Mysize);
+    }
+
+    template <class _Elem>
+    typename string_view<_Elem>::size_type
+        string_view<_Elem>::find_first_not_of(const value_type _Ch, const size_type _Off) const noexcept {
+        return find_first_not_of(&_Ch, _Off, 1);
+    }
+
+    template <class _Elem>
+    typename string_view<_Elem>::size_type string_view<_Elem>::find_first_not_of(
+        const_pointer _Ptr, const size_type _Off, const size_type _Count) const noexcept {
+        if (_Off >= _Mysize) {
+            return npos;
+        }
+
+        const size_type _Idx = traits_type::find_first_not_of(_Mydata + _Off, _Mysize - _Off, _Ptr, _Count);
+        return _Idx != npos ? _Idx + _Off : npos;
+    }
+
+    template <class _Elem>
+    typename string_view<_Elem>::size_type
+        string_view<_Elem>::find_first_not_of(const_pointer _Ptr, const size_type _Off) const noexcept {
+        return find_first_not_of(string_view{_Ptr}, _Off);
+    }
+
+    template <class _Elem>
+    typename string_view<_Elem>::size_type
+        string_view<_Elem>::find_last_not_of(const string_view _Str, const size_type _Off) const noexcept {
+        return find_last_not_of(_Str._Mydata, _Off, _Str._Mysize);
+    }
+
+    template <class _Elem>
+    typename string_view<_Elem>::size_type
+        string_view<_Elem>::find_last_not_of(const value_type _Ch, const size_type _Off) const noexcept {
+        return find_last_not_of(&_Ch, _Off, 1);
+    }
+
+    template <class _Elem>
+    typename string_view<_Elem>::size_type string_view<_Elem>::find_last_not_of(
+        const_pointer _Ptr, const size_type _Off, const size_type _Count) const noexcept {
+        if (_Mysize == 0) {
+            return npos;
+        }
+
+        // search only the characters at or before _Off
+        return traits_type::find_last_not_of(_Mydata, (::std::min)(_Off, _Mysize - 1) + 1, _Ptr, _Count);
+    }
+
+    template <class _Elem>
+    typename string_view<_Elem>::size_type
+        string_view<_Elem>::find_last_not_of(const_pointer _Ptr, const size_type _Off) const noexcept {
+        return find_last_not_of(string_view{_Ptr}, _Off);
+    }
+
     template class _MJSTR_API string_view<byte_t>;
     template class _MJSTR_API string_view<char>;
     template class _MJSTR_API string_view<wchar_t>;
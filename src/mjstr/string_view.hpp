@@ -22,51 +22,51 @@ namespace mjx {
         using reference         = const _Elem&;
         using iterator_category = ::std::random_access_iterator_tag;
 
-        string_view_iterator() noexcept;
+        _MJSTR_CONSTEXPR string_view_iterator() noexcept;
 #ifdef _DEBUG
-        string_view_iterator(pointer _First, pointer _Last) noexcept;
+        _MJSTR_CONSTEXPR string_view_iterator(pointer _First, pointer _Last) noexcept;
 #else // ^^^ _DEBUG ^^^ / vvv NDEBUG vvv
-        explicit string_view_iterator(pointer _Ptr) noexcept;
+        _MJSTR_CONSTEXPR explicit string_view_iterator(pointer _Ptr) noexcept;
 #endif // _DEBUG
 
         // returns the first character of the current substring
-        reference operator*() const noexcept;
+        _MJSTR_CONSTEXPR reference operator*() const noexcept;
 
         // returns the current substring
-        pointer operator->() const noexcept;
+        _MJSTR_CONSTEXPR pointer operator->() const noexcept;
 
         // returns the element at specified offset
-        reference operator[](const difference_type _Off) const noexcept;
+        _MJSTR_CONSTEXPR reference operator[](const difference_type _Off) const noexcept;
 
         // advances the iterator to the next element
-        string_view_iterator& operator++() noexcept;
+        _MJSTR_CONSTEXPR string_view_iterator& operator++() noexcept;
 
         // advances the iterator to the next element (performs post-incrementation)
-        string_view_iterator operator++(int) noexcept;
+        _MJSTR_CONSTEXPR string_view_iterator operator++(int) noexcept;
 
         // retreats the iterator to the previous element
-        string_view_iterator& operator--() noexcept;
+        _MJSTR_CONSTEXPR string_view_iterator& operator--() noexcept;
     
         // retreats the iterator to the previous element (performs post-decrementation)
-        string_view_iterator operator--(int) noexcept;
+        _MJSTR_CONSTEXPR string_view_iterator operator--(int) noexcept;
 
         // advances the iterator by _Off elements
-        string_view_iterator& operator+=(const difference_type _Off) noexcept;
+        _MJSTR_CONSTEXPR string_view_iterator& operator+=(const difference_type _Off) noexcept;
 
         // retreats the iterator by _Off elements
-        string_view_iterator& operator-=(const difference_type _Off) noexcept;
+        _MJSTR_CONSTEXPR string_view_iterator& operator-=(const difference_type _Off) noexcept;
 
         // returns a new iterator that is _Off elements ahead the current one
-        string_view_iterator operator+(const difference_type _Off) const noexcept;
+        _MJSTR_CONSTEXPR string_view_iterator operator+(const difference_type _Off) const noexcept;
 
         // returns a new iterator that is _Off elements behind the current one
-        string_view_iterator operator-(const difference_type _Off) const noexcept;
+        _MJSTR_CONSTEXPR string_view_iterator operator-(const difference_type _Off) const noexcept;
 
         // checks if two iterators are equal
-        bool operator==(const string_view_iterator& _Other) const noexcept;
+        _MJSTR_CONSTEXPR bool operator==(const string_view_iterator& _Other) const noexcept;
 
         // performs three-way comparison between two iterators
-        ::std::strong_ordering operator<=>(const string_view_iterator& _Other) const noexcept;
+        _MJSTR_CONSTEXPR ::std::strong_ordering operator<=>(const string_view_iterator& _Other) const noexcept;
 
     private:
         pointer _Myptr;
@@ -99,8 +99,8 @@ namespace mjx {
 
         static constexpr size_type npos = static_cast<size_type>(-1);
 
-        string_view() noexcept;
-        string_view(const_pointer _Ptr, const size_type _Count) noexcept;
+        _MJSTR_CONSTEXPR string_view() noexcept;
+        _MJSTR_CONSTEXPR string_view(const_pointer _Ptr, const size_type _Count) noexcept;
         string_view(const_pointer _Ptr) noexcept;
 
         string_view(const string_view&) noexcept            = default;
@@ -109,40 +109,40 @@ namespace mjx {
         string_view(::std::nullptr_t) = delete;
 
         // accesses the specified character
-        const_reference operator[](const size_type _Idx) const noexcept;
+        _MJSTR_CONSTEXPR const_reference operator[](const size_type _Idx) const noexcept;
 
         // returns an iterator to the beginning
-        const_iterator begin() const noexcept;
+        _MJSTR_CONSTEXPR const_iterator begin() const noexcept;
 
         // returns an iterator to the end
-        const_iterator end() const noexcept;
+        _MJSTR_CONSTEXPR const_iterator end() const noexcept;
 
         // accesses the specified character with bounds checking
         const_reference at(const size_type _Idx) const;
 
         // accesses the first character
-        const_reference front() const noexcept;
+        _MJSTR_CONSTEXPR const_reference front() const noexcept;
 
         // accesses the last character
-        const_reference back() const noexcept;
+        _MJSTR_CONSTEXPR const_reference back() const noexcept;
 
         // returns a pointer to the first character of a view
-        const_pointer data() const noexcept;
+        _MJSTR_CONSTEXPR const_pointer data() const noexcept;
 
         // returns the number of characters
-        size_type size() const noexcept;
+        _MJSTR_CONSTEXPR size_type size() const noexcept;
 
         // checks whether the view is empty
-        bool empty() const noexcept;
+        _MJSTR_CONSTEXPR bool empty() const noexcept;
 
         // shrinks the view by moving its start forward
-        void remove_prefix(const size_type _Count) noexcept;
+        _MJSTR_CONSTEXPR void remove_prefix(const size_type _Count) noexcept;
 
         // shrinks the view by moving its end backward
-        void remove_suffix(const size_type _Count) noexcept;
+        _MJSTR_CONSTEXPR void remove_suffix(const size_type _Count) noexcept;
 
         // swaps the contents
-        void swap(string_view& _Other) noexcept;
+        _MJSTR_CONSTEXPR void swap(string_view& _Other) noexcept;
 
         // copies characters
         size_type copy(pointer _Dest, size_type _Count, const size_type _Off = 0) const;
@@ -182,6 +182,30 @@ namespace mjx {
         size_type rfind(const_pointer _Ptr, const size_type _Off, const size_type _Count) const noexcept;
         size_type rfind(const_pointer _Ptr, const size_type _Off = npos) const noexcept;
 
+        // finds the first character equal to one of the given characters
+        size_type find_first_of(const string_view _Str, const size_type _Off = 0) const noexcept;
+        size_type find_first_of(const value_type _Ch, const size_type _Off = 0) const noexcept;
+        size_type find_first_of(const_pointer _Ptr, const size_type _Off, const size_type _Count) const noexcept;
+        size_type find_first_of(const_pointer _Ptr, const size_type _Off = 0) const noexcept;
+
+        // finds the last character equal to one of the given characters
+        size_type find_last_of(const string_view _Str, const size_type _Off = npos) const noexcept;
+        size_type find_last_of(const value_type _Ch, const size_type _Off = npos) const noexcept;
+        size_type find_last_of(const_pointer _Ptr, const size_type _Off, const size_type _Count) const noexcept;
+        size_type find_last_of(const_pointer _Ptr, const size_type _Off = npos) const noexcept;
+
+        // finds the first character equal to none of the given characters
+        size_type find_first_not_of(const string_view _Str, const size_type _Off = 0) const noexcept;
+        size_type find_first_not_of(const value_type _Ch, const size_type _Off = 0) const noexcept;
+        size_type find_first_not_of(const_pointer _Ptr, const size_type _Off, const size_type _Count) const noexcept;
+        size_type find_first_not_of(const_pointer _Ptr, const size_type _Off = 0) const noexcept;
+
+        // finds the last character equal to none of the given characters
+        size_type find_last_not_of(const string_view _Str, const size_type _Off = npos) const noexcept;
+        size_type find_last_not_of(const value_type _Ch, const size_type _Off = npos) const noexcept;
+        size_type find_last_not_of(const_pointer _Ptr, const size_type _Off, const size_type _Count) const noexcept;
+        size_type find_last_not_of(const_pointer _Ptr, const size_type _Off = npos) const noexcept;
+
     private:
         // throws an exception if offset is out of range
         void _Check_offset(const size_type _Off) const;
@@ -216,4 +240,7 @@ namespace mjx {
     }
 } // namespace mjx
 
+#ifdef _MJSTR_INLINE_ACCESSORS
+#include <mjstr/impl/string_view_inline.hpp>
+#endif // _MJSTR_INLINE_ACCESSORS
 #endif // _MJSTR_STRING_VIEW_HPP_
\ No newline at end of file
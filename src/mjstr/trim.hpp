@@ -0,0 +1,232 @@
+// trim.hpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#ifndef _MJSTR_TRIM_HPP_
+#define _MJSTR_TRIM_HPP_
+#include <cstddef>
+#include <mjstr/char_traits.hpp>
+#include <mjstr/impl/char_set.hpp>
+#include <mjstr/impl/char_traits.hpp>
+#include <mjstr/string.hpp>
+#include <mjstr/string_view.hpp>
+#include <type_traits>
+
+namespace mjx {
+    namespace mjstr_impl {
+        enum class _Trim_side : unsigned char {
+            _Left  = 1, // remove the leading characters
+            _Right = 2, // remove the trailing characters
+            _Both  = 3
+        };
+
+        constexpr bool _Trims(const _Trim_side _Side, const _Trim_side _Which) noexcept {
+            return (static_cast<unsigned char>(_Side) & static_cast<unsigned char>(_Which)) != 0;
+        }
+
+        template <class _Elem>
+        inline void _Trim_bounds(const _Elem* const _Ptr, const size_t _Size, const _Elem* const _Set,
+            const size_t _Set_size, const _Trim_side _Side, size_t& _First, size_t& _Last) noexcept {
+            // computes [_First, _Last), the characters left after removing the ones from the set
+            // Note: Most inputs aren't padded at all, so both ends are checked before the set is built.
+            //       The padding is then skipped by the SIMD char-set kernels, a block at a time.
+            _First = 0;
+            _Last  = _Size;
+            if (_Size == 0 || _Set_size == 0) { // nothing to remove
+                return;
+            }
+
+            using _Traits          = _Char_traits<_Elem>;
+            constexpr size_t _Npos = static_cast<size_t>(-1);
+            const bool _Left  = _Trims(_Side, _Trim_side::_Left) && _Traits::_Find(_Set, _Set_size, _Ptr[0]) != _Npos;
+            const bool _Right =
+                _Trims(_Side, _Trim_side::_Right) && _Traits::_Find(_Set, _Set_size, _Ptr[_Size - 1]) != _Npos;
+            if (!_Left && !_Right) { // the ends aren't from the set
+                return;
+            }
+
+            _Char_set _Chars;
+            _Build_char_set(_Chars, _Set, _Set_size);
+            if (_Left) {
+                const size_t _Pos = _Find_in_char_set<false>(_Ptr + 1, _Size - 1, _Chars, _Set);
+                if (_Pos == _Npos) { // only the characters from the set
+                    _First = _Size;
+                    return;
+                }
+
+                _First = _Pos + 1;
+            }
+
+            if (_Right) { // the last character is from the set, search the ones before it
+                const size_t _Pos = _Reverse_find_in_char_set<false>(_Ptr + _First, _Size - 1 - _First, _Chars, _Set);
+                _Last             = _Pos == _Npos ? _First : _First + _Pos + 1;
+            }
+        }
+
+        template <class _Elem>
+        inline string_view<_Elem> _Trim(const string_view<_Elem> _Str, const _Elem* const _Set,
+            const size_t _Set_size, const _Trim_side _Side) noexcept {
+            const _Elem* const _Ptr = _Str.data();
+            size_t _First;
+            size_t _Last;
+            _Trim_bounds(_Ptr, _Str.size(), _Set, _Set_size, _Side, _First, _Last);
+            return string_view<_Elem>{_Ptr + _First, _Last - _First};
+        }
+
+        template <class _Elem, size_t _InlineBytes>
+        inline void _Trim_in_place(string<_Elem, _InlineBytes>& _Str, const _Elem* const _Set,
+            const size_t _Set_size, const _Trim_side _Side) {
+            size_t _First;
+            size_t _Last;
+            _Trim_bounds(_Str.data(), _Str.size(), _Set, _Set_size, _Side, _First, _Last);
+            _Str.resize(_Last); // remove the trailing characters first, so fewer characters are moved
+            if (_First > 0) {
+                _Str.erase(0, _First);
+            }
+        }
+    } // namespace mjstr_impl
+
+    // checks whether _Ch is one of the ASCII whitespace characters (" \t\n\v\f\r")
+    template <class _Elem>
+        requires compatible_element<_Elem>
+    constexpr bool is_ascii_whitespace(const _Elem _Ch) noexcept {
+        using _Unsigned = ::std::make_unsigned_t<_Elem>;
+        return _Ch == static_cast<_Elem>(' ') || static_cast<_Unsigned>(static_cast<_Unsigned>(_Ch) - '\t') < 5;
+    }
+
+    // Note: The functions below remove the characters from _Set (ASCII whitespace if not specified).
+    //       The views returned by trim(), trim_left() and trim_right() refer to the characters of _Str.
+
+    // removes the leading and trailing characters
+    inline byte_string_view trim(const byte_string_view _Str, const byte_string_view _Set) noexcept {
+        return mjstr_impl::_Trim(_Str, _Set.data(), _Set.size(), mjstr_impl::_Trim_side::_Both);
+    }
+
+    inline utf8_string_view trim(const utf8_string_view _Str, const utf8_string_view _Set) noexcept {
+        return mjstr_impl::_Trim(_Str, _Set.data(), _Set.size(), mjstr_impl::_Trim_side::_Both);
+    }
+
+    inline unicode_string_view trim(const unicode_string_view _Str, const unicode_string_view _Set) noexcept {
+        return mjstr_impl::_Trim(_Str, _Set.data(), _Set.size(), mjstr_impl::_Trim_side::_Both);
+    }
+
+    inline byte_string_view trim(const byte_string_view _Str) noexcept {
+        return mjstr_impl::_Trim(_Str, mjstr_impl::_Whitespace_chars<byte_t>, mjstr_impl::_Whitespace_count,
+            mjstr_impl::_Trim_side::_Both);
+    }
+
+    inline utf8_string_view trim(const utf8_string_view _Str) noexcept {
+        return mjstr_impl::_Trim(
+            _Str, mjstr_impl::_Whitespace_chars<char>, mjstr_impl::_Whitespace_count, mjstr_impl::_Trim_side::_Both);
+    }
+
+    inline unicode_string_view trim(const unicode_string_view _Str) noexcept {
+        return mjstr_impl::_Trim(_Str, mjstr_impl::_Whitespace_chars<wchar_t>, mjstr_impl::_Whitespace_count,
+            mjstr_impl::_Trim_side::_Both);
+    }
+
+    // removes the leading characters
+    inline byte_string_view trim_left(const byte_string_view _Str, const byte_string_view _Set) noexcept {
+        return mjstr_impl::_Trim(_Str, _Set.data(), _Set.size(), mjstr_impl::_Trim_side::_Left);
+    }
+
+    inline utf8_string_view trim_left(const utf8_string_view _Str, const utf8_string_view _Set) noexcept {
+        return mjstr_impl::_Trim(_Str, _Set.data(), _Set.size(), mjstr_impl::_Trim_side::_Left);
+    }
+
+    inline unicode_string_view trim_left(const unicode_string_view _Str, const unicode_string_view _Set) noexcept {
+        return mjstr_impl::_Trim(_Str, _Set.data(), _Set.size(), mjstr_impl::_Trim_side::_Left);
+    }
+
+    inline byte_string_view trim_left(const byte_string_view _Str) noexcept {
+        return mjstr_impl::_Trim(_Str, mjstr_impl::_Whitespace_chars<byte_t>, mjstr_impl::_Whitespace_count,
+            mjstr_impl::_Trim_side::_Left);
+    }
+
+    inline utf8_string_view trim_left(const utf8_string_view _Str) noexcept {
+        return mjstr_impl::_Trim(
+            _Str, mjstr_impl::_Whitespace_chars<char>, mjstr_impl::_Whitespace_count, mjstr_impl::_Trim_side::_Left);
+    }
+
+    inline unicode_string_view trim_left(const unicode_string_view _Str) noexcept {
+        return mjstr_impl::_Trim(_Str, mjstr_impl::_Whitespace_chars<wchar_t>, mjstr_impl::_Whitespace_count,
+            mjstr_impl::_Trim_side::_Left);
+    }
+
+    // removes the trailing characters
+    inline byte_string_view trim_right(const byte_string_view _Str, const byte_string_view _Set) noexcept {
+        return mjstr_impl::_Trim(_Str, _Set.data(), _Set.size(), mjstr_impl::_Trim_side::_Right);
+    }
+
+    inline utf8_string_view trim_right(const utf8_string_view _Str, const utf8_string_view _Set) noexcept {
+        return mjstr_impl::_Trim(_Str, _Set.data(), _Set.size(), mjstr_impl::_Trim_side::_Right);
+    }
+
+    inline unicode_string_view trim_right(const unicode_string_view _Str, const unicode_string_view _Set) noexcept {
+        return mjstr_impl::_Trim(_Str, _Set.data(), _Set.size(), mjstr_impl::_Trim_side::_Right);
+    }
+
+    inline byte_string_view trim_right(const byte_string_view _Str) noexcept {
+        return mjstr_impl::_Trim(_Str, mjstr_impl::_Whitespace_chars<byte_t>, mjstr_impl::_Whitespace_count,
+            mjstr_impl::_Trim_side::_Right);
+    }
+
+    inline utf8_string_view trim_right(const utf8_string_view _Str) noexcept {
+        return mjstr_impl::_Trim(
+            _Str, mjstr_impl::_Whitespace_chars<char>, mjstr_impl::_Whitespace_count, mjstr_impl::_Trim_side::_Right);
+    }
+
+    inline unicode_string_view trim_right(const unicode_string_view _Str) noexcept {
+        return mjstr_impl::_Trim(_Str, mjstr_impl::_Whitespace_chars<wchar_t>, mjstr_impl::_Whitespace_count,
+            mjstr_impl::_Trim_side::_Right);
+    }
+
+    // removes the leading and trailing characters of a string in place, the capacity is unchanged
+    template <class _Elem, size_t _InlineBytes>
+    inline string<_Elem, _InlineBytes>& trim_in_place(
+        string<_Elem, _InlineBytes>& _Str, const ::std::type_identity_t<string_view<_Elem>> _Set) {
+        mjstr_impl::_Trim_in_place(_Str, _Set.data(), _Set.size(), mjstr_impl::_Trim_side::_Both);
+        return _Str;
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    inline string<_Elem, _InlineBytes>& trim_in_place(string<_Elem, _InlineBytes>& _Str) {
+        mjstr_impl::_Trim_in_place(
+            _Str, mjstr_impl::_Whitespace_chars<_Elem>, mjstr_impl::_Whitespace_count, mjstr_impl::_Trim_side::_Both);
+        return _Str;
+    }
+
+    // removes the leading characters of a string in place, the capacity is unchanged
+    template <class _Elem, size_t _InlineBytes>
+    inline string<_Elem, _InlineBytes>& trim_left_in_place(
+        string<_Elem, _InlineBytes>& _Str, const ::std::type_identity_t<string_view<_Elem>> _Set) {
+        mjstr_impl::_Trim_in_place(_Str, _Set.data(), _Set.size(), mjstr_impl::_Trim_side::_Left);
+        return _Str;
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    inline string<_Elem, _InlineBytes>& trim_left_in_place(string<_Elem, _InlineBytes>& _Str) {
+        mjstr_impl::_Trim_in_place(
+            _Str, mjstr_impl::_Whitespace_chars<_Elem>, mjstr_impl::_Whitespace_count, mjstr_impl::_Trim_side::_Left);
+        return _Str;
+    }
+
+    // removes the trailing characters of a string in place, the capacity is unchanged
+    template <class _Elem, size_t _InlineBytes>
+    inline string<_Elem, _InlineBytes>& trim_right_in_place(
+        string<_Elem, _InlineBytes>& _Str, const ::std::type_identity_t<string_view<_Elem>> _Set) {
+        mjstr_impl::_Trim_in_place(_Str, _Set.data(), _Set.size(), mjstr_impl::_Trim_side::_Right);
+        return _Str;
+    }
+
+    template <class _Elem, size_t _InlineBytes>
+    inline string<_Elem, _InlineBytes>& trim_right_in_place(string<_Elem, _InlineBytes>& _Str) {
+        mjstr_impl::_Trim_in_place(
+            _Str, mjstr_impl::_Whitespace_chars<_Elem>, mjstr_impl::_Whitespace_count, mjstr_impl::_Trim_side::_Right);
+        return _Str;
+    }
+} // namespace mjx
+
+#endif // _MJSTR_TRIM_HPP_
\ No newline at end of file
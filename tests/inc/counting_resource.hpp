@@ -0,0 +1,31 @@
+// counting_resource.hpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#ifndef _MJSTR_TESTS_COUNTING_RESOURCE_HPP_
+#define _MJSTR_TESTS_COUNTING_RESOURCE_HPP_
+#include <cstddef>
+#include <mjstr/memory_resource.hpp>
+
+namespace mjx {
+    class counting_resource : public memory_resource { // counts allocations, forwards to the global allocator
+    public:
+        size_t allocations   = 0;
+        size_t deallocations = 0;
+
+    private:
+        void* do_allocate(const size_t _Size) override {
+            ++allocations;
+            return global_memory_resource()->allocate(_Size);
+        }
+
+        void do_deallocate(void* const _Ptr, const size_t _Size) noexcept override {
+            ++deallocations;
+            global_memory_resource()->deallocate(_Ptr, _Size);
+        }
+    };
+} // namespace mjx
+
+#endif // _MJSTR_TESTS_COUNTING_RESOURCE_HPP_
\ No newline at end of file
@@ -0,0 +1,145 @@
+// test.cpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <mjstr/ascii_case.hpp>
+#include <mjstr/string.hpp>
+
+namespace mjx {
+    template <class _Elem>
+    _Elem naive_lower(const _Elem _Ch) noexcept {
+        return _Ch >= _Elem{'A'} && _Ch <= _Elem{'Z'} ? static_cast<_Elem>(_Ch + 32) : _Ch;
+    }
+
+    template <class _Elem>
+    string<_Elem> make_mixed(const size_t _Size) {
+        // letters of both cases mixed with the characters that surround the letter ranges
+        static constexpr char _Chars[] = "aZ@[`{zA0 -Q_q";
+        string<_Elem> _Result;
+        for (size_t _Idx = 0; _Idx < _Size; ++_Idx) {
+            _Result.push_back(static_cast<_Elem>(_Chars[(_Idx * 7) % 14]));
+        }
+
+        return _Result;
+    }
+
+    TEST(ascii_case, to_ascii_lower_upper) {
+        EXPECT_EQ(to_ascii_lower("Content-Type: TEXT/html"), "content-type: text/html");
+        EXPECT_EQ(to_ascii_upper("Content-Type: TEXT/html"), "CONTENT-TYPE: TEXT/HTML");
+        EXPECT_EQ(to_ascii_lower("@[`{"), "@[`{"); // the characters next to the letter ranges are unchanged
+        EXPECT_EQ(to_ascii_upper("@[`{"), "@[`{");
+        EXPECT_EQ(to_ascii_lower(""), "");
+
+        // non-ASCII characters are left unchanged
+        EXPECT_EQ(to_ascii_lower("\xC3\x89T\xC3\x89"), "\xC3\x89t\xC3\x89");
+        EXPECT_EQ(to_ascii_upper(L"stra\u00DFe \u00E9t\u00E9"), L"STRA\u00DFE \u00E9T\u00E9");
+        EXPECT_EQ(to_ascii_lower(L"\u0141A\u0161"), L"\u0141a\u0161");
+    }
+
+    TEST(ascii_case, in_place) {
+        utf8_string _Str = "X-Forwarded-For";
+        to_ascii_lower(_Str);
+        EXPECT_EQ(_Str, "x-forwarded-for");
+        to_ascii_upper(_Str);
+        EXPECT_EQ(_Str, "X-FORWARDED-FOR");
+
+        unicode_string _Wide = L"Accept-Encoding";
+        to_ascii_upper(_Wide);
+        EXPECT_EQ(_Wide, L"ACCEPT-ENCODING");
+
+        char _Buf[] = "MiXeD";
+        to_ascii_lower(_Buf, 3);
+        EXPECT_STREQ(_Buf, "mixeD");
+    }
+
+    TEST(ascii_case, long_inputs) {
+        // covers the SIMD blocks and the overlapping last block for every size
+        for (size_t _Size = 0; _Size < 100; ++_Size) {
+            const utf8_string _Narrow = make_mixed<char>(_Size);
+            const utf8_string _Lower  = to_ascii_lower(_Narrow);
+            utf8_string _Upper        = _Narrow;
+            to_ascii_upper(_Upper);
+            ASSERT_EQ(_Lower.size(), _Size);
+            for (size_t _Idx = 0; _Idx < _Size; ++_Idx) {
+                EXPECT_EQ(_Lower[_Idx], naive_lower(_Narrow[_Idx]));
+                EXPECT_EQ(naive_lower(_Upper[_Idx]), _Lower[_Idx]);
+                EXPECT_FALSE(_Upper[_Idx] >= 'a' && _Upper[_Idx] <= 'z');
+            }
+
+            const unicode_string _Wide = make_mixed<wchar_t>(_Size);
+            EXPECT_TRUE(iequals(to_ascii_lower(_Wide), to_ascii_upper(_Wide)));
+            EXPECT_TRUE(iequals(_Lower, _Upper));
+            EXPECT_EQ(icompare(_Lower, _Upper), 0);
+        }
+    }
+
+    TEST(ascii_case, iequals) {
+        EXPECT_TRUE(iequals("Content-Length", "content-length"));
+        EXPECT_TRUE(iequals("", ""));
+        EXPECT_FALSE(iequals("Content-Length", "content-lengt"));
+        EXPECT_FALSE(iequals("@", "`")); // differ by 0x20, but aren't letters
+        EXPECT_FALSE(iequals("[", "{"));
+        EXPECT_TRUE(iequals(L"HOST", L"host"));
+        EXPECT_FALSE(iequals(L"\u0141", L"\u0161")); // non-ASCII letters are compared exactly
+        EXPECT_FALSE(iequals("\xC9", "\xE9"));
+
+        const utf8_string _Long = make_mixed<char>(77);
+        utf8_string _Other      = to_ascii_upper(_Long);
+        EXPECT_TRUE(iequals(_Long, _Other));
+        _Other[70] = '!';
+        EXPECT_FALSE(iequals(_Long, _Other));
+    }
+
+    TEST(ascii_case, icompare) {
+        EXPECT_EQ(icompare("abc", "ABC"), 0);
+        EXPECT_LT(icompare("abc", "ABD"), 0);
+        EXPECT_GT(icompare("ABD", "abc"), 0);
+        EXPECT_LT(icompare("ab", "ABC"), 0);
+        EXPECT_GT(icompare("ABC", "ab"), 0);
+        EXPECT_LT(icompare("", "a"), 0);
+        EXPECT_GT(icompare("Z", "_"), 0); // compared as lowercase, 'z' > '_'
+        EXPECT_GT(icompare(L"\u0100", L"a"), 0);
+
+        const utf8_string _Long = make_mixed<char>(50);
+        utf8_string _Other      = _Long;
+        _Other[40]              = '~';
+        EXPECT_LT(icompare(_Long, _Other), 0);
+        EXPECT_GT(icompare(_Other, _Long), 0);
+    }
+
+    TEST(ascii_case, ifind) {
+        EXPECT_EQ(ifind("Transfer-Encoding: Chunked", "chunked"), 19);
+        EXPECT_EQ(ifind("Transfer-Encoding: Chunked", "ENCODING"), 9);
+        EXPECT_EQ(ifind("abc", "D"), utf8_string_view::npos);
+        EXPECT_EQ(ifind("abc", "ABCD"), utf8_string_view::npos);
+        EXPECT_EQ(ifind("abc", ""), 0);
+        EXPECT_EQ(ifind("abc", "", 3), 3);
+        EXPECT_EQ(ifind("abc", "", 4), utf8_string_view::npos);
+        EXPECT_EQ(ifind("aXa", "A", 1), 2);
+        EXPECT_EQ(ifind("@`", "`"), 1);
+        EXPECT_EQ(ifind(L"keep-ALIVE, Upgrade", L"upgrade"), 12);
+
+        // long haystacks use the SIMD kernels, the match may be anywhere
+        for (size_t _Pos = 0; _Pos < 90; ++_Pos) {
+            utf8_string _Haystack(100, 'a');
+            _Haystack.replace(_Pos, 5, "NEEDL");
+            EXPECT_EQ(ifind(_Haystack, "needl"), _Pos);
+            EXPECT_EQ(ifind(_Haystack, "aNeEdLa"), _Pos > 0 ? _Pos - 1 : utf8_string_view::npos);
+
+            unicode_string _Wide(100, L'a');
+            _Wide.replace(_Pos, 2, L"Zz");
+            EXPECT_EQ(ifind(_Wide, L"zZ"), _Pos);
+        }
+    }
+
+    TEST(ascii_case, istarts_with) {
+        EXPECT_TRUE(istarts_with("HTTP/1.1 200 OK", "http/"));
+        EXPECT_TRUE(istarts_with("abc", ""));
+        EXPECT_FALSE(istarts_with("ab", "abc"));
+        EXPECT_FALSE(istarts_with("HTTP", "HTTPS"));
+        EXPECT_TRUE(istarts_with(L"Bearer token", L"BEARER "));
+        EXPECT_FALSE(istarts_with(byte_string_view{}, byte_string_view{reinterpret_cast<const byte_t*>("a"), 1}));
+    }
+} // namespace mjx
\ No newline at end of file
@@ -5,6 +5,7 @@
 
 #include <gtest/gtest.h>
 #include <mjstr/char_traits.hpp>
+#include <mjstr/string.hpp>
 #include <mjstr/string_view.hpp>
 
 namespace mjx {
@@ -106,4 +107,120 @@ namespace mjx {
         EXPECT_EQ(_Traits::rfind("AB CD AB CD", 11, "AB", 2), 6);
         EXPECT_EQ(_Traits::rfind("AB CD AB CD", 11, "ABC", 3), _Npos);
     }
+
+    template <class _Elem>
+    void _Test_search_at_every_position(const _Elem _Fill, const _Elem* const _Needle, const size_t _Needle_size) {
+        // place the needle at every position of a haystack that spans several SIMD blocks
+        using _Traits          = char_traits<_Elem>;
+        constexpr size_t _Size = 200;
+        for (size_t _Pos = 0; _Pos <= _Size - _Needle_size; ++_Pos) {
+            string<_Elem> _Haystack(_Size, _Fill);
+            _Traits::copy(_Haystack.data() + _Pos, _Needle, _Needle_size);
+            EXPECT_EQ(_Traits::find(_Haystack.data(), _Size, _Needle, _Needle_size), _Pos);
+            EXPECT_EQ(_Traits::rfind(_Haystack.data(), _Size, _Needle, _Needle_size), _Pos);
+
+            // the needle must not be found if it crosses the end of the searched range
+            EXPECT_EQ(_Traits::find(_Haystack.data(), _Pos + _Needle_size - 1, _Needle, _Needle_size),
+                static_cast<size_t>(-1));
+            EXPECT_EQ(_Traits::rfind(_Haystack.data(), _Pos + _Needle_size - 1, _Needle, _Needle_size),
+                static_cast<size_t>(-1));
+        }
+    }
+
+    TEST(char_traits, find_long) {
+        // the first and the last character of the needle appear in the haystack as well
+        _Test_search_at_every_position('a', "ab", 2);
+        _Test_search_at_every_position('a', "abba", 4);
+        _Test_search_at_every_position('a', "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaab", 39);
+        _Test_search_at_every_position(L'a', L"xy", 2);
+        _Test_search_at_every_position(L'a', L"abba", 4);
+        _Test_search_at_every_position(L'\x1234', L"\x1234\x5678\x1234", 3);
+    }
+
+    TEST(char_traits, rfind_long) {
+        using _Traits          = char_traits<char>;
+        const utf8_string _Str = utf8_string(100, '-') + "needle" + utf8_string(100, '-') + "needle";
+        EXPECT_EQ(_Traits::rfind(_Str.data(), _Str.size(), "needle", 6), 206);
+        EXPECT_EQ(_Traits::rfind(_Str.data(), 205, "needle", 6), 100);
+        EXPECT_EQ(_Traits::rfind(_Str.data(), _Str.size(), '-'), 205);
+        EXPECT_EQ(_Traits::rfind(_Str.data(), 100, 'n'), static_cast<size_t>(-1));
+    }
+    TEST(char_traits, find_periodic) {
+        // every position passes the SIMD filter and fails in the middle, which switches to the Two-Way search
+        using _Traits             = char_traits<char>;
+        const utf8_string _Needle = utf8_string(50, 'a') + 'b' + utf8_string(50, 'a');
+        utf8_string _Haystack(100000, 'a');
+        EXPECT_EQ(_Traits::find(_Haystack.data(), _Haystack.size(), _Needle.data(), _Needle.size()),
+            static_cast<size_t>(-1));
+        EXPECT_EQ(_Traits::rfind(_Haystack.data(), _Haystack.size(), _Needle.data(), _Needle.size()),
+            static_cast<size_t>(-1));
+
+        // place the needle close to both ends, so that it's found only after the switch
+        _Haystack[99900] = 'b';
+        EXPECT_EQ(_Traits::find(_Haystack.data(), _Haystack.size(), _Needle.data(), _Needle.size()), 99850);
+        EXPECT_EQ(_Traits::rfind(_Haystack.data(), _Haystack.size(), _Needle.data(), _Needle.size()), 99850);
+        _Haystack[99900] = 'a';
+        _Haystack[70]    = 'b';
+        EXPECT_EQ(_Traits::find(_Haystack.data(), _Haystack.size(), _Needle.data(), _Needle.size()), 20);
+        EXPECT_EQ(_Traits::rfind(_Haystack.data(), _Haystack.size(), _Needle.data(), _Needle.size()), 20);
+    }
+
+    template <class _Elem>
+    void _Test_char_set_search(const _Elem* const _Set, const size_t _Set_size, const _Elem _Other) {
+        // compares the results with a naive search, members are placed at every position of haystacks
+        // that span several SIMD blocks and end within a block
+        using _Traits            = char_traits<_Elem>;
+        constexpr size_t _Npos   = static_cast<size_t>(-1);
+        const auto _Is_member    = [&](const _Elem _Ch) {
+            return _Traits::find(_Set, _Set_size, _Ch) != _Npos;
+        };
+        const auto _Naive_search = [&](const string<_Elem>& _Str, const bool _Member, const bool _Reverse) {
+            for (size_t _Idx = 0; _Idx < _Str.size(); ++_Idx) {
+                const size_t _Pos = _Reverse ? _Str.size() - 1 - _Idx : _Idx;
+                if (_Is_member(_Str[_Pos]) == _Member) {
+                    return _Pos;
+                }
+            }
+
+            return _Npos;
+        };
+
+        for (size_t _Size = 0; _Size <= 70; ++_Size) {
+            for (size_t _Pos = 0; _Pos <= _Size; ++_Pos) {
+                // a run of non-members with one member and a run of members with one non-member
+                string<_Elem> _Str0(_Size, _Other);
+                string<_Elem> _Str1(_Size, _Set_size > 0 ? _Set[0] : _Other);
+                if (_Pos < _Size && _Set_size > 0) {
+                    _Str0[_Pos] = _Set[_Pos % _Set_size];
+                    _Str1[_Pos] = _Other;
+                }
+
+                for (const string<_Elem>& _Str : {_Str0, _Str1}) {
+                    const _Elem* const _Ptr = _Str.data();
+                    EXPECT_EQ(_Traits::find_first_of(_Ptr, _Size, _Set, _Set_size), _Naive_search(_Str, true, false));
+                    EXPECT_EQ(_Traits::find_last_of(_Ptr, _Size, _Set, _Set_size), _Naive_search(_Str, true, true));
+                    EXPECT_EQ(
+                        _Traits::find_first_not_of(_Ptr, _Size, _Set, _Set_size), _Naive_search(_Str, false, false));
+                    EXPECT_EQ(
+                        _Traits::find_last_not_of(_Ptr, _Size, _Set, _Set_size), _Naive_search(_Str, false, true));
+                }
+            }
+        }
+    }
+
+    TEST(char_traits, find_of) {
+        // sets handled by every kernel, including bytes with the top bit set
+        _Test_char_set_search("", 0, 'x');
+        _Test_char_set_search(",", 1, 'x');
+        _Test_char_set_search(" \t\r\n", 4, 'x');
+        _Test_char_set_search("0123456789abcdef", 16, 'x');
+        _Test_char_set_search("\x80\xFF\x7F\x01", 4, '\x81');
+        _Test_char_set_search("xyz", 3, '\xF8');
+        _Test_char_set_search(reinterpret_cast<const byte_t*>("\x00\x10\x90\xF0"), 4, byte_t{0x11});
+
+        // wide characters, some of them don't fit in a byte
+        _Test_char_set_search(L" \t", 2, L'x');
+        _Test_char_set_search(L"\x1234\x5678,", 3, L'\x1235');
+        _Test_char_set_search(L"\x34\x78", 2, L'\x1234');
+    }
 } // namespace mjx
\ No newline at end of file
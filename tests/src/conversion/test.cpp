@@ -68,6 +68,27 @@ namespace mjx {
             "\xF0\x9F\x8E\xA4\xF0\x9F\x8E\xA5\xF0\x9F\x8E\xA6\xF0\x9F\x8E\xA7\xF0\x9F\x8E\xA8");
     }
 
+    TEST(unicode_utf8, ascii_blocks) {
+        // long ASCII text is converted in blocks, place a multibyte character at every position
+        for (size_t _Pos = 0; _Pos < 100; ++_Pos) {
+            unicode_string _Unicode(100, L'a');
+            utf8_string _Utf8(100, 'a');
+            _Unicode[_Pos] = L'\u00E9';
+            _Utf8.replace(_Pos, 1, "\xC3\xA9");
+            test_unicode_utf8(_Unicode.c_str(), _Utf8.c_str());
+        }
+    }
+
+    TEST(unicode_utf8, capacity) {
+        // the worst case buffer is released if most of it is unused
+        const utf8_string _Ascii = ::mjx::to_utf8_string(unicode_string(10'000, L'a'));
+        EXPECT_EQ(_Ascii.size(), 10'000);
+        EXPECT_LE(_Ascii.capacity(), 2 * _Ascii.size());
+        const utf8_string _Multibyte = ::mjx::to_utf8_string(unicode_string(10'000, L'\u4F60'));
+        EXPECT_EQ(_Multibyte.size(), 30'000);
+        EXPECT_LE(_Multibyte.capacity(), 2 * _Multibyte.size());
+    }
+
     TEST(invalid_utf8, two_bytes) {
         test_invalid_utf8("\xC0\x80\xC1\x81\xC2\x82");
         test_invalid_utf8("\xC2\x20\xC3\x30\xC4\x40");
@@ -85,6 +106,146 @@ namespace mjx {
         test_invalid_utf8("\xF1\x20\x80\x80\xF2\x30\x81\x81\xF3\x40\x82\x82");
         test_invalid_utf8("\xF1\x80\x80\xF2\x81\x81\xF3\x82\x82");
     }
+
+    TEST(invalid_utf8, out_of_range) {
+        test_invalid_utf8("\xED\xA0\x80"); // U+D800 (surrogate)
+        test_invalid_utf8("\xED\xBF\xBF"); // U+DFFF (surrogate)
+        test_invalid_utf8("\xF4\x90\x80\x80"); // U+110000
+        test_invalid_utf8("\xF7\xBF\xBF\xBF"); // U+1FFFFF
+    }
+
+    TEST(invalid_utf8, after_ascii_block) {
+        // the invalid sequence follows a run of ASCII characters that is converted in blocks
+        utf8_string _Bytes(70, 'a');
+        _Bytes.append("\xE1\x80");
+        test_invalid_utf8(_Bytes.c_str());
+    }
+
+    TEST(invalid_unicode, surrogate) {
+        // lone surrogates can't be encoded
+        EXPECT_TRUE(::mjx::to_utf8_string(L"a\xD800").empty());
+        EXPECT_TRUE(::mjx::to_utf8_string(L"\xDFFF" L"a").empty());
+        EXPECT_EQ(::mjx::to_utf8_string_length(L"\xDC00"), static_cast<size_t>(-1));
+    }
+
+    inline void test_validate_utf8(const char* const _Bytes, const size_t _Offset, const utf8_error _Error) {
+        const utf8_validation_result _Result = ::mjx::validate_utf8(_Bytes);
+        EXPECT_EQ(_Result.offset, _Offset);
+        EXPECT_EQ(_Result.error, _Error);
+    }
+
+    TEST(validate_utf8, valid) {
+        test_validate_utf8("", 0, utf8_error::none);
+        test_validate_utf8("abc", 3, utf8_error::none);
+        test_validate_utf8("\xC2\x80\xDF\xBF", 4, utf8_error::none);
+        test_validate_utf8("\xE0\xA0\x80\xED\x9F\xBF\xEE\x80\x80\xEF\xBF\xBF", 12, utf8_error::none);
+        test_validate_utf8("\xF0\x90\x80\x80\xF4\x8F\xBF\xBF", 8, utf8_error::none);
+    }
+
+    TEST(validate_utf8, errors) {
+        test_validate_utf8("ab\x80", 2, utf8_error::unexpected_continuation);
+        test_validate_utf8("a\xF8\x80\x80\x80", 1, utf8_error::invalid_leading_byte);
+        test_validate_utf8("a\xFF", 1, utf8_error::invalid_leading_byte);
+        test_validate_utf8("\xC3\xA9\xE1\x80" "a", 2, utf8_error::missing_continuation);
+        test_validate_utf8("abc\xF0\x9F\x98", 3, utf8_error::incomplete_sequence);
+        test_validate_utf8("\xC0\x80", 0, utf8_error::overlong_encoding);
+        test_validate_utf8("a\xE0\x9F\xBF", 1, utf8_error::overlong_encoding);
+        test_validate_utf8("\xF0\x8F\xBF\xBF", 0, utf8_error::overlong_encoding);
+        test_validate_utf8("a\xED\xA0\x80", 1, utf8_error::surrogate);
+        test_validate_utf8("\xF4\x90\x80\x80", 0, utf8_error::code_point_too_big);
+        test_validate_utf8("\xF5\x80\x80\x80", 0, utf8_error::code_point_too_big);
+    }
+
+    TEST(validate_utf8, error_in_long_input) {
+        // the input is validated in blocks, place an invalid sequence at every position of mixed text
+        const utf8_string _Text = "abc\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80";
+        utf8_string _Valid;
+        while (_Valid.size() < 200) {
+            _Valid += _Text;
+        }
+
+        EXPECT_EQ(::mjx::validate_utf8(_Valid).error, utf8_error::none);
+        for (size_t _Pos = 0; _Pos <= _Valid.size(); ++_Pos) {
+            if (_Pos < _Valid.size() && (static_cast<unsigned char>(_Valid[_Pos]) & 0xC0) == 0x80) {
+                continue; // not a character boundary
+            }
+
+            utf8_string _Bytes = _Valid;
+            _Bytes.insert(_Pos, "\xED\xA0\x80");
+            const utf8_validation_result _Result = ::mjx::validate_utf8(_Bytes);
+            EXPECT_EQ(_Result.offset, _Pos);
+            EXPECT_EQ(_Result.error, utf8_error::surrogate);
+        }
+    }
+
+    inline void test_conversion_result(const conversion_result& _Result,
+        const size_t _Read, const size_t _Written, const conversion_status _Status) {
+        EXPECT_EQ(_Result.read, _Read);
+        EXPECT_EQ(_Result.written, _Written);
+        EXPECT_EQ(_Result.status, _Status);
+    }
+
+    TEST(convert_into, buffer) {
+        char _Utf8[16];
+        test_conversion_result(
+            ::mjx::convert_into(L"caf\u00E9", _Utf8, sizeof(_Utf8)), 4, 5, conversion_status::ok);
+        EXPECT_EQ(utf8_string_view(_Utf8, 5), "caf\xC3\xA9");
+
+        wchar_t _Unicode[16];
+        test_conversion_result(::mjx::convert_into("caf\xC3\xA9", _Unicode, 16), 5, 4, conversion_status::ok);
+        EXPECT_EQ(unicode_string_view(_Unicode, 4), L"caf\u00E9");
+
+        byte_t _Bytes[16];
+        test_conversion_result(::mjx::convert_into("caf\xC3\xA9", _Bytes, 16), 5, 5, conversion_status::ok);
+        test_conversion_result(::mjx::convert_into(L"", _Bytes, 0), 0, 0, conversion_status::ok);
+    }
+
+    TEST(convert_into, destination_full) {
+        // characters are never split, the conversion can be resumed after the last read character
+        char _Utf8[4];
+        test_conversion_result(
+            ::mjx::convert_into(L"ab\u20ACc", _Utf8, sizeof(_Utf8)), 2, 2, conversion_status::destination_full);
+        test_conversion_result(
+            ::mjx::convert_into(L"\u20ACc", _Utf8, sizeof(_Utf8)), 2, 4, conversion_status::ok);
+
+        wchar_t _Unicode[2];
+        test_conversion_result(
+            ::mjx::convert_into("a\xC3\xA9" "bc", _Unicode, 2), 3, 2, conversion_status::destination_full);
+
+        byte_t _Bytes[3];
+        test_conversion_result(
+            ::mjx::convert_into("ab\xE2\x82\xAC", _Bytes, 3), 2, 2, conversion_status::destination_full);
+    }
+
+    TEST(convert_into, invalid_input) {
+        // the valid characters before the invalid one are converted
+        wchar_t _Unicode[16];
+        test_conversion_result(
+            ::mjx::convert_into("ab\xC3\xA9\xFF" "c", _Unicode, 16), 4, 3, conversion_status::invalid_input);
+        EXPECT_EQ(unicode_string_view(_Unicode, 3), L"ab\u00E9");
+
+        char _Utf8[16];
+        test_conversion_result(
+            ::mjx::convert_into(L"ab\xD800", _Utf8, sizeof(_Utf8)), 2, 2, conversion_status::invalid_input);
+    }
+
+    TEST(convert_into, spare_capacity) {
+        // the converted characters are appended without reallocating the string
+        utf8_string _Utf8 = "prefix ";
+        _Utf8.reserve(64);
+        const char* const _Old_data = _Utf8.data();
+        test_conversion_result(::mjx::convert_into(L"caf\u00E9", _Utf8), 4, 5, conversion_status::ok);
+        EXPECT_EQ(_Utf8, "prefix caf\xC3\xA9");
+        EXPECT_EQ(_Utf8.data(), _Old_data);
+
+        unicode_string _Unicode;
+        const size_t _Capacity = _Unicode.capacity();
+        const utf8_string _Long(_Capacity + 10, 'a');
+        test_conversion_result(::mjx::convert_into(_Long, _Unicode), _Capacity, _Capacity,
+            conversion_status::destination_full);
+        EXPECT_EQ(_Unicode, unicode_string(_Capacity, L'a'));
+        EXPECT_EQ(_Unicode.capacity(), _Capacity);
+    }
 } // namespace mjx
 
 #ifdef _MJX_MSVC
@@ -0,0 +1,111 @@
+// test.cpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <mjstr/hash.hpp>
+#include <mjstr/impl/hash_long.hpp>
+#include <mjstr/string.hpp>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace mjx {
+    TEST(hash, consistency) {
+        // equal contents always have equal hashes, no matter how the string is stored
+        const utf8_string _Str = "a key that doesn't fit in the small buffer";
+        const small_utf8_string<64> _Small(_Str.view());
+        EXPECT_EQ(hash(_Str), hash(_Str.view()));
+        EXPECT_EQ(hash(_Str), hash(_Small));
+        EXPECT_EQ(hash(_Str), hash("a key that doesn't fit in the small buffer"));
+        EXPECT_EQ(::std::hash<utf8_string>{}(_Str), ::std::hash<utf8_string_view>{}(_Str.view()));
+        EXPECT_EQ(::std::hash<small_utf8_string<64>>{}(_Small), utf8_string_hash{}(_Str));
+        EXPECT_EQ(::std::hash<unicode_string>{}(L"wide"), unicode_string_hash{}(L"wide"));
+
+        // the seed changes the hash
+        EXPECT_NE(hash(_Str, 1), hash(_Str, 2));
+    }
+
+    TEST(hash, distribution) {
+        // every length up to several blocks and every single-byte change produce a different hash
+        utf8_string _Str;
+        ::std::unordered_set<uint64_t> _Hashes;
+        for (size_t _Size = 0; _Size < 4200; ++_Size) {
+            EXPECT_TRUE(_Hashes.insert(hash(_Str)).second) << "size " << _Size;
+            _Str.push_back(static_cast<char>('a' + _Size % 26));
+        }
+
+        const uint64_t _Original = hash(_Str);
+        for (size_t _Idx = 0; _Idx < _Str.size(); _Idx += 31) {
+            _Str[_Idx] ^= 1;
+            EXPECT_NE(hash(_Str), _Original) << "index " << _Idx;
+            _Str[_Idx] ^= 1;
+        }
+
+        EXPECT_EQ(hash(_Str), _Original);
+
+        // swapping two 64-byte stripes changes the hash
+        utf8_string _Swapped = _Str;
+        _Swapped.replace(0, 64, _Str.view().substr(64, 64));
+        _Swapped.replace(64, 64, _Str.view().substr(0, 64));
+        EXPECT_NE(hash(_Swapped), _Original);
+    }
+
+    TEST(hash, multiply128) {
+        // the portable product (used on x86) matches the 128-bit one
+        const uint64_t _Values[] = {0, 1, 0xFFFF'FFFF, 0x1'0000'0000, 0xFFFF'FFFF'FFFF'FFFF, mjstr_impl::_Hash_p0,
+            mjstr_impl::_Hash_p1, mjstr_impl::_Hash_p2, mjstr_impl::_Hash_p3, 0x8000'0000'0000'0001};
+        for (const uint64_t _Left : _Values) {
+            for (const uint64_t _Right : _Values) {
+                uint64_t _Low           = _Left;
+                uint64_t _High          = _Right;
+                uint64_t _Portable_low  = _Left;
+                uint64_t _Portable_high = _Right;
+                mjstr_impl::_Multiply128(_Low, _High);
+                mjstr_impl::_Multiply128_portable(_Portable_low, _Portable_high);
+                EXPECT_EQ(_Portable_low, _Low);
+                EXPECT_EQ(_Portable_high, _High);
+                EXPECT_EQ(_Low, _Left * _Right);
+            }
+        }
+    }
+
+    TEST(hash, accumulate_kernels) {
+        // every instruction set the CPU supports produces the same hash as the scalar code
+        utf8_string _Str;
+        uint64_t _State = 1;
+        for (size_t _Idx = 0; _Idx < 10'000; ++_Idx) {
+            _State = _State * 6364136223846793005ull + 1442695040888963407ull;
+            _Str.push_back(static_cast<char>(_State >> 56));
+        }
+
+        const mjstr_impl::_Isa_level _Level = mjstr_impl::_Get_isa_level();
+        const unsigned char* const _Ptr     = reinterpret_cast<const unsigned char*>(_Str.data());
+        for (const size_t _Size : {1025, 1088, 1089, 2048, 4097, 10'000}) {
+            const uint64_t _Scalar = mjstr_impl::_Hash_long(_Ptr, _Size, 7, &mjstr_impl::_Accumulate_scalar);
+            if (_Level >= mjstr_impl::_Isa_level::_Sse2) {
+                EXPECT_EQ(mjstr_impl::_Hash_long(_Ptr, _Size, 7, &mjstr_impl::_Accumulate_sse2), _Scalar)
+                    << "size " << _Size;
+            }
+
+            if (_Level >= mjstr_impl::_Isa_level::_Avx2) {
+                EXPECT_EQ(mjstr_impl::_Hash_long(_Ptr, _Size, 7, &mjstr_impl::_Accumulate_avx2), _Scalar)
+                    << "size " << _Size;
+            }
+        }
+    }
+
+    TEST(hash, heterogeneous_lookup) {
+        // strings can be looked up by views and C-strings without creating temporary strings
+        ::std::unordered_map<utf8_string, int, utf8_string_hash, utf8_string_equal> _Map;
+        _Map.emplace("first", 1);
+        _Map.emplace("second", 2);
+        EXPECT_EQ(_Map.find(utf8_string_view{"first"})->second, 1);
+        EXPECT_EQ(_Map.find("second")->second, 2);
+        EXPECT_EQ(_Map.find(utf8_string_view{"third"}), _Map.end());
+
+        ::std::unordered_set<unicode_string> _Set{L"wide", L"keys"};
+        EXPECT_TRUE(_Set.contains(L"keys"));
+        EXPECT_FALSE(_Set.contains(L"other"));
+    }
+} // namespace mjx
\ No newline at end of file
@@ -0,0 +1,108 @@
+// test.cpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <counting_resource.hpp>
+#include <gtest/gtest.h>
+#include <mjstr/intern_pool.hpp>
+#include <mjstr/string.hpp>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace mjx {
+    TEST(intern_pool, intern) {
+        utf8_intern_pool _Pool;
+        EXPECT_TRUE(_Pool.empty());
+
+        // equal values share the storage, so their handles compare equal by address
+        const utf8_string _Value         = "content-type";
+        const utf8_interned_string _Str0 = _Pool.intern("content-type");
+        const utf8_interned_string _Str1 = _Pool.intern(_Value);
+        const utf8_interned_string _Str2 = _Pool.intern("content-length");
+        EXPECT_EQ(_Str0, _Str1);
+        EXPECT_EQ(_Str0.data(), _Str1.data());
+        EXPECT_NE(_Str0, _Str2);
+        EXPECT_NE(_Str0.data(), _Value.data());
+        EXPECT_EQ(_Str0.view(), "content-type");
+        EXPECT_EQ(utf8_string_view{_Str2}, "content-length");
+        EXPECT_EQ(_Pool.size(), 2);
+
+        // the empty value is never stored
+        EXPECT_EQ(_Pool.intern(""), utf8_interned_string{});
+        EXPECT_TRUE(_Pool.intern("").empty());
+        EXPECT_EQ(_Pool.size(), 2);
+
+        // find() never stores the value
+        EXPECT_EQ(_Pool.find("content-type"), _Str0);
+        EXPECT_EQ(_Pool.find("content-encoding"), utf8_interned_string{});
+        EXPECT_EQ(_Pool.size(), 2);
+
+        // handles can be used as keys of unordered containers
+        ::std::unordered_set<utf8_interned_string> _Set{_Str0, _Str1, _Str2};
+        EXPECT_EQ(_Set.size(), 2);
+
+        unicode_intern_pool _Wide_pool;
+        EXPECT_EQ(_Wide_pool.intern(L"label"), _Wide_pool.intern(unicode_string{L"label"}));
+        EXPECT_EQ(_Wide_pool.intern(L"label").view(), L"label");
+    }
+
+    TEST(intern_pool, growth) {
+        // the handles stay valid while the tables grow
+        counting_resource _Resource;
+        {
+            utf8_intern_pool _Pool(&_Resource);
+            EXPECT_EQ(_Pool.get_memory_resource(), &_Resource);
+            ::std::vector<utf8_interned_string> _Handles;
+            for (size_t _Idx = 0; _Idx < 10000; ++_Idx) {
+                _Handles.push_back(_Pool.intern(utf8_string{"token_"} + utf8_string(_Idx % 7, 'x')
+                                                + static_cast<char>('a' + _Idx % 26) + utf8_string(_Idx / 26, '.')));
+            }
+
+            EXPECT_EQ(_Pool.size(), 10000);
+            for (size_t _Idx = 0; _Idx < 10000; ++_Idx) {
+                const utf8_string _Value = utf8_string{"token_"} + utf8_string(_Idx % 7, 'x')
+                                         + static_cast<char>('a' + _Idx % 26) + utf8_string(_Idx / 26, '.');
+                EXPECT_EQ(_Handles[_Idx].view(), _Value);
+                EXPECT_EQ(_Pool.intern(_Value), _Handles[_Idx]);
+            }
+
+            EXPECT_EQ(_Pool.size(), 10000);
+        }
+
+        EXPECT_EQ(_Resource.allocations, _Resource.deallocations);
+    }
+
+    TEST(intern_pool, concurrency) {
+        // all threads intern the same values, every value must be stored once
+        constexpr size_t _Thread_count = 8;
+        constexpr size_t _Value_count  = 5000;
+        utf8_intern_pool _Pool;
+        ::std::vector<::std::vector<utf8_interned_string>> _Handles(_Thread_count);
+        ::std::vector<::std::thread> _Threads;
+        for (size_t _Thread = 0; _Thread < _Thread_count; ++_Thread) {
+            _Threads.emplace_back([&_Pool, &_Handles, _Thread] {
+                for (size_t _Idx = 0; _Idx < _Value_count; ++_Idx) {
+                    // every thread starts at a different value to make the insertions race
+                    const size_t _Value = (_Idx + _Thread * 613) % _Value_count;
+                    _Handles[_Thread].push_back(
+                        _Pool.intern(utf8_string{"metric."} + utf8_string(_Value % 13 + 1, 'm')
+                                     + static_cast<char>('A' + _Value % 26) + utf8_string(_Value / 26, '_')));
+                }
+            });
+        }
+
+        for (::std::thread& _Thread : _Threads) {
+            _Thread.join();
+        }
+
+        EXPECT_EQ(_Pool.size(), _Value_count);
+        for (size_t _Thread = 1; _Thread < _Thread_count; ++_Thread) {
+            for (size_t _Idx = 0; _Idx < _Value_count; ++_Idx) {
+                const size_t _Other = (_Idx + _Thread * 613) % _Value_count; // the same value in the first thread
+                EXPECT_EQ(_Handles[_Thread][_Idx], _Handles[0][_Other]);
+            }
+        }
+    }
+} // namespace mjx
\ No newline at end of file
@@ -0,0 +1,130 @@
+// test.cpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <counting_resource.hpp>
+#include <gtest/gtest.h>
+#include <list>
+#include <mjstr/join.hpp>
+#include <mjstr/split.hpp>
+#include <mjstr/string.hpp>
+#include <ranges>
+#include <sstream>
+#include <vector>
+
+namespace mjx {
+    TEST(join, strings) {
+        const ::std::vector<utf8_string> _Pieces = {"alpha", "beta", "gamma"};
+        EXPECT_EQ(join(_Pieces, ", "), "alpha, beta, gamma");
+        EXPECT_EQ(join(_Pieces, ""), "alphabetagamma");
+        EXPECT_EQ(join(::std::vector<utf8_string>{}, ", "), "");
+        EXPECT_EQ(join(::std::vector<utf8_string>{"one"}, ", "), "one");
+        EXPECT_EQ(join(::std::vector<utf8_string>{"", ""}, "-"), "-");
+    }
+
+    TEST(join, convertible_pieces) {
+        const ::std::vector<utf8_string_view> _Views = {"a", "b", "c"};
+        EXPECT_EQ(join(_Views, "/"), "a/b/c");
+
+        const ::std::list<const char*> _Pointers = {"x", "y"};
+        EXPECT_EQ(join(_Pointers, "::"), "x::y");
+
+        const ::std::vector<unicode_string> _Wide = {L"left", L"right"};
+        EXPECT_EQ(join(_Wide, L" | "), L"left | right");
+
+        const byte_t _Bytes[]                      = {1, 2, 3};
+        const ::std::vector<byte_string_view> _Raw = {byte_string_view{_Bytes, 2}, byte_string_view{_Bytes + 2, 1}};
+        const byte_t _Sep                          = 0;
+        const byte_string _Joined                  = join(_Raw, byte_string_view{&_Sep, 1});
+        EXPECT_EQ(_Joined.size(), 4);
+        EXPECT_EQ(_Joined[2], 0);
+        EXPECT_EQ(_Joined[3], 3);
+    }
+
+    TEST(join, views_and_ranges) {
+        // split() and join() are inverse operations
+        const utf8_string_view _Str = "a,b,,c";
+        EXPECT_EQ(join(split(_Str, ','), ","), _Str);
+        EXPECT_EQ(join(split("a b  c", ' ', {.skip_empty = true}), "+"), "a+b+c");
+
+        const ::std::vector<utf8_string> _Pieces = {"1", "22", "333", "4444"};
+        EXPECT_EQ(join(_Pieces | ::std::views::reverse, ","), "4444,333,22,1");
+        EXPECT_EQ(join(_Pieces | ::std::views::take(2), ","), "1,22");
+    }
+
+    TEST(join, single_pass_range) {
+        // the length is unknown up front, the pieces are appended one by one
+        ::std::istringstream _Stream("red green blue");
+        EXPECT_EQ(join(::std::views::istream<::std::string>(_Stream)
+                           | ::std::views::transform([](const ::std::string& _Word) {
+                                 return utf8_string{_Word.data(), _Word.size()};
+                             }),
+                      ";"),
+            "red;green;blue");
+    }
+
+    TEST(join, allocations) {
+        ::std::vector<utf8_string> _Pieces;
+        for (size_t _Idx = 0; _Idx < 100; ++_Idx) {
+            _Pieces.push_back(utf8_string(_Idx % 40 + 1, static_cast<char>('a' + _Idx % 26)));
+        }
+
+        counting_resource _Resource;
+        {
+            const utf8_string _Joined = join(_Pieces, ", ", &_Resource);
+            size_t _Expected          = 2 * (_Pieces.size() - 1);
+            for (const utf8_string& _Piece : _Pieces) {
+                _Expected += _Piece.size();
+            }
+
+            EXPECT_EQ(_Joined.size(), _Expected);
+            EXPECT_EQ(_Resource.allocations, 1); // the exact length is allocated once
+        }
+
+        EXPECT_EQ(_Resource.deallocations, 1);
+    }
+
+    TEST(join, join_into) {
+        utf8_string _Str = "items: ";
+        EXPECT_EQ(join_into(_Str, ::std::vector<utf8_string_view>{"a", "b"}, ", "), "items: a, b");
+        EXPECT_EQ(join_into(_Str, ::std::vector<utf8_string_view>{}, ", "), "items: a, b");
+        EXPECT_EQ(join_into(_Str, ::std::vector<utf8_string_view>{"c"}, ", "), "items: a, bc");
+
+        small_utf8_string<64> _Small;
+        join_into(_Small, ::std::vector<utf8_string_view>{"x", "y", "z"}, "");
+        EXPECT_EQ(_Small.view(), "xyz");
+
+        // the current contents are kept when the string grows
+        utf8_string _Long(100, 'x');
+        join_into(_Long, ::std::vector<utf8_string>{utf8_string(200, 'y'), utf8_string(300, 'z')}, "-");
+        EXPECT_EQ(_Long.size(), 601);
+        EXPECT_EQ(_Long.view().substr(0, 100), utf8_string(100, 'x').view());
+        EXPECT_EQ(_Long[100], 'y');
+        EXPECT_EQ(_Long[300], '-');
+        EXPECT_EQ(_Long[600], 'z');
+    }
+
+    TEST(join, join_into_itself) {
+        // the pieces and the separator view the destination, which is reallocated
+        utf8_string _Str(30, 's');
+        join_into(_Str, ::std::vector<utf8_string_view>{_Str.view(), _Str.view()}, ", ");
+        EXPECT_EQ(_Str, utf8_string(60, 's') + ", " + utf8_string(30, 's'));
+
+        utf8_string _Sep = "abcdefghijklmnopqrstuvwxyz";
+        join_into(_Sep, ::std::vector<utf8_string_view>{"1", "2", "3"}, _Sep.view().substr(0, 2));
+        EXPECT_EQ(_Sep, "abcdefghijklmnopqrstuvwxyz1ab2ab3");
+
+        // a resource is kept when the result is built in a new string
+        counting_resource _Resource;
+        {
+            utf8_string _Owned(utf8_string_view{"owned by the resource"}, &_Resource);
+            const utf8_string_view _View = _Owned.view();
+            join_into(_Owned, ::std::vector<utf8_string_view>{_View, _View}, "|");
+            EXPECT_EQ(_Owned, "owned by the resourceowned by the resource|owned by the resource");
+            EXPECT_EQ(_Owned.get_memory_resource(), &_Resource);
+        }
+
+        EXPECT_EQ(_Resource.allocations, _Resource.deallocations);
+    }
+} // namespace mjx
\ No newline at end of file
@@ -0,0 +1,62 @@
+// test.cpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <mjstr/searcher.hpp>
+#include <mjstr/string.hpp>
+
+namespace mjx {
+    TEST(searcher, find) {
+        const utf8_searcher _Searcher("needle");
+        EXPECT_EQ(_Searcher.needle(), "needle");
+        EXPECT_EQ(_Searcher.find("haystack with a needle and another needle"), 16);
+        EXPECT_EQ(_Searcher.find("haystack with a needle and another needle", 17), 35);
+        EXPECT_EQ(_Searcher.find("haystack with a needle and another needle", 36), utf8_searcher::npos);
+        EXPECT_EQ(_Searcher.find("needl"), utf8_searcher::npos);
+        EXPECT_EQ(_Searcher.find(""), utf8_searcher::npos);
+    }
+
+    TEST(searcher, rfind) {
+        const unicode_searcher _Searcher(L"needle");
+        EXPECT_EQ(_Searcher.rfind(L"haystack with a needle and another needle"), 35);
+        EXPECT_EQ(_Searcher.rfind(L"haystack with a needle and another needle", 34), 16);
+        EXPECT_EQ(_Searcher.rfind(L"haystack with a needle and another needle", 15), unicode_searcher::npos);
+        EXPECT_EQ(_Searcher.rfind(L"eedle"), unicode_searcher::npos);
+    }
+
+    TEST(searcher, empty_needle) {
+        const utf8_searcher _Searcher("");
+        EXPECT_EQ(_Searcher.find("abc"), 0);
+        EXPECT_EQ(_Searcher.find("abc", 2), 2);
+        EXPECT_EQ(_Searcher.rfind("abc"), 2);
+    }
+
+    TEST(searcher, long_needle) {
+        // the needle is long enough to use the precomputed tables if the SIMD search gives up
+        const utf8_string _Needle = utf8_string(40, 'a') + "bc" + utf8_string(40, 'a');
+        const utf8_searcher _Searcher(_Needle);
+        utf8_string _Haystack(50000, 'a');
+        EXPECT_EQ(_Searcher.find(_Haystack), utf8_searcher::npos);
+        EXPECT_EQ(_Searcher.rfind(_Haystack), utf8_searcher::npos);
+
+        _Haystack.replace(30000, 2, "bc");
+        _Haystack.replace(45000, 2, "bc");
+        EXPECT_EQ(_Searcher.find(_Haystack), 29960);
+        EXPECT_EQ(_Searcher.find(_Haystack, 29961), 44960);
+        EXPECT_EQ(_Searcher.rfind(_Haystack), 44960);
+        EXPECT_EQ(_Searcher.rfind(_Haystack, 44959), 29960);
+    }
+
+    TEST(searcher, reuse) {
+        // the same searcher must work with any number of haystacks
+        const utf8_searcher _Searcher("abcabcabd");
+        for (size_t _Pos = 0; _Pos < 100; ++_Pos) {
+            utf8_string _Haystack(_Pos, 'x');
+            _Haystack.append("abcabcabcabd");
+            EXPECT_EQ(_Searcher.find(_Haystack), _Pos + 3);
+            EXPECT_EQ(_Searcher.rfind(_Haystack), _Pos + 3);
+        }
+    }
+} // namespace mjx
\ No newline at end of file
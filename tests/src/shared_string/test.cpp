@@ -0,0 +1,140 @@
+// test.cpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <counting_resource.hpp>
+#include <gtest/gtest.h>
+#include <mjstr/shared_string.hpp>
+#include <mjstr/string.hpp>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace mjx {
+    TEST(shared_string, construct) {
+        const utf8_shared_string _Empty;
+        EXPECT_TRUE(_Empty.empty());
+        EXPECT_EQ(_Empty.size(), 0);
+        EXPECT_EQ(_Empty.use_count(), 0);
+        EXPECT_STREQ(_Empty.c_str(), "");
+
+        const utf8_shared_string _Str("Hello, world!");
+        EXPECT_FALSE(_Str.empty());
+        EXPECT_EQ(_Str.size(), 13);
+        EXPECT_EQ(_Str.use_count(), 1);
+        EXPECT_EQ(_Str.view(), "Hello, world!");
+        EXPECT_STREQ(_Str.c_str(), "Hello, world!");
+
+        // the empty value never allocates
+        counting_resource _Resource;
+        {
+            const utf8_shared_string _None("", &_Resource);
+            const utf8_shared_string _Some("abc", 2, &_Resource);
+            EXPECT_TRUE(_None.empty());
+            EXPECT_EQ(utf8_string_view{_Some}, "ab");
+            EXPECT_EQ(_Resource.allocations, 1);
+        }
+
+        EXPECT_EQ(_Resource.deallocations, 1);
+
+        const unicode_shared_string _Wide(L"wide characters");
+        EXPECT_EQ(_Wide.view(), L"wide characters");
+        EXPECT_STREQ(_Wide.c_str(), L"wide characters");
+    }
+
+    TEST(shared_string, copy_and_move) {
+        counting_resource _Resource;
+        {
+            utf8_shared_string _Str(utf8_string{"a value long enough to be allocated"}, &_Resource);
+            utf8_shared_string _Copy = _Str;
+            EXPECT_EQ(_Copy.data(), _Str.data()); // copies share the characters
+            EXPECT_EQ(_Str.use_count(), 2);
+
+            utf8_shared_string _Moved = ::std::move(_Copy);
+            EXPECT_TRUE(_Copy.empty());
+            EXPECT_EQ(_Moved.data(), _Str.data());
+            EXPECT_EQ(_Str.use_count(), 2);
+
+            utf8_shared_string _Other("another value", &_Resource);
+            _Other = _Str;
+            EXPECT_EQ(_Resource.deallocations, 1); // "another value" isn't used anymore
+            EXPECT_EQ(_Str.use_count(), 3);
+
+            _Other = _Other; // self-assignment keeps the characters alive
+            EXPECT_EQ(_Other.view(), "a value long enough to be allocated");
+            EXPECT_EQ(_Str.use_count(), 3);
+
+            _Moved.reset();
+            EXPECT_TRUE(_Moved.empty());
+            EXPECT_EQ(_Str.use_count(), 2);
+
+            _Other.swap(_Moved);
+            EXPECT_TRUE(_Other.empty());
+            EXPECT_EQ(_Moved.data(), _Str.data());
+            EXPECT_EQ(_Resource.allocations, 2);
+        }
+
+        EXPECT_EQ(_Resource.deallocations, 2);
+    }
+
+    TEST(shared_string, to_string) {
+        const utf8_shared_string _Str("immutable");
+        utf8_string _Copy = _Str.to_string();
+        _Copy.append(" no more");
+        EXPECT_EQ(_Copy, "immutable no more");
+        EXPECT_EQ(_Str.view(), "immutable");
+        EXPECT_NE(_Copy.data(), _Str.data());
+
+        counting_resource _Resource;
+        EXPECT_EQ(_Str.to_string(&_Resource).get_memory_resource(), &_Resource);
+    }
+
+    TEST(shared_string, compare_and_hash) {
+        const utf8_shared_string _Str0("alpha");
+        const utf8_shared_string _Str1("alpha");
+        const utf8_shared_string _Str2("beta");
+        EXPECT_EQ(_Str0, _Str1);
+        EXPECT_NE(_Str0, _Str2);
+        EXPECT_LT(_Str0, _Str2);
+        EXPECT_EQ(_Str0, utf8_string_view{"alpha"});
+        EXPECT_GT(_Str2, utf8_string_view{"alpha"});
+        EXPECT_EQ(utf8_shared_string{}, utf8_string_view{});
+
+        // consistent with the hash of the view
+        EXPECT_EQ(::std::hash<utf8_shared_string>{}(_Str0), ::std::hash<utf8_shared_string>{}(_Str1));
+        ::std::unordered_set<utf8_shared_string> _Set{_Str0, _Str1, _Str2};
+        EXPECT_EQ(_Set.size(), 2);
+    }
+
+    TEST(shared_string, concurrent_copies) {
+        counting_resource _Resource;
+        {
+            const utf8_shared_string _Str("shared between all threads", &_Resource);
+            ::std::vector<::std::thread> _Threads;
+            for (int _Idx = 0; _Idx < 8; ++_Idx) {
+                _Threads.emplace_back([_Str] { // copied into every thread
+                    ::std::vector<utf8_shared_string> _Copies;
+                    for (int _Iter = 0; _Iter < 10000; ++_Iter) {
+                        _Copies.push_back(_Str);
+                        if (_Copies.size() == 64) {
+                            _Copies.clear();
+                        }
+                    }
+
+                    EXPECT_EQ(_Str.view(), "shared between all threads");
+                });
+            }
+
+            for (::std::thread& _Thread : _Threads) {
+                _Thread.join();
+            }
+
+            EXPECT_EQ(_Str.use_count(), 1);
+        }
+
+        EXPECT_EQ(_Resource.allocations, 1);
+        EXPECT_EQ(_Resource.deallocations, 1);
+    }
+} // namespace mjx
\ No newline at end of file
@@ -0,0 +1,112 @@
+// test.cpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <mjstr/split.hpp>
+#include <mjstr/string.hpp>
+#include <ranges>
+#include <vector>
+
+namespace mjx {
+    template <class _Elem>
+    ::std::vector<string_view<_Elem>> collect(const split_range<_Elem>& _Range) {
+        return ::std::vector<string_view<_Elem>>(_Range.begin(), _Range.end());
+    }
+
+    TEST(split, character) {
+        using _Fields = ::std::vector<utf8_string_view>;
+        EXPECT_EQ(collect(split("a,b,,c", ',')), (_Fields{"a", "b", "", "c"}));
+        EXPECT_EQ(collect(split(",a,", ',')), (_Fields{"", "a", ""}));
+        EXPECT_EQ(collect(split("abc", ',')), (_Fields{"abc"}));
+        EXPECT_EQ(collect(split("", ',')), (_Fields{""}));
+
+        // the fields are views into the split characters
+        const utf8_string _Str = "key=value";
+        const utf8_string_view _Value = *++split(_Str, '=').begin();
+        EXPECT_EQ(_Value, "value");
+        EXPECT_EQ(_Value.data(), _Str.data() + 4);
+    }
+
+    TEST(split, substring) {
+        using _Fields = ::std::vector<utf8_string_view>;
+        EXPECT_EQ(collect(split("a\r\nb\r\n\r\nc", "\r\n")), (_Fields{"a", "b", "", "c"}));
+        EXPECT_EQ(collect(split("a--b---c", "--")), (_Fields{"a", "b", "-c"}));
+        EXPECT_EQ(collect(split("a\r\n", "\r\n")), (_Fields{"a", ""}));
+        EXPECT_EQ(collect(split("abc", "")), (_Fields{"abc"})); // an empty delimiter doesn't split
+        EXPECT_EQ(collect(split(L"x::y", L"::")), (::std::vector<unicode_string_view>{L"x", L"y"}));
+    }
+
+    TEST(split, any) {
+        using _Fields = ::std::vector<utf8_string_view>;
+        EXPECT_EQ(collect(split_any("a,b;c", ",;")), (_Fields{"a", "b", "c"}));
+        EXPECT_EQ(collect(split_any("a,;b", ",;")), (_Fields{"a", "", "b"}));
+        EXPECT_EQ(collect(split_any("abc", "")), (_Fields{"abc"}));
+        EXPECT_EQ(collect(split_any(byte_string_view{reinterpret_cast<const byte_t*>("1\xFF" "2")},
+                      byte_string_view{reinterpret_cast<const byte_t*>("\xFF")})).size(), 2);
+    }
+
+    TEST(split, whitespace) {
+        using _Fields = ::std::vector<utf8_string_view>;
+        EXPECT_EQ(collect(split_whitespace("  int  main(void) \t{\n}\n")), (_Fields{"int", "main(void)", "{", "}"}));
+        EXPECT_EQ(collect(split_whitespace(" \t\r\n")), _Fields{});
+        EXPECT_EQ(collect(split_whitespace("")), _Fields{});
+        EXPECT_EQ(
+            collect(split_whitespace("GET /index.html  HTTP/1.1 ", 2)), (_Fields{"GET", "/index.html  HTTP/1.1 "}));
+
+        // only ASCII whitespace is recognized
+        EXPECT_EQ(collect(split_whitespace(L"\x3000 wide\tchars")),
+            (::std::vector<unicode_string_view>{L"\x3000", L"wide", L"chars"}));
+    }
+
+    TEST(split, options) {
+        using _Fields = ::std::vector<utf8_string_view>;
+        EXPECT_EQ(collect(split(",a,,b,", ',', {.skip_empty = true})), (_Fields{"a", "b"}));
+        EXPECT_EQ(collect(split(",,,", ',', {.skip_empty = true})), _Fields{});
+        EXPECT_EQ(collect(split("--a----b--", "--", {.skip_empty = true})), (_Fields{"a", "b"}));
+        EXPECT_EQ(collect(split_any(";a,;b", ",;", {.skip_empty = true})), (_Fields{"a", "b"}));
+
+        // the last field contains the rest of the input
+        EXPECT_EQ(collect(split("a,b,c", ',', {.max_count = 2})), (_Fields{"a", "b,c"}));
+        EXPECT_EQ(collect(split("a,b,c", ',', {.max_count = 1})), (_Fields{"a,b,c"}));
+        EXPECT_EQ(collect(split("a,b,c", ',', {.max_count = 0})), _Fields{});
+        EXPECT_EQ(collect(split("a,b", ',', {.max_count = 5})), (_Fields{"a", "b"}));
+        EXPECT_EQ(collect(split("a,,,b,c", ',', {.skip_empty = true, .max_count = 2})), (_Fields{"a", "b,c"}));
+    }
+
+    TEST(split, iterators) {
+        static_assert(::std::ranges::forward_range<utf8_split_range>);
+        static_assert(::std::forward_iterator<utf8_split_range::iterator>);
+
+        const utf8_split_range _Range = split("first second", ' ');
+        utf8_split_range::iterator _Iter = _Range.begin();
+        const utf8_split_range::iterator _Copy = _Iter++;
+        EXPECT_EQ(*_Copy, "first"); // a copy isn't affected by advancing the original iterator
+        EXPECT_EQ(_Iter->size(), 6);
+        EXPECT_EQ(++_Iter, _Range.end());
+        EXPECT_EQ(_Range.begin(), _Copy);
+        EXPECT_EQ(::std::ranges::distance(_Range), 2);
+    }
+
+    TEST(split, long_input) {
+        // fields that span several SIMD blocks, compared with a naive split
+        utf8_string _Str;
+        ::std::vector<utf8_string> _Expected;
+        for (size_t _Idx = 0; _Idx < 500; ++_Idx) {
+            _Expected.push_back(utf8_string(_Idx * 7 % 97, static_cast<char>('a' + _Idx % 26)));
+            _Str.append(_Expected.back());
+            _Str.push_back(_Idx % 3 == 0 ? '\t' : ' ');
+        }
+
+        _Expected.push_back(utf8_string{}); // the trailing empty field
+        size_t _Count = 0;
+        for (const utf8_string_view _Field : split_any(_Str, " \t")) {
+            ASSERT_LT(_Count, _Expected.size());
+            EXPECT_EQ(_Field, _Expected[_Count]);
+            ++_Count;
+        }
+
+        EXPECT_EQ(_Count, _Expected.size());
+    }
+} // namespace mjx
\ No newline at end of file
@@ -0,0 +1,104 @@
+// test.cpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstring>
+#include <gtest/gtest.h>
+#include <mjmem/exception.hpp>
+#include <mjstr/static_string.hpp>
+#include <type_traits>
+
+namespace mjx {
+    TEST(static_string, layout) {
+        EXPECT_TRUE((::std::is_trivially_copyable_v<static_utf8_string<31>>));
+        EXPECT_TRUE((::std::is_trivially_copyable_v<static_unicode_string<15>>));
+        EXPECT_EQ(sizeof(static_utf8_string<31>), 33); // 31 characters, null-terminator and 1-byte size
+        EXPECT_EQ(static_utf8_string<31>::capacity(), 31);
+
+        // arrays of strings may be copied with memcpy()
+        static_utf8_string<31> _Names[2] = {"Content-Type", "Content-Length"};
+        static_utf8_string<31> _Copy[2];
+        ::memcpy(_Copy, _Names, sizeof(_Names));
+        EXPECT_EQ(_Copy[0], "Content-Type");
+        EXPECT_EQ(_Copy[1], "Content-Length");
+    }
+
+    TEST(static_string, modify) {
+        static_utf8_string<32> _Str = "header";
+        _Str.insert(0, "x-");
+        _Str.append("-name");
+        EXPECT_EQ(_Str, "x-header-name");
+        _Str.replace(2, 6, "field");
+        EXPECT_EQ(_Str, "x-field-name");
+        _Str.erase(0, 2);
+        EXPECT_EQ(_Str, "field-name");
+        _Str.push_back('s');
+        _Str.pop_back();
+        _Str.replace(5, 1, 2, '_');
+        EXPECT_EQ(_Str, "field__name");
+        _Str.resize(5);
+        EXPECT_EQ(_Str, "field");
+        EXPECT_EQ(_Str.c_str()[5], '\0');
+        _Str.erase(_Str.begin());
+        EXPECT_EQ(_Str, "ield");
+        _Str.insert(_Str.begin(), 'f');
+        EXPECT_EQ(_Str, "field");
+
+        // search through string_view
+        EXPECT_EQ(_Str.find('l'), 3);
+        EXPECT_EQ(_Str.rfind(utf8_string_view{"ie"}), 1);
+        EXPECT_TRUE(_Str.starts_with("fi"));
+        EXPECT_TRUE(_Str.ends_with('d'));
+        EXPECT_TRUE(_Str.contains("el"));
+        EXPECT_EQ(_Str.substr(1, 3), "iel");
+
+        // convert implicitly to string_view
+        const utf8_string_view _View = _Str;
+        EXPECT_EQ(_View, "field");
+        EXPECT_EQ(utf8_string{_Str}, "field");
+
+        // assign a part of itself
+        _Str.assign(_Str.view().substr(2));
+        EXPECT_EQ(_Str, "eld");
+    }
+
+    TEST(static_string, overflow) {
+        static_utf8_string<8> _Str = "12345678";
+        EXPECT_TRUE(_Str.full());
+        EXPECT_THROW(_Str.push_back('9'), allocation_limit_exceeded);
+        EXPECT_THROW(_Str.append("9"), allocation_limit_exceeded);
+        EXPECT_THROW(_Str.insert(0, 1, '0'), allocation_limit_exceeded);
+        EXPECT_THROW(_Str.assign(9, 'x'), allocation_limit_exceeded);
+        EXPECT_THROW((static_utf8_string<8>{"123456789"}), allocation_limit_exceeded);
+        EXPECT_EQ(_Str, "12345678"); // unchanged after every failure
+
+        // replacing with the same number of characters still fits
+        _Str.replace(0, 2, "ab");
+        EXPECT_EQ(_Str, "ab345678");
+
+        // append as many characters as fit
+        _Str.resize(6);
+        EXPECT_EQ(_Str.append_truncated("xyz"), 2);
+        EXPECT_EQ(_Str, "ab3456xy");
+        EXPECT_EQ(_Str.append_truncated("z"), 0);
+
+        // offsets are checked
+        EXPECT_THROW(_Str.insert(9, "a"), resource_overrun);
+        EXPECT_THROW(_Str.at(8), resource_overrun);
+    }
+
+    TEST(static_string, wide) {
+        static_unicode_string<16> _Str(L"wide");
+        _Str += L' ';
+        _Str += unicode_string_view{L"string"};
+        EXPECT_EQ(_Str, L"wide string");
+        EXPECT_EQ(_Str.size(), 11);
+
+        static_unicode_string<16> _Other = L"other";
+        _Str.swap(_Other);
+        EXPECT_EQ(_Str, L"other");
+        EXPECT_EQ(_Other, L"wide string");
+        EXPECT_GT(_Other, _Str);
+    }
+} // namespace mjx
\ No newline at end of file
@@ -0,0 +1,130 @@
+// test.cpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <mjstr/stream_conversion.hpp>
+#include <mjstr/string.hpp>
+
+#ifdef _MJX_MSVC
+#pragma warning(push, 1)
+#pragma warning(disable : 4566) // C4566: character cannot be represented in the current code page
+#endif // _MJX_MSVC
+
+namespace mjx {
+    inline unicode_string decode_in_chunks(
+        const utf8_string_view _Bytes, const size_t _Chunk_size, const size_t _Capacity) {
+        // feed _Bytes in chunks of _Chunk_size bytes, every output buffer holds _Capacity characters
+        utf8_decoder _Decoder;
+        unicode_string _Result;
+        wchar_t _Buf[8];
+        for (size_t _Off = 0; _Off < _Bytes.size(); _Off += _Chunk_size) {
+            utf8_string_view _Chunk = _Bytes.substr(_Off, _Chunk_size);
+            for (;;) {
+                const conversion_result _Fed = _Decoder.feed(_Chunk, _Buf, _Capacity);
+                EXPECT_NE(_Fed.status, conversion_status::invalid_input);
+                _Result.append(_Buf, _Fed.written);
+                _Chunk.remove_prefix(_Fed.read);
+                if (_Fed.status == conversion_status::ok) {
+                    break;
+                }
+            }
+        }
+
+        EXPECT_EQ(_Decoder.finish(), conversion_status::ok);
+        return _Result;
+    }
+
+    inline utf8_string encode_in_chunks(
+        const unicode_string_view _Chars, const size_t _Chunk_size, const size_t _Capacity) {
+        // feed _Chars in chunks of _Chunk_size characters, every output buffer holds _Capacity bytes
+        utf8_encoder _Encoder;
+        utf8_string _Result;
+        char _Buf[8];
+        for (size_t _Off = 0; _Off < _Chars.size(); _Off += _Chunk_size) {
+            unicode_string_view _Chunk = _Chars.substr(_Off, _Chunk_size);
+            for (;;) {
+                const conversion_result _Fed = _Encoder.feed(_Chunk, _Buf, _Capacity);
+                EXPECT_NE(_Fed.status, conversion_status::invalid_input);
+                _Result.append(_Buf, _Fed.written);
+                _Chunk.remove_prefix(_Fed.read);
+                if (_Fed.status == conversion_status::ok) {
+                    break;
+                }
+            }
+        }
+
+        EXPECT_EQ(_Encoder.finish(), conversion_status::ok);
+        return _Result;
+    }
+
+    TEST(utf8_decoder, split_sequences) {
+        // every chunk size splits the sequences at different positions
+        const utf8_string _Bytes      = "a\xC3\xA9" "b\xE2\x82\xAC" "c\xF0\x9F\x98\x80" "d\xC3\xA9\xE2\x82\xAC";
+        const unicode_string _Unicode = L"aéb€c\U0001F600dé€";
+        for (size_t _Chunk_size = 1; _Chunk_size <= _Bytes.size(); ++_Chunk_size) {
+            EXPECT_EQ(decode_in_chunks(_Bytes, _Chunk_size, 8), _Unicode);
+            EXPECT_EQ(decode_in_chunks(_Bytes, _Chunk_size, 2), _Unicode);
+        }
+    }
+
+    TEST(utf8_decoder, pending) {
+        utf8_decoder _Decoder;
+        wchar_t _Buf[4];
+        conversion_result _Fed = _Decoder.feed("a\xE2\x82", _Buf, 4);
+        EXPECT_EQ(_Fed.read, 3);
+        EXPECT_EQ(_Fed.written, 1);
+        EXPECT_EQ(_Fed.status, conversion_status::ok);
+        EXPECT_TRUE(_Decoder.pending());
+
+        _Fed = _Decoder.feed("\xAC", _Buf, 0); // no space for the completed character
+        EXPECT_EQ(_Fed.read, 0);
+        EXPECT_EQ(_Fed.status, conversion_status::destination_full);
+
+        _Fed = _Decoder.feed("\xAC", _Buf, 4);
+        EXPECT_EQ(_Fed.read, 1);
+        EXPECT_EQ(_Fed.written, 1);
+        EXPECT_EQ(_Buf[0], L'€');
+        EXPECT_FALSE(_Decoder.pending());
+        EXPECT_EQ(_Decoder.finish(), conversion_status::ok);
+    }
+
+    TEST(utf8_decoder, invalid_input) {
+        utf8_decoder _Decoder;
+        wchar_t _Buf[4];
+        EXPECT_EQ(_Decoder.feed("\xED", _Buf, 4).status, conversion_status::ok);
+        EXPECT_EQ(_Decoder.feed("\xA0\x80", _Buf, 4).status, conversion_status::invalid_input); // surrogate
+
+        _Decoder.reset();
+        EXPECT_EQ(_Decoder.feed("\xE2\x82", _Buf, 4).status, conversion_status::ok);
+        EXPECT_EQ(_Decoder.feed("a", _Buf, 4).status, conversion_status::invalid_input);
+
+        _Decoder.reset();
+        EXPECT_EQ(_Decoder.feed("ab\xF0\x9F", _Buf, 4).status, conversion_status::ok);
+        EXPECT_EQ(_Decoder.finish(), conversion_status::invalid_input); // the input ended too early
+        EXPECT_FALSE(_Decoder.pending());
+    }
+
+    TEST(utf8_encoder, chunks) {
+        const unicode_string _Unicode = L"aéb€c\U0001F600dé€";
+        const utf8_string _Bytes      = "a\xC3\xA9" "b\xE2\x82\xAC" "c\xF0\x9F\x98\x80" "d\xC3\xA9\xE2\x82\xAC";
+        for (size_t _Chunk_size = 1; _Chunk_size <= _Unicode.size(); ++_Chunk_size) {
+            EXPECT_EQ(encode_in_chunks(_Unicode, _Chunk_size, 8), _Bytes);
+            EXPECT_EQ(encode_in_chunks(_Unicode, _Chunk_size, 4), _Bytes);
+        }
+    }
+
+    TEST(utf8_encoder, invalid_input) {
+        utf8_encoder _Encoder;
+        char _Buf[8];
+        const conversion_result _Fed = _Encoder.feed(L"ab\xDC00", _Buf, 8); // lone low surrogate
+        EXPECT_EQ(_Fed.read, 2);
+        EXPECT_EQ(_Fed.written, 2);
+        EXPECT_EQ(_Fed.status, conversion_status::invalid_input);
+    }
+} // namespace mjx
+
+#ifdef _MJX_MSVC
+#pragma warning(pop)
+#endif // _MJX_MSVC
\ No newline at end of file
@@ -3,7 +3,9 @@
 // Copyright (c) Mateusz Jandura. All rights reserved.
 // SPDX-License-Identifier: Apache-2.0
 
+#include <counting_resource.hpp>
 #include <gtest/gtest.h>
+#include <mjmem/exception.hpp>
 #include <mjstr/string.hpp>
 
 namespace mjx {
@@ -53,11 +55,12 @@ namespace mjx {
         utf8_string _Str;
 
         // test initial capacity
-        EXPECT_EQ(_Str.capacity(), 15); // SSO active, small string capacity is 16 bytes (with null-terminator)
+        constexpr size_t _Small_capacity = 3 * sizeof(void*) - 1;
+        EXPECT_EQ(_Str.capacity(), _Small_capacity); // SSO active, small buffer overlaps pointer, size and capacity
             
         // test capacity for 10 characters
         _Str.reserve(10);
-        EXPECT_EQ(_Str.capacity(), 15); // requested less capacity than current, nothing has changed
+        EXPECT_EQ(_Str.capacity(), _Small_capacity); // requested less capacity than current, nothing has changed
         
         // test capacity for 100 characters
         _Str.reserve(100);
@@ -67,6 +70,69 @@ namespace mjx {
         EXPECT_EQ(_Str.capacity(), _Aligned_size - 1);
     }
 
+    TEST(string, growth) {
+        utf8_string _Str;
+        size_t _Capacity      = _Str.capacity();
+        size_t _Reallocations = 0;
+        for (size_t _Count = 0; _Count < 100'000; ++_Count) {
+            _Str.push_back('x');
+            if (_Str.capacity() != _Capacity) { // capacity has changed, buffer reallocated
+                _Capacity = _Str.capacity();
+                ++_Reallocations;
+            }
+        }
+
+        // capacity grows geometrically, so the number of reallocations should be logarithmic
+        EXPECT_EQ(_Str.size(), 100'000);
+        EXPECT_EQ(_Str, utf8_string(100'000, 'x'));
+        EXPECT_LE(_Reallocations, 32);
+    }
+
+    TEST(string, growth_policy) {
+        const string_growth_policy _Default = utf8_string::growth_policy();
+        EXPECT_EQ(_Default.numerator, 3);
+        EXPECT_EQ(_Default.denominator, 2);
+
+        // double the capacity, every string of this type uses the new policy
+        EXPECT_TRUE(utf8_string::set_growth_policy(string_growth_policy{2, 1}));
+        utf8_string _Str;
+        _Str.reserve(100);
+        const size_t _Capacity = _Str.capacity();
+        _Str.append(_Capacity + 1, 'x');
+        EXPECT_GE(_Str.capacity(), 2 * _Capacity);
+
+        // other string types keep their own policy
+        EXPECT_EQ(small_utf8_string<64>::growth_policy().numerator, 3);
+        EXPECT_EQ(unicode_string::growth_policy().numerator, 3);
+
+        // a factor not greater than 1 is rejected
+        EXPECT_FALSE(utf8_string::set_growth_policy(string_growth_policy{1, 1}));
+        EXPECT_FALSE(utf8_string::set_growth_policy(string_growth_policy{3, 0}));
+        EXPECT_EQ(utf8_string::growth_policy().numerator, 2);
+        EXPECT_EQ(utf8_string::growth_policy().denominator, 1);
+        EXPECT_TRUE(utf8_string::set_growth_policy(_Default));
+    }
+
+    TEST(string, growth_near_max_size) {
+        // geometric growth is capped at the largest capacity, larger requests are returned unchanged
+        constexpr string_growth_policy _Policy;
+        EXPECT_EQ(_Policy.next_capacity(100, 101, 1000), 150);
+        EXPECT_EQ(_Policy.next_capacity(100, 400, 1000), 400);
+        EXPECT_EQ(_Policy.next_capacity(900, 901, 1000), 1000);
+        EXPECT_EQ(_Policy.next_capacity(900, 1200, 1000), 1200);
+
+        // the growth doesn't overflow near the largest size
+        constexpr size_t _Max = static_cast<size_t>(-1) / 2;
+        EXPECT_EQ(_Policy.next_capacity(_Max / 3 * 2 + 100, _Max / 3 * 2 + 101, _Max), _Max);
+        constexpr string_growth_policy _Large_factor{1000, 1};
+        EXPECT_EQ(_Large_factor.next_capacity(_Max / 100, _Max / 100 + 1, _Max), _Max);
+
+        // more than max_size() characters can't be stored at all
+        utf8_string _Str = "a";
+        EXPECT_THROW(_Str.append_uninitialized(utf8_string::max_size()), allocation_limit_exceeded);
+        EXPECT_EQ(_Str, "a");
+    }
+
     TEST(string, copy) {
         const utf8_string _Str = "ABCDEF";
         char _Buf[4]           = {'\0'};
@@ -114,6 +180,69 @@ namespace mjx {
         EXPECT_EQ(_Str, utf8_string(10, 'x'));
     }
 
+    TEST(string, resize_uninitialized) {
+        utf8_string _Str = "abc";
+
+        // increase string size, the current characters must be preserved
+        _Str.resize_uninitialized(40);
+        EXPECT_EQ(_Str.size(), 40);
+        EXPECT_GE(_Str.capacity(), 40);
+        EXPECT_EQ(_Str.c_str()[40], '\0');
+        EXPECT_TRUE(_Str.starts_with("abc"));
+
+        // decrease string size, the buffer must not be reallocated
+        const char* const _Old_ptr = _Str.data();
+        _Str.resize_uninitialized(2);
+        EXPECT_EQ(_Str, "ab");
+        EXPECT_EQ(_Str.data(), _Old_ptr);
+    }
+
+    TEST(string, resize_and_overwrite) {
+        utf8_string _Str = "abc";
+
+        // write the characters directly, the returned count becomes the new size
+        _Str.resize_and_overwrite(40, [](char* const _Buf, const size_t _Count) {
+            EXPECT_EQ(_Count, 40);
+            EXPECT_EQ(_Buf[0], 'a');
+            char_traits<char>::assign(_Buf + 3, 7, '!');
+            return size_t{10};
+        });
+        EXPECT_EQ(_Str, "abc!!!!!!!");
+        EXPECT_GE(_Str.capacity(), 40);
+        EXPECT_EQ(_Str.c_str()[10], '\0');
+
+        // a smaller count keeps only the leading characters, more than requested is an error
+        _Str.resize_and_overwrite(2, [](char*, const size_t _Count) { return _Count; });
+        EXPECT_EQ(_Str, "ab");
+        EXPECT_THROW(_Str.resize_and_overwrite(4, [](char*, const size_t _Count) { return _Count + 1; }),
+            resource_overrun);
+    }
+
+    TEST(string, append_uninitialized) {
+        utf8_string _Str = "small";
+
+        // the reserved space stays outside of the string until it's committed
+        char* _Buf = _Str.append_uninitialized(3);
+        EXPECT_EQ(_Buf, _Str.data() + 5);
+        char_traits<char>::copy(_Buf, "123", 3);
+        EXPECT_EQ(_Str.size(), 5);
+        _Str.commit(2);
+        EXPECT_EQ(_Str, "small12");
+
+        // grows the buffer like append() and keeps the characters
+        _Buf = _Str.append_uninitialized(100);
+        EXPECT_GE(_Str.capacity(), 107);
+        EXPECT_EQ(_Str, "small12");
+        char_traits<char>::assign(_Buf, 100, 'x');
+        _Str.commit(100);
+        EXPECT_EQ(_Str.size(), 107);
+        EXPECT_TRUE(_Str.starts_with("small12xxx"));
+        EXPECT_EQ(_Str.c_str()[107], '\0');
+
+        // committing more than the capacity is an error
+        EXPECT_THROW(_Str.commit(_Str.capacity()), resource_overrun);
+    }
+
     TEST(string, expand) {
         utf8_string _Str = "utf8_string_";
         _Str.expand(3, 'X');
@@ -153,6 +282,17 @@ namespace mjx {
         EXPECT_EQ(_Str, "This");
     }
 
+    TEST(string, find_of) {
+        const utf8_string _Str = "  name: \"value\"  ";
+        EXPECT_EQ(_Str.find_first_of(utf8_string{":\""}), 6);
+        EXPECT_EQ(_Str.find_first_of('"', 7), 8);
+        EXPECT_EQ(_Str.find_last_of(":\""), 14);
+        EXPECT_EQ(_Str.find_first_not_of(' '), 2);
+        EXPECT_EQ(_Str.find_last_not_of(utf8_string_view{" "}), 14);
+        EXPECT_EQ(_Str.find_last_not_of(" \"", 14), 13);
+        EXPECT_EQ(_Str.find_first_of("xyz"), utf8_string::npos);
+    }
+
     TEST(string, insert) {
         utf8_string _Str = "xmplr";
 
@@ -196,4 +336,264 @@ namespace mjx {
             EXPECT_EQ(_Str, "Hi John...");
         }
     }
+
+    template <class _Str_t>
+    bool is_small(const _Str_t& _Str) noexcept { // checks whether the characters are stored in the object
+        const unsigned char* const _Obj  = reinterpret_cast<const unsigned char*>(&_Str);
+        const unsigned char* const _Data = reinterpret_cast<const unsigned char*>(_Str.data());
+        return _Data >= _Obj && _Data < _Obj + sizeof(_Str_t);
+    }
+
+    TEST(string, small_buffer) {
+        constexpr size_t _Small_capacity = 3 * sizeof(void*) - 1;
+        EXPECT_EQ(sizeof(byte_string), 3 * sizeof(void*));
+        EXPECT_EQ(sizeof(utf8_string), 3 * sizeof(void*));
+        EXPECT_EQ(sizeof(unicode_string), 3 * sizeof(void*));
+        EXPECT_EQ(byte_string{}.capacity(), _Small_capacity);
+        EXPECT_EQ(utf8_string{}.capacity(), _Small_capacity);
+        if constexpr (sizeof(void*) == 8) { // 23 characters in 24 bytes
+            EXPECT_EQ(sizeof(utf8_string), 24);
+            EXPECT_EQ(utf8_string{}.capacity(), 23);
+            EXPECT_TRUE(is_small(utf8_string{"a key of 23 characters!"}));
+        }
+
+        // fill the small buffer one character at a time, its last element becomes the null-terminator
+        utf8_string _Str;
+        for (size_t _Count = 1; _Count <= _Small_capacity; ++_Count) {
+            _Str.push_back('a');
+            EXPECT_EQ(_Str.size(), _Count);
+            EXPECT_EQ(_Str.data()[_Count], '\0');
+        }
+
+        EXPECT_EQ(_Str.capacity(), _Small_capacity);
+        EXPECT_TRUE(is_small(_Str));
+
+        // grow the full small buffer in the middle
+        _Str.pop_back();
+        _Str.insert(0, 1, 'b');
+        EXPECT_EQ(_Str.size(), _Small_capacity);
+        EXPECT_EQ(_Str, utf8_string(1, 'b') + utf8_string(_Small_capacity - 1, 'a'));
+        EXPECT_TRUE(is_small(_Str));
+
+        // one more character requires a large buffer
+        _Str.push_back('c');
+        EXPECT_EQ(_Str.size(), _Small_capacity + 1);
+        EXPECT_GT(_Str.capacity(), _Small_capacity);
+        EXPECT_FALSE(is_small(_Str));
+
+        // go back to the small buffer
+        _Str.shrink(2);
+        _Str.shrink_to_fit();
+        EXPECT_EQ(_Str.capacity(), _Small_capacity);
+        EXPECT_TRUE(is_small(_Str));
+        EXPECT_EQ(_Str, utf8_string(1, 'b') + utf8_string(_Small_capacity - 2, 'a'));
+
+        // swap small buffer with large one, the size is stored within the small buffer
+        utf8_string _Small(_Small_capacity, 's');
+        utf8_string _Large(100, 'l');
+        _Small.swap(_Large);
+        EXPECT_EQ(_Small, utf8_string(100, 'l'));
+        EXPECT_EQ(_Large, utf8_string(_Small_capacity, 's'));
+
+        // move small buffer
+        const utf8_string _Moved = ::std::move(_Large);
+        EXPECT_EQ(_Moved.size(), _Small_capacity);
+        EXPECT_TRUE(_Large.empty());
+
+        // wide strings use the same layout
+        constexpr size_t _Wide_capacity = (3 * sizeof(void*)) / sizeof(wchar_t) - 1;
+        const unicode_string _Wide(_Wide_capacity, L'w');
+        EXPECT_EQ(_Wide.capacity(), _Wide_capacity);
+        EXPECT_EQ(_Wide.size(), _Wide_capacity);
+        EXPECT_EQ(_Wide.data()[_Wide_capacity], L'\0');
+        EXPECT_TRUE(is_small(_Wide));
+    }
+
+    TEST(string, small_string) {
+        EXPECT_EQ(sizeof(small_utf8_string<64>), 64);
+        EXPECT_EQ(sizeof(small_unicode_string<128>), 128);
+
+        small_utf8_string<64> _Str;
+        EXPECT_EQ(_Str.capacity(), 63);
+        _Str.assign(utf8_string_view{"an identifier that fits in sixty-four inline bytes"});
+        for (size_t _Count = _Str.size(); _Count < 63; ++_Count) {
+            _Str.push_back('_');
+        }
+
+        EXPECT_EQ(_Str.size(), 63);
+        EXPECT_EQ(_Str.data()[63], '\0');
+        EXPECT_TRUE(is_small(_Str));
+
+        // the 64th character requires a large buffer
+        _Str.push_back('!');
+        EXPECT_EQ(_Str.size(), 64);
+        EXPECT_FALSE(is_small(_Str));
+        EXPECT_TRUE(_Str.starts_with("an identifier"));
+        EXPECT_TRUE(_Str.ends_with("__!"));
+
+        // go back to the small buffer
+        _Str.shrink(14);
+        _Str.shrink_to_fit();
+        EXPECT_EQ(_Str.capacity(), 63);
+        EXPECT_TRUE(is_small(_Str));
+        EXPECT_EQ(_Str, "an identifier that fits in sixty-four inline bytes");
+
+        // swap and move small buffers with large ones
+        small_utf8_string<64> _Small(63, 's');
+        small_utf8_string<64> _Large(200, 'l');
+        _Small.swap(_Large);
+        EXPECT_EQ(_Small, small_utf8_string<64>(200, 'l'));
+        EXPECT_EQ(_Large, small_utf8_string<64>(63, 's'));
+        _Large = ::std::move(_Small);
+        EXPECT_EQ(_Large.size(), 200);
+        EXPECT_TRUE(_Small.empty());
+
+        // convert from and to string_view and between sizes
+        const utf8_string _Default = utf8_string_view{_Large}.substr(0, 10);
+        const small_utf8_string<128> _Other(_Default);
+        EXPECT_EQ(_Other, _Default.view());
+        EXPECT_EQ(_Other + "!", "llllllllll!");
+    }
+
+    TEST(string, concat) {
+        const utf8_string _Str = "string";
+        const utf8_string_view _View{"view"};
+        const char* const _Ptr = "pointer";
+
+        // mix all kinds of operands on both sides
+        utf8_string _Result = _Str + '-' + _View + "-" + _Ptr;
+        EXPECT_EQ(_Result, "string-view-pointer");
+        _Result = _View + _View;
+        EXPECT_EQ(_Result, "viewview");
+        _Result = '<' + _Str + _Str + '>';
+        EXPECT_EQ(_Result, "<stringstring>");
+        _Result = _Ptr + (_View + _Str);
+        EXPECT_EQ(_Result, "pointerviewstring");
+        EXPECT_EQ((_Str + "!").size(), 7);
+
+        // the result is a string that owns its characters
+        EXPECT_STREQ((_Str + _View).c_str(), "stringview");
+        EXPECT_EQ((_Str + _View).find('v'), 6);
+        EXPECT_EQ(utf8_string_view{_Str + '!'}, "string!");
+        auto _Auto                   = _Str + utf8_string(100, 'x');
+        const utf8_string _From_auto = _Auto;
+        EXPECT_EQ(_From_auto, _Str + utf8_string(100, 'x'));
+
+        // rvalue operands keep their position
+        _Result = "x" + utf8_string{"y"};
+        EXPECT_EQ(_Result, "xy");
+        _Result = 'x' + utf8_string{"y"} + 'z';
+        EXPECT_EQ(_Result, "xyz");
+
+        // every operator+ allocates at most once
+        const utf8_string _Long(100, 'a');
+        _Result = _Long + _View + _Long;
+        EXPECT_EQ(_Result.size(), 204);
+        EXPECT_LT(_Result.capacity() - _Result.size(), 16);
+        EXPECT_TRUE(_Result.starts_with(_Long));
+        EXPECT_TRUE(_Result.ends_with(_Long));
+
+        // a large enough rvalue string gives its buffer to the result
+        utf8_string _Large(50, 'b');
+        _Large.reserve(100);
+        const char* const _Data = _Large.data();
+        _Result                 = ::std::move(_Large) + "c";
+        EXPECT_EQ(_Result.data(), _Data);
+        EXPECT_EQ(_Result, utf8_string(50, 'b') + 'c');
+        _Large  = ::std::move(_Result);
+        _Result = _View + ::std::move(_Large) + '!';
+        EXPECT_EQ(_Result.data(), _Data);
+        EXPECT_EQ(_Result, "view" + utf8_string(50, 'b') + "c!");
+
+        // a view into the rvalue string can't be inserted in place
+        _Result = _Result.view().substr(0, 4) + ::std::move(_Result);
+        EXPECT_EQ(_Result, "viewview" + utf8_string(50, 'b') + "c!");
+
+        // small strings concatenate to the same type
+        const small_utf8_string<64> _Small = small_utf8_string<64>{"view"} + _Str.view();
+        EXPECT_EQ(_Small, "viewstring");
+    }
+
+    TEST(string, concat_function) {
+        const utf8_string _Str = "string";
+        const utf8_string_view _View{"view"};
+        const char* const _Ptr = "pointer";
+        EXPECT_EQ(concat(_Str, '/', _View, "/", _Ptr), "string/view/pointer");
+        EXPECT_EQ(concat(_View, _Str), "viewstring");
+        EXPECT_EQ(concat("[", _Str, ']'), "[string]");
+        EXPECT_EQ(concat('x'), "x");
+        EXPECT_EQ(concat(L"wide", unicode_string{L" "}, L'!'), L"wide !");
+
+        // the whole chain is allocated once with the total length
+        const utf8_string _Long(100, 'a');
+        const utf8_string _Result = concat(_Long, _View, _Long, _View, _Long);
+        EXPECT_EQ(_Result.size(), 308);
+        EXPECT_LT(_Result.capacity() - _Result.size(), 2 * sizeof(void*));
+        EXPECT_TRUE(_Result.starts_with(_Long));
+        EXPECT_TRUE(_Result.ends_with(_Long));
+    }
+
+    TEST(string, memory_resource) {
+        counting_resource _Resource;
+        {
+            // the resource is stored with the characters, so the string allocates right away
+            utf8_string _Str(&_Resource);
+            EXPECT_EQ(_Str.get_memory_resource(), &_Resource);
+            EXPECT_EQ(_Resource.allocations, 1);
+            _Str.assign(100, 'a');
+            _Str.append(200, 'b');
+            EXPECT_EQ(_Resource.allocations, 3);
+
+            // the capacity can be requested up front, short strings keep the resource
+            utf8_string _Sized(&_Resource, 500);
+            EXPECT_GE(_Sized.capacity(), 500);
+            EXPECT_EQ(_Resource.allocations, 4);
+            _Sized = "short";
+            _Sized.shrink_to_fit();
+            EXPECT_EQ(_Sized.get_memory_resource(), &_Resource);
+            EXPECT_EQ(_Sized, "short");
+
+            // copies use the global allocator
+            const utf8_string _Copy = _Str;
+            EXPECT_EQ(_Copy.get_memory_resource(), global_memory_resource());
+            EXPECT_EQ(_Resource.allocations, 5);
+
+            // moves and swaps take the resource with the memory
+            utf8_string _Moved = ::std::move(_Str);
+            EXPECT_EQ(_Moved.get_memory_resource(), &_Resource);
+            utf8_string _Other = "short";
+            _Other.swap(_Moved);
+            EXPECT_EQ(_Other.get_memory_resource(), &_Resource);
+            EXPECT_EQ(_Moved.get_memory_resource(), global_memory_resource());
+            EXPECT_EQ(_Moved, "short");
+        }
+
+        EXPECT_EQ(_Resource.allocations, _Resource.deallocations);
+    }
+
+    TEST(string, arena_resource) {
+        arena_resource _Arena(1024);
+        for (size_t _Round = 0; _Round < 3; ++_Round) {
+            {
+                utf8_string _Str(utf8_string_view{"a string that doesn't fit in the small buffer"}, &_Arena);
+                for (size_t _Idx = 0; _Idx < 10; ++_Idx) {
+                    _Str.append("0123456789");
+                }
+
+                EXPECT_EQ(_Str.size(), 145);
+                EXPECT_TRUE(_Str.starts_with("a string"));
+                EXPECT_EQ(reinterpret_cast<size_t>(_Str.data()) % memory_resource::alignment, 0);
+            }
+
+            EXPECT_GT(_Arena.reserved_bytes(), 0);
+            _Arena.release(); // frees all strings at once
+            EXPECT_EQ(_Arena.reserved_bytes(), 0);
+        }
+
+        // allocations larger than the block size get their own block
+        utf8_string _Large(&_Arena);
+        _Large.assign(4096, 'x');
+        EXPECT_EQ(_Large, utf8_string(4096, 'x'));
+        EXPECT_GE(_Arena.reserved_bytes(), 4096);
+    }
 } // namespace mjx
\ No newline at end of file
@@ -0,0 +1,113 @@
+// test.cpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <counting_resource.hpp>
+#include <gtest/gtest.h>
+#include <mjstr/string_builder.hpp>
+
+namespace mjx {
+    TEST(string_builder, append) {
+        utf8_string_builder _Builder;
+        EXPECT_TRUE(_Builder.empty());
+        EXPECT_EQ(_Builder.chunk_count(), 0);
+
+        // empty appends don't allocate
+        _Builder.append("", 0);
+        _Builder.append(0, ' ');
+        EXPECT_EQ(_Builder.chunk_count(), 0);
+
+        _Builder.append("Hello");
+        _Builder.push_back(',');
+        _Builder.append(1, ' ');
+        _Builder.append("world!", 5);
+        EXPECT_EQ(_Builder.size(), 12);
+        EXPECT_EQ(_Builder.chunk_count(), 1);
+        EXPECT_EQ(_Builder.finalize(), "Hello, world");
+
+        // finalize() leaves the builder empty
+        EXPECT_TRUE(_Builder.empty());
+        EXPECT_EQ(_Builder.chunk_count(), 0);
+        EXPECT_EQ(_Builder.finalize(), "");
+    }
+
+    TEST(string_builder, chunks) {
+        counting_resource _Resource;
+        {
+            utf8_string_builder _Builder(&_Resource);
+            utf8_string _Expected;
+            for (size_t _Idx = 0; _Idx < 1000; ++_Idx) {
+                const char _Ch = static_cast<char>('a' + _Idx % 26);
+                _Builder.append(_Idx % 7, _Ch);
+                _Builder.push_back('|');
+                _Expected.append(_Idx % 7, _Ch);
+                _Expected.push_back('|');
+            }
+
+            // the chunks grow geometrically and the written characters are never moved
+            EXPECT_EQ(_Builder.size(), _Expected.size());
+            EXPECT_EQ(_Builder.chunk_count(), _Resource.allocations);
+            EXPECT_LE(_Builder.chunk_count(), 5);
+            utf8_string_view _Chunks[8];
+            const size_t _Count = _Builder.chunks(_Chunks, 8);
+            EXPECT_EQ(_Count, _Builder.chunk_count());
+            EXPECT_EQ(_Chunks[0].size(), utf8_string_builder::min_chunk_capacity);
+            const char* const _First = _Chunks[0].data();
+            _Builder.append("tail");
+            _Expected.append("tail");
+            EXPECT_EQ(_Builder.chunks(_Chunks, 1), 1);
+            EXPECT_EQ(_Chunks[0].data(), _First);
+
+            // the chunks can be taken in batches
+            utf8_string _Gathered;
+            for (size_t _First_chunk = 0; _First_chunk < _Builder.chunk_count(); _First_chunk += 2) {
+                const size_t _Batch = _Builder.chunks(_Chunks, 2, _First_chunk);
+                for (size_t _Idx = 0; _Idx < _Batch; ++_Idx) {
+                    _Gathered.append(_Chunks[_Idx]);
+                }
+            }
+
+            EXPECT_EQ(_Gathered, _Expected);
+
+            // the result is allocated once from the same resource
+            const size_t _Allocations = _Resource.allocations;
+            const utf8_string _Result = _Builder.finalize();
+            EXPECT_EQ(_Result, _Expected);
+            EXPECT_EQ(_Result.get_memory_resource(), &_Resource);
+            EXPECT_EQ(_Resource.allocations, _Allocations + 1);
+            EXPECT_EQ(_Resource.deallocations, _Allocations);
+        }
+
+        EXPECT_EQ(_Resource.allocations, _Resource.deallocations);
+    }
+
+    TEST(string_builder, large_append) {
+        // a large piece fills the last chunk and the rest goes to a new chunk that fits it
+        unicode_string_builder _Builder;
+        _Builder.append(100, L'a');
+        const unicode_string _Large(10000, L'b');
+        _Builder.append(_Large);
+        EXPECT_EQ(_Builder.chunk_count(), 2);
+        unicode_string_view _Chunks[2];
+        EXPECT_EQ(_Builder.chunks(_Chunks, 2), 2);
+        EXPECT_EQ(_Chunks[0].size(), unicode_string_builder::min_chunk_capacity);
+        EXPECT_EQ(_Chunks[1].size(), 10100 - unicode_string_builder::min_chunk_capacity);
+
+        unicode_string _Result(_Builder.size(), L'\0');
+        _Builder.copy(_Result.data());
+        EXPECT_EQ(_Result, unicode_string(100, L'a') + _Large);
+    }
+
+    TEST(string_builder, move) {
+        utf8_string_builder _Builder;
+        _Builder.append("moved");
+        utf8_string_builder _Other = ::std::move(_Builder);
+        EXPECT_TRUE(_Builder.empty());
+        EXPECT_EQ(_Other.size(), 5);
+
+        _Builder.append("kept");
+        _Builder = ::std::move(_Other);
+        EXPECT_EQ(_Builder.finalize(), "moved");
+    }
+} // namespace mjx
\ No newline at end of file
@@ -0,0 +1,185 @@
+// test.cpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <counting_resource.hpp>
+#include <gtest/gtest.h>
+#include <mjstr/string.hpp>
+#include <mjstr/string_flat_map.hpp>
+#include <string>
+#include <unordered_map>
+
+namespace mjx {
+    utf8_string make_key(const size_t _Idx) {
+        // keys of various lengths, some of them longer than 16 characters
+        const ::std::string _Num = ::std::to_string(_Idx);
+        return utf8_string{"key."} + utf8_string_view{_Num.data(), _Num.size()} + utf8_string(_Idx % 23, '#');
+    }
+
+    TEST(string_flat_map, insert_and_find) {
+        utf8_string_flat_map<int> _Map;
+        EXPECT_TRUE(_Map.empty());
+        EXPECT_EQ(_Map.find("missing"), _Map.end());
+        EXPECT_EQ(_Map.begin(), _Map.end());
+
+        EXPECT_TRUE(_Map.insert("content-type", 1).second);
+        EXPECT_TRUE(_Map.insert("content-length", 2).second);
+        EXPECT_TRUE(_Map.try_emplace("", 3).second); // the empty key is a regular key
+
+        const auto [_Iter, _Inserted] = _Map.insert("content-type", 4);
+        EXPECT_FALSE(_Inserted);
+        EXPECT_EQ(_Iter.key(), "content-type");
+        EXPECT_EQ(_Iter.value(), 1);
+
+        EXPECT_EQ(_Map.size(), 3);
+        EXPECT_TRUE(_Map.contains("content-length"));
+        EXPECT_TRUE(_Map.contains(""));
+        EXPECT_FALSE(_Map.contains("content"));
+        EXPECT_EQ(_Map.find("content-length").value(), 2);
+
+        EXPECT_FALSE(_Map.insert_or_assign("content-type", 5).second);
+        EXPECT_EQ(_Map.find("content-type").value(), 5);
+        EXPECT_EQ(_Map["content-type"], 5);
+        EXPECT_EQ(_Map["accept"], 0); // inserts a value-initialized value
+        EXPECT_EQ(_Map.size(), 4);
+
+        // a key that points into the map's own key buffer
+        const utf8_string_view _Own_key = _Map.find("content-length").key();
+        EXPECT_TRUE(_Map.insert(_Own_key.substr(0, 7), 6).second);
+        EXPECT_EQ(_Map.find("content").value(), 6);
+
+        unicode_string_flat_map<int> _Wide_map;
+        _Wide_map[L"label"] = 7;
+        EXPECT_EQ(_Wide_map.find(unicode_string{L"label"}).value(), 7);
+    }
+
+    TEST(string_flat_map, erase) {
+        utf8_string_flat_map<int> _Map;
+        for (int _Idx = 0; _Idx < 100; ++_Idx) {
+            _Map.insert(make_key(static_cast<size_t>(_Idx)), _Idx);
+        }
+
+        EXPECT_EQ(_Map.erase(make_key(5)), 1);
+        EXPECT_EQ(_Map.erase(make_key(5)), 0);
+        EXPECT_FALSE(_Map.contains(make_key(5)));
+        EXPECT_EQ(_Map.size(), 99);
+
+        // erase every entry with an odd value while iterating
+        for (auto _Iter = _Map.begin(); _Iter != _Map.end();) {
+            if (_Iter.value() % 2 != 0) {
+                _Iter = _Map.erase(_Iter);
+            } else {
+                ++_Iter;
+            }
+        }
+
+        EXPECT_EQ(_Map.size(), 50);
+        for (int _Idx = 0; _Idx < 100; ++_Idx) {
+            EXPECT_EQ(_Map.contains(make_key(static_cast<size_t>(_Idx))), _Idx % 2 == 0);
+        }
+
+        _Map.clear();
+        EXPECT_TRUE(_Map.empty());
+        EXPECT_EQ(_Map.begin(), _Map.end());
+        EXPECT_FALSE(_Map.contains(make_key(0)));
+    }
+
+    TEST(string_flat_map, iteration) {
+        utf8_string_flat_map<size_t> _Map;
+        for (size_t _Idx = 0; _Idx < 1000; ++_Idx) {
+            _Map.insert(make_key(_Idx), _Idx);
+        }
+
+        // every entry is visited once
+        size_t _Count = 0;
+        size_t _Sum   = 0;
+        for (const auto [_Key, _Value] : _Map) {
+            EXPECT_EQ(_Key, make_key(_Value));
+            ++_Count;
+            _Sum += _Value;
+        }
+
+        EXPECT_EQ(_Count, 1000);
+        EXPECT_EQ(_Sum, 999 * 1000 / 2);
+
+        for (auto [_Key, _Value] : _Map) { // the values are modifiable
+            _Value *= 2;
+        }
+
+        const utf8_string_flat_map<size_t>& _Const_map = _Map;
+        EXPECT_EQ(_Const_map.find(make_key(10)).value(), 20);
+    }
+
+    TEST(string_flat_map, churn) {
+        // mixed insertions and erasures compared against a reference map
+        counting_resource _Resource;
+        {
+            utf8_string_flat_map<utf8_string> _Map(&_Resource);
+            ::std::unordered_map<::std::string, ::std::string> _Reference;
+            uint64_t _State = 1;
+            for (size_t _Step = 0; _Step < 50000; ++_Step) {
+                _State                 = _State * 6364136223846793005ull + 1442695040888963407ull;
+                const size_t _Idx      = static_cast<size_t>(_State >> 33) % 3000;
+                const utf8_string _Key = make_key(_Idx);
+                const ::std::string _Std_key(_Key.data(), _Key.size());
+                if ((_State >> 20) % 3 == 0) {
+                    EXPECT_EQ(_Map.erase(_Key), _Reference.erase(_Std_key));
+                } else {
+                    const utf8_string _Value(_Idx % 40, 'v');
+                    EXPECT_EQ(_Map.try_emplace(_Key, _Value).second,
+                        _Reference.try_emplace(_Std_key, _Value.data(), _Value.size()).second);
+                }
+            }
+
+            EXPECT_EQ(_Map.size(), _Reference.size());
+            for (const auto& [_Key, _Value] : _Reference) {
+                const auto _Iter = _Map.find(utf8_string_view{_Key.data(), _Key.size()});
+                ASSERT_NE(_Iter, _Map.end());
+                EXPECT_EQ(_Iter.value(), utf8_string_view(_Value.data(), _Value.size()));
+            }
+
+            // the map can be moved, the moved-from one is empty
+            utf8_string_flat_map<utf8_string> _Moved = ::std::move(_Map);
+            EXPECT_EQ(_Moved.size(), _Reference.size());
+            EXPECT_TRUE(_Map.empty());
+        }
+
+        EXPECT_EQ(_Resource.allocations, _Resource.deallocations);
+    }
+
+    TEST(string_flat_map, aliased_value) {
+        // the inserted value refers to another entry's value, which moves whenever the entry buffer grows
+        utf8_string_flat_map<utf8_string> _Map;
+        const utf8_string _Expected(100, 'a');
+        _Map.insert("a", _Expected);
+        for (size_t _Idx = 0; _Idx < 1000; ++_Idx) {
+            const utf8_string _Key = make_key(_Idx);
+            if (_Idx % 3 == 0) {
+                _Map.insert(_Key, _Map.find("a").value());
+            } else if (_Idx % 3 == 1) {
+                _Map.try_emplace(_Key, _Map.find("a").value());
+            } else {
+                _Map.insert_or_assign(_Key, _Map.find("a").value());
+            }
+        }
+
+        EXPECT_EQ(_Map.size(), 1001);
+        for (const auto& [_Key, _Value] : _Map) {
+            EXPECT_EQ(_Value, _Expected);
+        }
+    }
+
+    TEST(string_flat_map, reserve) {
+        counting_resource _Resource;
+        utf8_string_flat_map<int> _Map(&_Resource);
+        _Map.reserve(1000);
+        const size_t _Capacity = _Map.capacity();
+        EXPECT_GE(_Capacity - _Capacity / 8, 1000);
+        for (int _Idx = 0; _Idx < 1000; ++_Idx) {
+            _Map.insert(make_key(static_cast<size_t>(_Idx)), _Idx);
+        }
+
+        EXPECT_EQ(_Map.capacity(), _Capacity); // no rehashing
+    }
+} // namespace mjx
\ No newline at end of file
@@ -147,4 +147,54 @@ namespace mjx {
         EXPECT_EQ(_Str.rfind('B', 4), 4);
         EXPECT_EQ(_Str.rfind('C'), utf8_string_view::npos);
     }
+
+    TEST(string_view, find_first_of) {
+        const utf8_string_view _Str = "key = value; other=1";
+        EXPECT_EQ(_Str.find_first_of("=;"), 4);
+        EXPECT_EQ(_Str.find_first_of("=;", 5), 11);
+        EXPECT_EQ(_Str.find_first_of(';'), 11);
+        EXPECT_EQ(_Str.find_first_of("=;:", 12, 1), 18);
+        EXPECT_EQ(_Str.find_first_of("#!"), utf8_string_view::npos);
+        EXPECT_EQ(_Str.find_first_of(""), utf8_string_view::npos);
+        EXPECT_EQ(_Str.find_first_of("=", 100), utf8_string_view::npos);
+    }
+
+    TEST(string_view, find_last_of) {
+        const utf8_string_view _Str = "path/to/the/file.txt";
+        EXPECT_EQ(_Str.find_last_of("/\\"), 11);
+        EXPECT_EQ(_Str.find_last_of("/\\", 10), 7);
+        EXPECT_EQ(_Str.find_last_of('.'), 16);
+        EXPECT_EQ(_Str.find_last_of("/.", 3, 1), utf8_string_view::npos);
+        EXPECT_EQ(_Str.find_last_of("p"), 0);
+        EXPECT_EQ(utf8_string_view{}.find_last_of("/"), utf8_string_view::npos);
+    }
+
+    TEST(string_view, find_first_not_of) {
+        const utf8_string_view _Str = "  \t value \n";
+        EXPECT_EQ(_Str.find_first_not_of(" \t\n"), 4);
+        EXPECT_EQ(_Str.find_first_not_of(' '), 2);
+        EXPECT_EQ(_Str.find_first_not_of(" \t\n", 9), utf8_string_view::npos);
+        EXPECT_EQ(_Str.find_first_not_of(""), 0);
+        EXPECT_EQ(_Str.find_first_not_of("", 3), 3);
+    }
+
+    TEST(string_view, find_last_not_of) {
+        const utf8_string_view _Str = "  \t value \n";
+        EXPECT_EQ(_Str.find_last_not_of(" \t\n"), 8);
+        EXPECT_EQ(_Str.find_last_not_of('\n'), 9);
+        EXPECT_EQ(_Str.find_last_not_of(" \t\n", 3), utf8_string_view::npos);
+        EXPECT_EQ(_Str.find_last_not_of("value \t\n", utf8_string_view::npos, 5), 10);
+        EXPECT_EQ(_Str.find_last_not_of(""), 10);
+    }
+
+#ifdef _MJSTR_INLINE_ACCESSORS
+    TEST(string_view, constexpr_accessors) {
+        // trivial accessors are usable in constant expressions only if they are defined inline
+        constexpr utf8_string_view _Str("constexpr", 9);
+        static_assert(_Str.size() == 9);
+        static_assert(_Str.front() == 'c' && _Str.back() == 'r');
+        static_assert(*(_Str.begin() + 6) == 'x');
+        static_assert(_Str.begin() + 9 == _Str.end());
+    }
+#endif // _MJSTR_INLINE_ACCESSORS
 } // namespace mjx
\ No newline at end of file
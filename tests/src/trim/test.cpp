@@ -0,0 +1,106 @@
+// test.cpp
+
+// Copyright (c) Mateusz Jandura. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <mjstr/string.hpp>
+#include <mjstr/trim.hpp>
+
+namespace mjx {
+    TEST(trim, whitespace) {
+        EXPECT_EQ(trim("  \t value \r\n"), "value");
+        EXPECT_EQ(trim_left("  \t value \r\n"), "value \r\n");
+        EXPECT_EQ(trim_right("  \t value \r\n"), "  \t value");
+        EXPECT_EQ(trim("value"), "value");
+        EXPECT_EQ(trim("a b"), "a b"); // the inner characters are kept
+        EXPECT_EQ(trim(""), "");
+        EXPECT_EQ(trim(" \v\f "), "");
+        EXPECT_EQ(trim_left(" \v\f "), "");
+        EXPECT_EQ(trim_right(" \v\f "), "");
+        EXPECT_EQ(trim(L"\t wide \t"), L"wide");
+
+        // the result is a view into the trimmed characters
+        const utf8_string _Str         = "  key  ";
+        const utf8_string_view _Result = trim(_Str);
+        EXPECT_EQ(_Result.data(), _Str.data() + 2);
+        EXPECT_EQ(_Result.size(), 3);
+    }
+
+    TEST(trim, custom_set) {
+        EXPECT_EQ(trim("0001200", "0"), "12");
+        EXPECT_EQ(trim_left("0001200", "0"), "1200");
+        EXPECT_EQ(trim_right("0001200", "0"), "00012");
+        EXPECT_EQ(trim("\"quoted\"", "\""), "quoted");
+        EXPECT_EQ(trim("-+-x+-+", "+-"), "x");
+        EXPECT_EQ(trim("  value  ", ""), "  value  "); // an empty set removes nothing
+        EXPECT_EQ(trim(L"\u00A0 text\u00A0", L"\u00A0 "), L"text"); // non-ASCII characters
+        EXPECT_EQ(trim(L"\u0141x\u0141", L"\u0141"), L"x");
+
+        const byte_t _Bytes[]           = {0, 0, 7, 0, 9, 0};
+        const byte_t _Zero              = 0;
+        const byte_string_view _Trimmed = trim(byte_string_view{_Bytes, 6}, byte_string_view{&_Zero, 1});
+        EXPECT_EQ(_Trimmed.data(), _Bytes + 2);
+        EXPECT_EQ(_Trimmed.size(), 3);
+    }
+
+    TEST(trim, long_padding) {
+        // long runs of padding are skipped by the SIMD kernels, the boundaries may be anywhere
+        for (size_t _Left = 0; _Left < 80; _Left += 3) {
+            for (size_t _Right = 0; _Right < 80; _Right += 5) {
+                const utf8_string _Str = utf8_string(_Left, ' ') + "fixed width" + utf8_string(_Right, '\t');
+                EXPECT_EQ(trim(_Str), "fixed width");
+                EXPECT_EQ(trim_left(_Str).size(), 11 + _Right);
+                EXPECT_EQ(trim_right(_Str).size(), _Left + 11);
+
+                const unicode_string _Wide = unicode_string(_Left, L'.') + L"x" + unicode_string(_Right, L'.');
+                EXPECT_EQ(trim(_Wide, L"."), L"x");
+            }
+
+            EXPECT_EQ(trim(utf8_string(_Left, ' ')), "");
+        }
+    }
+
+    TEST(trim, in_place) {
+        utf8_string _Str = "   padded field   ";
+        EXPECT_EQ(trim_in_place(_Str), "padded field");
+        EXPECT_EQ(_Str, "padded field");
+
+        _Str = "xxabcxx";
+        EXPECT_EQ(trim_left_in_place(_Str, "x"), "abcxx");
+        EXPECT_EQ(trim_right_in_place(_Str, "x"), "abc");
+
+        _Str = " \t ";
+        EXPECT_EQ(trim_in_place(_Str), "");
+        EXPECT_TRUE(_Str.empty());
+
+        // the capacity is kept
+        utf8_string _Long = utf8_string(100, ' ') + "value" + utf8_string(100, ' ');
+        const size_t _Capacity = _Long.capacity();
+        trim_in_place(_Long);
+        EXPECT_EQ(_Long, "value");
+        EXPECT_EQ(_Long.capacity(), _Capacity);
+
+        unicode_string _Wide = L"\n line \n";
+        trim_right_in_place(_Wide);
+        EXPECT_EQ(_Wide, L"\n line");
+        trim_left_in_place(_Wide);
+        EXPECT_EQ(_Wide, L"line");
+    }
+
+    TEST(trim, is_ascii_whitespace) {
+        for (const char _Ch : utf8_string_view{" \t\n\v\f\r"}) {
+            EXPECT_TRUE(is_ascii_whitespace(_Ch));
+        }
+
+        EXPECT_FALSE(is_ascii_whitespace('a'));
+        EXPECT_FALSE(is_ascii_whitespace('\0'));
+        EXPECT_FALSE(is_ascii_whitespace('\x0E'));
+        EXPECT_FALSE(is_ascii_whitespace('\x08'));
+        EXPECT_FALSE(is_ascii_whitespace(static_cast<char>(0x89))); // '\t' with the top bit set
+        EXPECT_FALSE(is_ascii_whitespace(L'\u00A0'));
+        EXPECT_FALSE(is_ascii_whitespace(L'\u0109'));
+        EXPECT_TRUE(is_ascii_whitespace(L'\r'));
+        EXPECT_TRUE(is_ascii_whitespace(byte_t{' '}));
+    }
+} // namespace mjx
\ No newline at end of file